@@ -0,0 +1,153 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the cost of importing a large module. An interface file with
+ * many functions and classes is generated, and it is imported a number of
+ * times, once by parsing and analyzing the interface file and once by
+ * reading the binary interface file written from it.
+ *
+ * Usage: interface-benchmark [number of declarations] [number of imports]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <analysis/BasicAnalyzer.h>
+#include <ast/Module.h>
+#include <common/PassResult.h>
+#include <interface/InterfaceReader.h>
+#include <interface/InterfaceWriter.h>
+#include <parser/ParserDriver.h>
+
+using namespace soyac::ast;
+using soyac::PassResult;
+using soyac::analysis::BasicAnalyzer;
+using soyac::interface::InterfaceReader;
+using soyac::interface::InterfaceWriter;
+using soyac::parser::ParserDriver;
+
+static std::string numbered_name(const char* prefix, long number)
+{
+    std::stringstream name;
+    name << prefix << number;
+    return name.str();
+}
+
+static bool parse_and_analyze(const std::filesystem::path& file)
+{
+    PassResult* result = nullptr;
+    Module* m = ParserDriver(file.string()).parse(result);
+
+    if (m == nullptr || (result != nullptr && result->foundErrors())) {
+        return false;
+    }
+
+    result = BasicAnalyzer().analyze(m);
+    return result == nullptr || !result->foundErrors();
+}
+
+static void write_interface(
+    const std::filesystem::path& file, const std::string& name, long size)
+{
+    std::ofstream out(file);
+    out << "module " << name << ";\n";
+
+    for (long i = 0; i < size; i++) {
+        if (i % 4 == 0) {
+            out << "class C" << i << "\n{\n"
+                << "    var count : int;\n"
+                << "    extern function at(index : long) : double;\n"
+                << "    extern function put(index : long, value : double);\n"
+                << "}\n";
+        } else {
+            out << "extern function f" << i << "(a : int, b : double[]) : C"
+                << (i - i % 4) << ";\n";
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    long size = (argc > 1) ? std::atol(argv[1]) : 4000;
+    long imports = (argc > 2) ? std::atol(argv[2]) : 20;
+
+    std::filesystem::path dir = std::filesystem::temp_directory_path()
+        / "soyac-interface-benchmark";
+    std::filesystem::create_directories(dir);
+
+    std::ofstream(dir / "__core__.soyi") << "module __core__;\n"
+                                         << "class Object {}\n";
+
+    if (!parse_and_analyze(dir / "__core__.soyi")) {
+        std::cerr << "interface-benchmark: analysis failed" << std::endl;
+        return 1;
+    }
+
+    /*
+     * Every import is given its own module name, since a module can only
+     * be loaded once.
+     */
+    for (long i = 0; i < imports; i++) {
+        write_interface(dir / (numbered_name("text", i) + ".soyi"),
+            numbered_name("text", i), size);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < imports; i++) {
+        if (!parse_and_analyze(
+                dir / (numbered_name("text", i) + ".soyi"))) {
+            std::cerr << "interface-benchmark: analysis failed" << std::endl;
+            return 1;
+        }
+    }
+
+    std::chrono::duration<double> textTime
+        = std::chrono::steady_clock::now() - start;
+
+    std::error_code error;
+    InterfaceWriter(Module::get(Name("text0")))
+        .write(dir / "binary.soyb", error);
+
+    if (error) {
+        std::cerr << "interface-benchmark: " << error.message() << std::endl;
+        return 1;
+    }
+
+    start = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < imports; i++) {
+        InterfaceReader reader((dir / "binary.soyb").string());
+        PassResult* result = nullptr;
+        reader.read(Module::get(Name(numbered_name("binary", i)), true),
+            result);
+
+        if (result != nullptr && result->foundErrors()) {
+            std::cerr << "interface-benchmark: reading failed" << std::endl;
+            return 1;
+        }
+    }
+
+    std::chrono::duration<double> binaryTime
+        = std::chrono::steady_clock::now() - start;
+
+    std::cout << size << " declarations, " << imports << " imports: "
+              << (textTime.count() * 1e3 / imports) << " ms per .soyi, "
+              << (binaryTime.count() * 1e3 / imports) << " ms per .soyb ("
+              << (textTime.count() / binaryTime.count()) << "x faster)"
+              << std::endl;
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
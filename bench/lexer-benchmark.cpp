@@ -0,0 +1,121 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the throughput of the lexical analyzer in tokens per second.
+ *
+ * Usage: lexer-benchmark [source file]
+ *
+ * If no source file is given, a synthetic source of about 4 MB is
+ * generated and lexed instead.
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <parser/Lexer.h>
+#include <parser/SourceFile.h>
+
+using soyac::PassResultBuilder;
+using soyac::parser::Lexer;
+using soyac::parser::SourceFile;
+
+static std::string synthetic_source(std::size_t minSize)
+{
+    static const char* snippet
+        = "/*\n"
+          " * Synthetic benchmark input.\n"
+          " */\n"
+          "\n"
+          "struct Point\n"
+          "{\n"
+          "    var x : int;\n"
+          "    var y : int;\n"
+          "\n"
+          "    constructor(x : int, y : int)\n"
+          "    {\n"
+          "        this.x = x;\n"
+          "        this.y = y;\n"
+          "    }\n"
+          "}\n"
+          "\n"
+          "// Offsets a point.\n"
+          "function offset_by(p : Point, x : int32, y : uint16) : Point\n"
+          "{\n"
+          "    var offset = p;\n"
+          "    offset.x += x * 0x10 - 0b101;\n"
+          "    offset.y = offset.y + y / 2.5e3;\n"
+          "    return offset;\n"
+          "}\n"
+          "\n"
+          "if (offset_by(new Point(1, 218), 10, 4).x != 11 && 'c' != '\\n')\n"
+          "    exit(1);\n"
+          "\n";
+
+    std::string source;
+
+    while (source.size() < minSize) {
+        source += snippet;
+    }
+
+    return source;
+}
+
+int main(int argc, char** argv)
+{
+    std::string syntheticSource;
+    std::unique_ptr<SourceFile> sourceFile;
+    std::string fileName = "<synthetic>";
+    const char* source;
+    std::size_t sourceSize;
+
+    if (argc > 1) {
+        fileName = argv[1];
+
+        try {
+            sourceFile.reset(new SourceFile(fileName));
+        } catch (const std::ifstream::failure&) {
+            std::cerr << "lexer-benchmark: cannot read " << fileName
+                      << std::endl;
+            return 1;
+        }
+
+        source = sourceFile->data();
+        sourceSize = sourceFile->size();
+    } else {
+        syntheticSource = synthetic_source(4 * 1024 * 1024);
+        source = syntheticSource.c_str();
+        sourceSize = syntheticSource.size();
+    }
+
+    PassResultBuilder resultBuilder;
+    Lexer lexer(source, sourceSize, fileName, &resultBuilder);
+
+    yy::SoyaParser::semantic_type yylval;
+    yy::SoyaParser::location_type yylloc;
+    long numTokens = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    while (lexer.nextToken(&yylval, &yylloc) != -1) {
+        numTokens++;
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    std::cout << fileName << ": " << sourceSize << " bytes, " << numTokens
+              << " tokens in " << elapsed.count() << " s ("
+              << (long)(numTokens / elapsed.count()) << " tokens/s)"
+              << std::endl;
+
+    return 0;
+}
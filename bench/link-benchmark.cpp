@@ -0,0 +1,105 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the cost of abstract syntax tree edges (Link instances): the
+ * memory used per edge, and the throughput of Node::replaceWith() in
+ * retargeted edges per second.
+ *
+ * Usage: link-benchmark [number of edges]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include <ast/Link.h>
+#include <ast/Node.h>
+
+using soyac::ast::Link;
+using soyac::ast::Node;
+
+static std::size_t sAllocatedBytes = 0;
+
+void* operator new(std::size_t size)
+{
+    sAllocatedBytes += size;
+
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t size) noexcept { std::free(p); }
+
+class BenchmarkNode : public Node {
+};
+
+int main(int argc, char** argv)
+{
+    long numEdges = (argc > 1) ? std::atol(argv[1]) : 1000000;
+    const long edgesPerNode = 8;
+    long numNodes = numEdges / edgesPerNode;
+
+    std::vector<BenchmarkNode*> nodes;
+    std::vector<BenchmarkNode*> replacements;
+
+    for (long i = 0; i < numNodes; i++) {
+        nodes.push_back(new BenchmarkNode);
+        nodes.back()->ref();
+        replacements.push_back(new BenchmarkNode);
+        replacements.back()->ref();
+    }
+
+    /*
+     * Memory per edge.
+     */
+    std::size_t before = sAllocatedBytes;
+    std::vector<Link<Node>*> links;
+    links.reserve(numNodes * edgesPerNode);
+
+    for (long i = 0; i < numNodes; i++) {
+        for (long j = 0; j < edgesPerNode; j++) {
+            links.push_back(new Link<Node>(nodes[i]));
+        }
+    }
+
+    std::size_t bytesPerEdge = (sAllocatedBytes - before
+                                   - links.capacity() * sizeof(Link<Node>*))
+        / links.size();
+
+    /*
+     * replaceWith() throughput.
+     */
+    auto start = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < numNodes; i++) {
+        nodes[i]->replaceWith(replacements[i]);
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    for (Link<Node>* link : links) {
+        delete link;
+    }
+
+    std::cout << links.size() << " edges: " << bytesPerEdge
+              << " bytes per edge (sizeof(Link) = " << sizeof(Link<Node>)
+              << "), replaceWith() retargeted "
+              << (long)(links.size() / elapsed.count()) << " edges/s"
+              << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the effect of link-time optimization (-flto) on a program
+ * consisting of two modules, whose run time is dominated by calls to
+ * small functions of the other module. The program is compiled at the
+ * given optimization level with and without -flto, and the run time of
+ * both binaries is reported.
+ *
+ * Usage: lto-benchmark [optimization level]
+ *
+ * Must be run from the "bench" build directory, as the compiler, the
+ * runtime library and the benchmark program are found relative to it.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+static bool compile(const std::string& options, const std::string& output)
+{
+    std::string command
+        = "../src/soyac -I ../runtime -L ../runtime -s lto " + options
+        + " -o " + output + " lto/main.soya";
+
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "lto-benchmark: `" << command << "' failed" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+static double run(const std::string& binary)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    if (std::system(binary.c_str()) != 0) {
+        std::cerr << "lto-benchmark: `" << binary << "' failed" << std::endl;
+        std::exit(1);
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char** argv)
+{
+    std::string level = (argc > 1) ? argv[1] : "2";
+    const int runs = 5;
+
+    if (!compile("-O" + level, "./lto-benchmark-separate.out")
+        || !compile("-O" + level + " -flto", "./lto-benchmark-lto.out")) {
+        return 1;
+    }
+
+    double separate = 0.0;
+    double lto = 0.0;
+
+    for (int i = 0; i < runs; i++) {
+        separate += run("./lto-benchmark-separate.out");
+        lto += run("./lto-benchmark-lto.out");
+    }
+
+    std::cout << "-O" << level << ": " << separate / runs
+              << " s per run, -O" << level << " -flto: " << lto / runs
+              << " s per run (" << separate / lto << "x)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the cost of allocating and accessing class instances. The
+ * benchmark program builds lists of ten million small objects of a
+ * three-level class hierarchy in total and walks them, reading fields
+ * of every level. The program is compiled at the given optimization
+ * level, and its run time is reported.
+ *
+ * Usage: object-benchmark [optimization level]
+ *
+ * Must be run from the "bench" build directory, as the compiler, the
+ * runtime library and the benchmark program are found relative to it.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+static const long NUM_OBJECTS = 10000000;
+
+int main(int argc, char** argv)
+{
+    std::string level = (argc > 1) ? argv[1] : "2";
+    const int runs = 5;
+
+    std::string command = "../src/soyac -I ../runtime -L ../runtime -O"
+        + level + " -o ./object-benchmark.out objects/main.soya";
+
+    if (std::system(command.c_str()) != 0) {
+        std::cerr << "object-benchmark: `" << command << "' failed"
+                  << std::endl;
+        return 1;
+    }
+
+    double total = 0.0;
+
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+
+        if (std::system("./object-benchmark.out") != 0) {
+            std::cerr << "object-benchmark: ./object-benchmark.out failed"
+                      << std::endl;
+            return 1;
+        }
+
+        std::chrono::duration<double> elapsed
+            = std::chrono::steady_clock::now() - start;
+        total += elapsed.count();
+    }
+
+    std::cout << "-O" << level << ": " << total / runs << " s per run ("
+              << (long)(NUM_OBJECTS * runs / total) << " objects/s)"
+              << std::endl;
+
+    return 0;
+}
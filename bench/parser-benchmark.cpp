@@ -0,0 +1,113 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the time and memory needed to parse a module.
+ *
+ * Usage: parser-benchmark [source file]
+ *
+ * If no source file is given, a synthetic module consisting of 100,000
+ * statements is generated and parsed instead. Besides the parse time, the
+ * process's peak resident set size and the number of bytes allocated from
+ * the module's node arenas are reported.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <parser/ParserDriver.h>
+
+using soyac::PassResult;
+using soyac::ast::Module;
+using soyac::parser::ParserDriver;
+
+static std::string synthetic_source(int numStatements)
+{
+    std::stringstream source;
+
+    for (int i = 0; i < numStatements; i += 4) {
+        source << "var v" << i << " : int = " << i << " * 2 + 1;\n"
+               << "v" << i << " = v" << i << " - (3 << 1);\n"
+               << "if (v" << i << " > 10)\n"
+               << "{\n"
+               << "    print(v" << i << ", 'l');\n"
+               << "}\n";
+    }
+
+    return source.str();
+}
+
+int main(int argc, char** argv)
+{
+    std::string fileName;
+    bool temporary = false;
+
+    if (argc > 1) {
+        fileName = argv[1];
+    } else {
+        char path[] = "/tmp/parser-benchmark-XXXXXX";
+        int fd = mkstemp(path);
+
+        if (fd == -1) {
+            std::cerr << "parser-benchmark: cannot create temporary file"
+                      << std::endl;
+            return 1;
+        }
+
+        close(fd);
+        fileName = path;
+        temporary = true;
+
+        std::ofstream out(fileName.c_str());
+        out << synthetic_source(100000);
+    }
+
+    ParserDriver driver(fileName);
+    PassResult* result = nullptr;
+    Module* module;
+
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        module = driver.parse(result);
+    } catch (const std::ifstream::failure&) {
+        std::cerr << "parser-benchmark: cannot read " << fileName << std::endl;
+        return 1;
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    if (temporary) {
+        std::remove(fileName.c_str());
+    }
+
+    if (module == nullptr) {
+        std::cerr << "parser-benchmark: " << fileName << " could not be parsed"
+                  << std::endl;
+        return 1;
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    std::cout << fileName << ": parsed in " << elapsed.count() << " s, peak RSS "
+              << usage.ru_maxrss / 1024 << " MB, "
+              << module->arenaBytesUsed() / 1024 << " KB in node arenas"
+              << std::endl;
+
+    return 0;
+}
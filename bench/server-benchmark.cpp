@@ -0,0 +1,106 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the latency of many small compiler invocations, as issued by
+ * a build system compiling one file at a time. A number of small source
+ * files is compiled with "-c" one by one, first by running the compiler
+ * directly, and then by forwarding every invocation to a compile server
+ * ("--server" and "--connect").
+ *
+ * Usage: server-benchmark [number of files]
+ *
+ * Must be run from the "bench" build directory, as the compiler and the
+ * runtime library are found relative to it.
+ */
+
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+static const char* const SOCKET_PATH = "./server-benchmark.sock";
+
+static std::string source_file(long number)
+{
+    return "./server-benchmark-" + std::to_string(number) + ".soya";
+}
+
+static double compile_all(long numFiles, const std::string& options)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (long i = 0; i < numFiles; i++) {
+        std::string command = "../src/soyac -c -I ../runtime " + options
+            + " " + source_file(i);
+
+        if (std::system(command.c_str()) != 0) {
+            std::cerr << "server-benchmark: `" << command << "' failed"
+                      << std::endl;
+            std::exit(1);
+        }
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / numFiles;
+}
+
+int main(int argc, char** argv)
+{
+    long numFiles = (argc > 1) ? std::atol(argv[1]) : 50;
+
+    for (long i = 0; i < numFiles; i++) {
+        std::ofstream out(source_file(i));
+        out << "function f" << i << "(x : int) : int\n"
+            << "{\n"
+            << "    return x * " << i << " + 1;\n"
+            << "}\n"
+            << "print(f" << i << "(" << i << "));\n";
+    }
+
+    double direct = compile_all(numFiles, "");
+
+    pid_t server = fork();
+
+    if (server == 0) {
+        execl("../src/soyac", "soyac", "--server", SOCKET_PATH, "-I",
+            "../runtime", (char*)nullptr);
+        std::_Exit(127);
+    }
+
+    while (!std::filesystem::exists(SOCKET_PATH)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    double forwarded
+        = compile_all(numFiles, std::string("--connect ") + SOCKET_PATH);
+
+    kill(server, SIGTERM);
+    waitpid(server, nullptr, 0);
+    std::filesystem::remove(SOCKET_PATH);
+
+    for (long i = 0; i < numFiles; i++) {
+        std::filesystem::path object(source_file(i));
+        std::filesystem::remove(source_file(i));
+        std::filesystem::remove(object.replace_extension(".o"));
+    }
+
+    std::cout << numFiles << " files: " << direct * 1e3
+              << " ms per file directly, " << forwarded * 1e3
+              << " ms per file with the compile server (" << direct / forwarded
+              << "x faster)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,83 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures name resolution in the SymbolTable. A module-wide scope with
+ * many global variables is created, and below it a deep stack of nested
+ * block scopes, each declaring a few local variables. Then every global
+ * and every local is looked up from the innermost scope.
+ *
+ * Usage: symbol-table-benchmark [number of globals] [nesting depth]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <analysis/SymbolTable.h>
+#include <ast/IntegerType.h>
+#include <ast/Variable.h>
+
+using namespace soyac::ast;
+using soyac::analysis::SymbolTable;
+
+static Name numbered_name(const char* prefix, long number)
+{
+    std::stringstream name;
+    name << prefix << number;
+    return Name(name.str());
+}
+
+int main(int argc, char** argv)
+{
+    long numGlobals = (argc > 1) ? std::atol(argv[1]) : 50000;
+    long depth = (argc > 2) ? std::atol(argv[2]) : 64;
+    const long localsPerScope = 4;
+    const int numPasses = 10;
+
+    SymbolTable* table = SymbolTable::get(nullptr, true);
+    std::vector<Name> names;
+
+    for (long i = 0; i < numGlobals; i++) {
+        names.push_back(numbered_name("g", i));
+        table->addGlobal(new Variable(names.back(), TYPE_INT));
+    }
+
+    for (long i = 0; i < depth; i++) {
+        table->enterScope();
+
+        for (long j = 0; j < localsPerScope; j++) {
+            names.push_back(numbered_name("l", i * localsPerScope + j));
+            table->add(new Variable(names.back(), TYPE_INT));
+        }
+    }
+
+    long resolved = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int pass = 0; pass < numPasses; pass++) {
+        for (const Name& name : names) {
+            if (table->lookup(name) != nullptr) {
+                resolved++;
+            }
+        }
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    std::cout << numGlobals << " globals, nesting depth " << depth << ": "
+              << (elapsed.count() * 1e9 / (numPasses * names.size()))
+              << " ns per lookup (" << resolved << " of "
+              << numPasses * names.size() << " resolved)" << std::endl;
+
+    delete table;
+    return 0;
+}
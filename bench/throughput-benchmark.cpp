@@ -0,0 +1,578 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures the throughput of the compiler's phases in source lines per
+ * second. Synthetic programs of increasing size are generated, and every
+ * phase (lexing, parsing, basic analysis, control flow analysis and code
+ * generation) is run on them repeatedly. Only the phase itself is timed;
+ * the preceding phases are run outside of the measurement.
+ *
+ * There are four kinds of programs: "mixed" programs consist of many
+ * functions, structs and classes with deeply nested expressions, long
+ * blocks and large array literals, "locals" programs consist of functions
+ * with many parameters and local variables, nearly every expression of
+ * which is a variable reference, "overloads" programs consist of
+ * thousands of overloads of a single function, which call each other,
+ * and "fields" programs consist of deep class hierarchies with many
+ * instance variables, which are accessed by functions.
+ *
+ * Usage: throughput-benchmark [phase]
+ *        throughput-benchmark --emit [scale] [kind]
+ *
+ * If a phase is given, only the benchmarks of that phase are run. With
+ * "--emit", the program of the given kind ("mixed" by default) generated
+ * for the given scale is written to the standard output instead, so that
+ * it can be fed to other benchmarks or to the compiler itself.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <analysis/BasicAnalyzer.h>
+#include <analysis/ControlFlowAnalyzer.h>
+#include <ast/Module.h>
+#include <codegen/CodeGenerator.h>
+#include <common/PassResult.h>
+#include <parser/Lexer.h>
+#include <parser/ParserDriver.h>
+
+using namespace soyac::ast;
+using soyac::PassResult;
+using soyac::PassResultBuilder;
+using soyac::analysis::BasicAnalyzer;
+using soyac::analysis::ControlFlowAnalyzer;
+using soyac::codegen::CodeGenerator;
+using soyac::parser::Lexer;
+using soyac::parser::ParserDriver;
+
+/*
+ * Every benchmark is repeated until the measured phase has run for at
+ * least MIN_TIME seconds, but no more than MAX_ITERATIONS times and, as
+ * preparing an iteration can take much longer than the phase itself, for
+ * no more than MAX_TIME seconds including the preparation. Since modules
+ * cannot be unloaded, the repetitions are also limited to MAX_LINES
+ * source lines in total, which bounds the memory a benchmark allocates.
+ */
+static const double MIN_TIME = 0.5;
+static const double MAX_TIME = 5.0;
+static const long MAX_ITERATIONS = 1000;
+static const long MAX_LINES = 100000;
+
+static const int SCALES[] = { 1, 4, 16 };
+
+/**
+ * Runs one iteration of a benchmark and returns the time spent in the
+ * measured phase, in seconds.
+ */
+typedef std::function<double()> Iteration;
+
+static std::filesystem::path sDirectory;
+static long sNumModules = 0;
+
+static void write_expression(std::ostream& out, int depth, unsigned seed)
+{
+    static const char* const operators[] = { " + ", " * ", " - ", " / " };
+
+    if (depth == 0) {
+        out << ((seed % 2 == 0) ? "a" : "b");
+        return;
+    }
+
+    out << "(" << (seed % 7 + 1) << operators[seed % 4];
+    write_expression(out, depth - 1, seed * 31 + 17);
+    out << ")";
+}
+
+/**
+ * Generates a program whose size grows linearly with the passed scale:
+ * 25 functions and 5 structs and classes per scale unit, where every
+ * function contains a 20-level deep expression, a block of 40 statements
+ * and an array literal of 100 elements.
+ */
+static std::string generate_mixed_program(int scale)
+{
+    const int numFunctions = 25 * scale;
+    const int numTypes = 5 * scale;
+    const int expressionDepth = 20;
+    const int blockLength = 40;
+    const int arraySize = 100;
+
+    std::stringstream out;
+
+    for (int i = 0; i < numTypes; i++) {
+        out << "struct S" << i << "\n"
+            << "{\n"
+            << "    var x : int;\n"
+            << "    var y : long;\n"
+            << "}\n"
+            << "\n"
+            << "class C" << i << "\n"
+            << "{\n"
+            << "    var value : int;\n"
+            << "    var scale : int;\n"
+            << "    var point : S" << i << ";\n"
+            << "\n"
+            << "    constructor(value : int)\n"
+            << "    {\n"
+            << "        this.value = value;\n"
+            << "        this.scale = " << i << ";\n"
+            << "    }\n"
+            << "\n"
+            << "    function scaled(x : int) : int\n"
+            << "    {\n"
+            << "        point.x = x;\n"
+            << "        return point.x * scale + value;\n"
+            << "    }\n"
+            << "}\n"
+            << "\n";
+    }
+
+    for (int i = 0; i < numFunctions; i++) {
+        out << "function f" << i << "(a : int, b : int) : int\n"
+            << "{\n"
+            << "    var x = ";
+        write_expression(out, expressionDepth, i);
+        out << ";\n"
+            << "    var values = new int[](";
+
+        for (int j = 0; j < arraySize; j++) {
+            out << (j > 0 ? ", " : "") << (i + j) % 1000;
+        }
+
+        out << ");\n"
+            << "    var c = new C" << i % numTypes << "(a);\n"
+            << "    var s = x;\n";
+
+        for (int j = 0; j < blockLength; j++) {
+            out << "    s = s * " << j % 9 + 2 << " + values[" << j % arraySize
+                << "] - c.scaled(b);\n";
+        }
+
+        out << "    for (var j = 0; j < values.length; j += 1)\n"
+            << "        x = x + values[j];\n"
+            << "    if (x > s)\n"
+            << "        return x;\n"
+            << "    else\n"
+            << "        return s"
+            << (i > 0 ? " + f" + std::to_string(i - 1) + "(b, a)" : "")
+            << ";\n"
+            << "}\n"
+            << "\n";
+    }
+
+    return out.str();
+}
+
+/**
+ * Generates a program whose size grows linearly with the passed scale:
+ * 25 functions per scale unit, each of which has 8 parameters and 32
+ * local variables and assigns them in a block of 100 statements.
+ */
+static std::string generate_locals_program(int scale)
+{
+    const int numFunctions = 25 * scale;
+    const int numParameters = 8;
+    const int numLocals = 32;
+    const int blockLength = 100;
+
+    std::stringstream out;
+
+    for (int i = 0; i < numFunctions; i++) {
+        out << "function g" << i << "(";
+
+        for (int j = 0; j < numParameters; j++) {
+            out << (j > 0 ? ", " : "") << "p" << j << " : int";
+        }
+
+        out << ") : int\n"
+            << "{\n";
+
+        for (int j = 0; j < numLocals; j++) {
+            out << "    var v" << j << " = p" << j % numParameters << " + "
+                << j << ";\n";
+        }
+
+        for (int j = 0; j < blockLength; j++) {
+            out << "    v" << j % numLocals << " = v" << j * 7 % numLocals
+                << " + v" << j * 13 % numLocals << " * p"
+                << j % numParameters << " - v" << (j * 5 + 3) % numLocals
+                << ";\n";
+        }
+
+        out << "    return v0 + v" << numLocals - 1 << ";\n"
+            << "}\n"
+            << "\n";
+    }
+
+    return out.str();
+}
+
+/**
+ * Generates a program whose size grows linearly with the passed scale:
+ * 25 structs and 250 overloads of a function with two struct parameters
+ * per scale unit, each of which calls the previously declared overload.
+ */
+static std::string generate_overloads_program(int scale)
+{
+    const int numTypes = 25 * scale;
+    const int overloadsPerType = 10;
+
+    std::stringstream out;
+
+    for (int i = 0; i < numTypes; i++) {
+        out << "struct T" << i << "\n"
+            << "{\n"
+            << "    var v : int;\n"
+            << "}\n"
+            << "\n";
+    }
+
+    int previousX = -1;
+    int previousY = -1;
+
+    for (int i = 0; i < numTypes; i++) {
+        for (int j = 0; j < overloadsPerType; j++) {
+            int y = (i + j) % numTypes;
+
+            out << "function h(x : T" << i << ", y : T" << y << ") : int\n"
+                << "{\n";
+
+            if (previousX >= 0) {
+                out << "    var p : T" << previousX << ";\n"
+                    << "    var q : T" << previousY << ";\n"
+                    << "    return x.v + y.v + h(p, q);\n";
+            } else {
+                out << "    return x.v + y.v;\n";
+            }
+
+            out << "}\n"
+                << "\n";
+
+            previousX = i;
+            previousY = y;
+        }
+    }
+
+    return out.str();
+}
+
+/**
+ * Generates a program whose size grows linearly with the passed scale:
+ * 5 chains of 8 classes per scale unit, each of which extends the previous
+ * class of its chain by 16 instance variables, and one function per class
+ * assigning the class's inherited and own variables in 50 statements.
+ */
+static std::string generate_fields_program(int scale)
+{
+    const int numChains = 5 * scale;
+    const int chainLength = 8;
+    const int numFields = 16;
+    const int numStatements = 50;
+
+    std::stringstream out;
+
+    for (int i = 0; i < numChains; i++) {
+        for (int j = 0; j < chainLength; j++) {
+            out << "class C" << i << "_" << j;
+
+            if (j > 0) {
+                out << " extends C" << i << "_" << j - 1;
+            }
+
+            out << "\n"
+                << "{\n";
+
+            for (int k = 0; k < numFields; k++) {
+                out << "    var f" << j << "_" << k << " : int;\n";
+            }
+
+            out << "}\n"
+                << "\n"
+                << "function r" << i << "_" << j << "(o : C" << i << "_" << j
+                << ") : int\n"
+                << "{\n";
+
+            for (int k = 0; k < numStatements; k++) {
+                out << "    o.f" << k % (j + 1) << "_" << k % numFields
+                    << " = o.f" << k * 7 % (j + 1) << "_"
+                    << k * 3 % numFields << " + o.f" << j << "_"
+                    << (k + 5) % numFields << ";\n";
+            }
+
+            out << "    return o.f0_0;\n"
+                << "}\n"
+                << "\n";
+        }
+    }
+
+    return out.str();
+}
+
+static const struct {
+    const char* name;
+    std::string (*generate)(int scale);
+} PROGRAMS[] = {
+    { "mixed", generate_mixed_program },
+    { "locals", generate_locals_program },
+    { "overloads", generate_overloads_program },
+    { "fields", generate_fields_program },
+};
+
+static long count_lines(const std::string& source)
+{
+    return std::count(source.begin(), source.end(), '\n');
+}
+
+static double elapsed_since(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static void check(PassResult* result, const char* phase)
+{
+    if (result != nullptr && result->foundErrors()) {
+        std::cerr << "throughput-benchmark: " << phase << " failed"
+                  << std::endl;
+        std::exit(1);
+    }
+}
+
+/**
+ * Writes the passed program to a file as a module of its own, since a
+ * module can only be loaded once, and returns the file's path.
+ */
+static std::filesystem::path write_module(const std::string& source)
+{
+    std::string name = "throughput" + std::to_string(sNumModules++);
+    std::filesystem::path file = sDirectory / (name + ".soya");
+
+    std::ofstream(file) << "module " << name << ";\n" << source;
+    return file;
+}
+
+static Module* parse(const std::filesystem::path& file)
+{
+    PassResult* result = nullptr;
+    Module* m = ParserDriver(file.string()).parse(result);
+
+    if (m == nullptr) {
+        check(result, "parsing");
+        std::exit(1);
+    }
+
+    check(result, "parsing");
+    return m;
+}
+
+/**
+ * Returns a module generated from the passed program, processed by all
+ * phases up to (and excluding) the given one.
+ */
+static Module* prepare(const std::string& source, const std::string& phase)
+{
+    std::filesystem::path file = write_module(source);
+    Module* m = parse(file);
+    std::filesystem::remove(file);
+
+    if (phase != "basic-analysis") {
+        check(BasicAnalyzer().analyze(m), "basic analysis");
+
+        if (phase != "control-flow-analysis") {
+            check(ControlFlowAnalyzer().analyze(m), "control flow analysis");
+        }
+    }
+
+    return m;
+}
+
+static double measure_lexing(const std::string& source)
+{
+    PassResultBuilder resultBuilder;
+    Lexer lexer(source.c_str(), source.size(), "<generated>", &resultBuilder);
+    yy::SoyaParser::semantic_type yylval;
+    yy::SoyaParser::location_type yylloc;
+
+    auto start = std::chrono::steady_clock::now();
+    while (lexer.nextToken(&yylval, &yylloc) != -1) {
+        continue;
+    }
+
+    return elapsed_since(start);
+}
+
+static double measure_parsing(const std::string& source)
+{
+    std::filesystem::path file = write_module(source);
+    auto start = std::chrono::steady_clock::now();
+    parse(file);
+    double elapsed = elapsed_since(start);
+
+    std::filesystem::remove(file);
+    return elapsed;
+}
+
+static double measure_basic_analysis(const std::string& source)
+{
+    Module* m = prepare(source, "basic-analysis");
+    auto start = std::chrono::steady_clock::now();
+    check(BasicAnalyzer().analyze(m), "basic analysis");
+    return elapsed_since(start);
+}
+
+static double measure_control_flow_analysis(const std::string& source)
+{
+    Module* m = prepare(source, "control-flow-analysis");
+    auto start = std::chrono::steady_clock::now();
+    check(ControlFlowAnalyzer().analyze(m), "control flow analysis");
+    return elapsed_since(start);
+}
+
+static double measure_code_generation(const std::string& source)
+{
+    Module* m = prepare(source, "code-generation");
+    std::error_code error;
+
+    /*
+     * The time includes printing the generated LLVM assembly, which is
+     * discarded.
+     */
+    auto start = std::chrono::steady_clock::now();
+    CodeGenerator(m).toLLVMAssembly("/dev/null", error);
+    double elapsed = elapsed_since(start);
+
+    if (error) {
+        std::cerr << "throughput-benchmark: " << error.message() << std::endl;
+        std::exit(1);
+    }
+
+    return elapsed;
+}
+
+static void run_benchmark(
+    const std::string& name, long numLines, const Iteration& iteration)
+{
+    auto start = std::chrono::steady_clock::now();
+    double total = 0.0;
+    long iterations = 0;
+
+    while (total < MIN_TIME && iterations < MAX_ITERATIONS
+        && (iterations == 0
+            || (elapsed_since(start) < MAX_TIME
+                && (iterations + 1) * numLines <= MAX_LINES))) {
+        total += iteration();
+        iterations++;
+    }
+
+    double perIteration = total / iterations;
+
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(3)
+              << perIteration * 1e3 << " ms" << std::setw(12) << iterations
+              << std::setw(16) << (long)(numLines / perIteration)
+              << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::strcmp(argv[1], "--emit") == 0) {
+        int scale = (argc > 2) ? std::atoi(argv[2]) : 1;
+        const char* kind = (argc > 3) ? argv[3] : "mixed";
+
+        for (const auto& program : PROGRAMS) {
+            if (std::strcmp(program.name, kind) == 0) {
+                std::cout << program.generate(scale);
+                return 0;
+            }
+        }
+
+        std::cerr << "throughput-benchmark: unknown program kind `" << kind
+                  << "'" << std::endl;
+        return 1;
+    }
+
+    std::string filter = (argc > 1) ? argv[1] : "";
+
+    sDirectory = std::filesystem::temp_directory_path()
+        / "soyac-throughput-benchmark";
+    std::filesystem::create_directories(sDirectory);
+
+    std::ofstream(sDirectory / "__core__.soyi") << "module __core__;\n"
+                                                << "class Object {}\n";
+    Module* core = parse(sDirectory / "__core__.soyi");
+    check(BasicAnalyzer().analyze(core), "basic analysis");
+
+    struct {
+        const char* name;
+        double (*measure)(const std::string&);
+    } phases[] = {
+        { "lexing", measure_lexing },
+        { "parsing", measure_parsing },
+        { "basic-analysis", measure_basic_analysis },
+        { "control-flow-analysis", measure_control_flow_analysis },
+        { "code-generation", measure_code_generation },
+    };
+
+    std::cout << std::left << std::setw(40) << "Benchmark" << std::right
+              << std::setw(15) << "Time" << std::setw(12) << "Iterations"
+              << std::setw(16) << "Lines/s" << std::endl
+              << std::string(83, '-') << std::endl;
+
+    for (const auto& phase : phases) {
+        if (!filter.empty() && filter != phase.name) {
+            continue;
+        }
+
+        for (const auto& program : PROGRAMS) {
+            for (int scale : SCALES) {
+                std::string source = program.generate(scale);
+                long numLines = count_lines(source);
+                std::string name = std::string(phase.name) + "/"
+                    + program.name + "/" + std::to_string(numLines);
+
+                /*
+                 * Every benchmark runs in a process of its own, so that
+                 * the memory of the modules it creates is released
+                 * afterwards.
+                 */
+                pid_t pid = fork();
+
+                if (pid == 0) {
+                    run_benchmark(name, numLines,
+                        [&]() { return phase.measure(source); });
+                    std::exit(0);
+                }
+
+                int status;
+
+                if (pid < 0 || waitpid(pid, &status, 0) != pid
+                    || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+                    std::cerr << "throughput-benchmark: " << name
+                              << " failed" << std::endl;
+                    return 1;
+                }
+            }
+        }
+    }
+
+    std::filesystem::remove_all(sDirectory);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+/*
+ * Measures how fast NodeLists can be traversed. A block of call
+ * statements is built, and its statements (Block::statements_begin()) and
+ * the arguments of each call (CallExpression::arguments_begin()) are
+ * iterated over repeatedly.
+ *
+ * Usage: traversal-benchmark [number of statements] [number of passes]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <ast/Block.h>
+#include <ast/CallExpression.h>
+#include <ast/ExpressionStatement.h>
+#include <ast/IntegerLiteral.h>
+#include <ast/UnresolvedSimpleNameExpression.h>
+
+using namespace soyac::ast;
+
+int main(int argc, char** argv)
+{
+    long numStatements = (argc > 1) ? std::atol(argv[1]) : 100000;
+    long numPasses = (argc > 2) ? std::atol(argv[2]) : 100;
+    const int argumentsPerCall = 3;
+
+    Block* block = new Block;
+    block->ref();
+
+    for (long i = 0; i < numStatements; i++) {
+        Expression* args[argumentsPerCall];
+
+        for (int j = 0; j < argumentsPerCall; j++) {
+            args[j] = new IntegerLiteral(IntegerValue(i + j, true));
+        }
+
+        Expression* callee = new UnresolvedSimpleNameExpression(Name("f"));
+        block->addStatement(new ExpressionStatement(
+            new CallExpression(callee, args, args + argumentsPerCall)));
+    }
+
+    long visited = 0;
+    int64_t sum = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (long pass = 0; pass < numPasses; pass++) {
+        for (Block::statements_iterator it = block->statements_begin();
+            it != block->statements_end(); it++) {
+            ExpressionStatement* stmt = static_cast<ExpressionStatement*>(*it);
+            CallExpression* call
+                = static_cast<CallExpression*>(stmt->expression());
+
+            for (CallExpression::arguments_iterator ait
+                = call->arguments_begin();
+                ait != call->arguments_end(); ait++) {
+                sum += static_cast<IntegerLiteral*>(*ait)->value().data();
+                visited++;
+            }
+
+            visited++;
+        }
+    }
+
+    std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+
+    block->unref();
+
+    std::cout << numStatements << " statements, " << numPasses
+              << " passes: " << (elapsed.count() * 1e9 / visited)
+              << " ns per visited node (checksum " << sum << ")"
+              << std::endl;
+
+    return 0;
+}
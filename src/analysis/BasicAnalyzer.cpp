@@ -785,9 +785,9 @@ void* BasicAnalyzer::visitUnresolvedEntityImport(UnresolvedEntityImport* imp)
     Module* m = Module::get(imp->importedName().first());
 
     if (m == nullptr) {
-        return new std::string(imp->importedName().first());
+        return new std::string(imp->importedName().first().str());
     } else {
-        std::string declName = imp->importedName().last();
+        Identifier declName = imp->importedName().last();
         NodeList<DeclaredEntity> entities;
 
         for (Block::statements_iterator it = m->body()->statements_begin();
@@ -2299,6 +2299,16 @@ void* BasicAnalyzer::visitUnresolvedSimpleNameExpression(
 
     if (lookupResult != nullptr) {
         DeclaredEntity* entity = dynamic_cast<DeclaredEntity*>(lookupResult);
+        FunctionGroup* group = dynamic_cast<FunctionGroup*>(lookupResult);
+
+        /*
+         * A function group is not declared itself; whether it consists of
+         * instance functions is told by its overloads.
+         */
+        if (group != nullptr
+            && group->overloads_begin() != group->overloads_end()) {
+            entity = *group->overloads_begin();
+        }
 
         Expression* newExpr;
 
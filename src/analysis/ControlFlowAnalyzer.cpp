@@ -105,8 +105,14 @@ void* ControlFlowAnalyzer::visitIfStatement(IfStatement* stmt)
 
     bool alwaysReturns = (bool)stmt->body()->visit(this);
 
+    /*
+     * Without an else branch, control falls through whenever the
+     * condition is false.
+     */
     if (stmt->elseBody() != nullptr) {
         alwaysReturns = ((bool)stmt->elseBody()->visit(this)) && alwaysReturns;
+    } else {
+        alwaysReturns = false;
     }
 
     return (void*)alwaysReturns;
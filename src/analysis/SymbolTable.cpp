@@ -18,6 +18,17 @@ namespace analysis {
 
 /**
  * Represents a scope.
+ *
+ * The scope's members are kept in an open-addressing hash table with
+ * linear probing, keyed by the interned identifier of their names. As most
+ * scopes (those of functions and blocks) only have a handful of members,
+ * the first few of them are stored inside the Scope itself and looked up
+ * by a linear scan; the hash table is only allocated once a scope outgrows
+ * this inline storage.
+ *
+ * Additionally, every scope keeps a small bit set summarizing the names
+ * of its members, which lets SymbolTable::lookup() skip scopes that
+ * cannot contain a name without searching them.
  */
 class Scope {
 public:
@@ -28,6 +39,10 @@ public:
      */
     Scope(bool anonymous)
         : mIsAnonymous(anonymous)
+        , mSize(0)
+        , mCapacity(0)
+        , mTable(nullptr)
+        , mFilter(0)
     {
     }
 
@@ -36,10 +51,16 @@ public:
      */
     ~Scope()
     {
-        for (std::map<std::string, Link<NamedEntity>*>::iterator it
-            = mMembers.begin();
-            it != mMembers.end(); it++) {
-            delete it->second;
+        if (mTable == nullptr) {
+            for (unsigned i = 0; i < mSize; i++) {
+                delete mInline[i].link;
+            }
+        } else {
+            for (unsigned i = 0; i < mCapacity; i++) {
+                delete mTable[i].link;
+            }
+
+            delete[] mTable;
         }
     }
 
@@ -56,15 +77,18 @@ public:
      *
      * @see SymbolTable::lookup()
      */
-    NamedEntity* lookup(const std::string& name) const
+    NamedEntity* lookup(Identifier name) const
     {
-        std::map<std::string, Link<NamedEntity>*>::const_iterator it
-            = mMembers.find(name);
+        if ((mFilter & filterBit(name)) == 0) {
+            return nullptr;
+        }
+
+        const Member* member = find(name);
 
-        if (it == mMembers.end()) {
+        if (member == nullptr) {
             return nullptr;
         } else {
-            return it->second->target();
+            return member->link->target();
         }
     }
 
@@ -75,7 +99,7 @@ public:
      */
     bool add(NamedEntity* entity)
     {
-        NamedEntity* lookupResult = lookup(entity->name().str());
+        NamedEntity* lookupResult = lookup(entity->name().first());
 
         if (lookupResult != nullptr) {
             FunctionGroup* group;
@@ -114,7 +138,7 @@ public:
                 link->setTarget(entity);
             }
 
-            mMembers[entity->name().str()] = link;
+            insert(entity->name().first(), link);
             return true;
         }
     }
@@ -126,24 +150,194 @@ public:
      */
     void remove(NamedEntity* entity)
     {
-        std::map<std::string, Link<NamedEntity>*>::iterator it
-            = mMembers.find(entity->name().str());
+        Identifier name = entity->name().first();
+
+        if (mTable == nullptr) {
+            for (unsigned i = 0; i < mSize; i++) {
+                if (mInline[i].name == name) {
+                    delete mInline[i].link;
+                    mInline[i] = mInline[--mSize];
+                    return;
+                }
+            }
+        } else {
+            Member* member = const_cast<Member*>(find(name));
 
-        if (it != mMembers.end()) {
-            delete it->second;
-            mMembers.erase(it);
+            if (member != nullptr) {
+                delete member->link;
+                member->link = nullptr;
+                closeGap(member - mTable);
+                mSize--;
+            }
         }
     }
 
 private:
+    /**
+     * A scope member. In the hash table, empty slots have a null link.
+     */
+    struct Member {
+        Identifier name;
+        Link<NamedEntity>* link;
+    };
+
+    /**
+     * The number of members stored inside the Scope before a hash table
+     * is allocated.
+     */
+    static const unsigned INLINE_MEMBERS = 8;
+
     bool mIsAnonymous;
-    std::map<std::string, Link<NamedEntity>*> mMembers;
+    unsigned mSize;
+    unsigned mCapacity;
+    Member* mTable;
+    uint64_t mFilter;
+    Member mInline[INLINE_MEMBERS];
+
+    /**
+     * Returns the bit representing the passed name in the scope's member
+     * filter. Removing members does not clear their bits, so a set bit
+     * only means that the scope might contain a member with the name.
+     */
+    static uint64_t filterBit(Identifier name)
+    {
+        return uint64_t(1) << (name.id() & 63);
+    }
+
+    /**
+     * Returns the hash table slot at which the search for a member with
+     * the passed name starts.
+     */
+    unsigned home(Identifier name) const
+    {
+        /*
+         * Identifiers are numbered consecutively, so scatter them with
+         * a multiplicative (Fibonacci) hash.
+         */
+        uint32_t h = name.id() * 2654435769u;
+        return (h ^ (h >> 16)) & (mCapacity - 1);
+    }
+
+    /**
+     * Returns the member with the passed name, or null if there is none.
+     */
+    const Member* find(Identifier name) const
+    {
+        if (mTable == nullptr) {
+            for (unsigned i = 0; i < mSize; i++) {
+                if (mInline[i].name == name) {
+                    return &mInline[i];
+                }
+            }
+
+            return nullptr;
+        }
+
+        for (unsigned i = home(name);; i = (i + 1) & (mCapacity - 1)) {
+            if (mTable[i].link == nullptr) {
+                return nullptr;
+            } else if (mTable[i].name == name) {
+                return &mTable[i];
+            }
+        }
+    }
+
+    /**
+     * Adds a member which is not yet in the scope.
+     */
+    void insert(Identifier name, Link<NamedEntity>* link)
+    {
+        mFilter |= filterBit(name);
+
+        if (mTable == nullptr) {
+            if (mSize < INLINE_MEMBERS) {
+                mInline[mSize].name = name;
+                mInline[mSize].link = link;
+                mSize++;
+                return;
+            }
+
+            rehash(INLINE_MEMBERS * 4);
+        } else if ((mSize + 1) * 4 > mCapacity * 3) {
+            rehash(mCapacity * 2);
+        }
+
+        place(name, link);
+        mSize++;
+    }
+
+    /**
+     * Stores a member in the first free hash table slot on its probe
+     * sequence.
+     */
+    void place(Identifier name, Link<NamedEntity>* link)
+    {
+        unsigned i = home(name);
+
+        while (mTable[i].link != nullptr) {
+            i = (i + 1) & (mCapacity - 1);
+        }
+
+        mTable[i].name = name;
+        mTable[i].link = link;
+    }
+
+    /**
+     * Moves all members into a new hash table with the passed capacity,
+     * which must be a power of two.
+     */
+    void rehash(unsigned capacity)
+    {
+        Member* oldMembers = (mTable == nullptr) ? mInline : mTable;
+        unsigned oldSlots = (mTable == nullptr) ? mSize : mCapacity;
+        Member* oldTable = mTable;
+
+        mTable = new Member[capacity]();
+        mCapacity = capacity;
+
+        for (unsigned i = 0; i < oldSlots; i++) {
+            if (oldMembers[i].link != nullptr) {
+                place(oldMembers[i].name, oldMembers[i].link);
+            }
+        }
+
+        delete[] oldTable;
+    }
+
+    /**
+     * Refills the hash table slot at the passed index, which has just been
+     * emptied, by shifting back members whose probe sequence passes it.
+     * This keeps all members reachable without needing tombstones.
+     */
+    void closeGap(unsigned gap)
+    {
+        unsigned mask = mCapacity - 1;
+
+        for (unsigned i = (gap + 1) & mask; mTable[i].link != nullptr;
+            i = (i + 1) & mask) {
+            unsigned h = home(mTable[i].name);
+
+            /*
+             * The member at i may only be moved to the gap if its home
+             * slot does not lie cyclically within (gap, i].
+             */
+            bool reachable
+                = (gap <= i) ? (gap < h && h <= i) : (gap < h || h <= i);
+
+            if (!reachable) {
+                mTable[gap] = mTable[i];
+                mTable[i].link = nullptr;
+                gap = i;
+            }
+        }
+    }
 };
 
 ///// SymbolTable
 /////////////////////////////////////////////////////////////////
 
 std::map<Module*, SymbolTable*> SymbolTable::sInstances;
+std::mutex SymbolTable::sInstancesMutex;
 
 SymbolTable::SymbolTable()
 {
@@ -165,6 +359,8 @@ SymbolTable::~SymbolTable()
         delete (*it).second;
     }
 
+    std::lock_guard<std::mutex> lock(sInstancesMutex);
+
     for (std::map<Module*, SymbolTable*>::iterator it = sInstances.begin();
         it != sInstances.end(); it++) {
         if (it->second == this) {
@@ -175,6 +371,7 @@ SymbolTable::~SymbolTable()
 
 SymbolTable* SymbolTable::get(Module* module, bool create)
 {
+    std::lock_guard<std::mutex> lock(sInstancesMutex);
     SymbolTable* table = sInstances[module];
 
     if (table == nullptr && create) {
@@ -229,10 +426,11 @@ void SymbolTable::remove(NamedEntity* entity)
 NamedEntity* SymbolTable::lookup(const Name& identifier) const
 {
     assert(identifier.isSimple());
+    Identifier name = identifier.first();
 
-    for (std::list<Scope*>::const_reverse_iterator it = mScopeStack.rbegin();
+    for (std::vector<Scope*>::const_reverse_iterator it = mScopeStack.rbegin();
         it != mScopeStack.rend(); it++) {
-        NamedEntity* lookupResult = (*it)->lookup(identifier.str());
+        NamedEntity* lookupResult = (*it)->lookup(name);
 
         if (lookupResult != nullptr) {
             return lookupResult;
@@ -253,7 +451,7 @@ NamedEntity* SymbolTable::lookup(
     if (it == mEntityScopes.end()) {
         return nullptr;
     } else {
-        return it->second->lookup(identifier.str());
+        return it->second->lookup(identifier.first());
     }
 }
 
@@ -13,9 +13,10 @@
 #include <ast/Name.h>
 #include <ast/NamedEntity.h>
 #include <ast/NodeList.h>
-#include <list>
 #include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 using namespace soyac::ast;
 
@@ -124,9 +125,10 @@ public:
 
 private:
     static std::map<Module*, SymbolTable*> sInstances;
+    static std::mutex sInstancesMutex;
 
     std::map<NamedEntity*, Scope*> mEntityScopes;
-    std::list<Scope*> mScopeStack;
+    std::vector<Scope*> mScopeStack;
 
     /**
      * SymbolTable constructor.
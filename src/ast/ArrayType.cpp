@@ -23,6 +23,8 @@ std::map<Type*, ArrayType*> ArrayType::mInstances;
 
 ArrayType* ArrayType::get(Type* elementType)
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     ArrayType* ret = mInstances[elementType];
 
     if (ret == nullptr) {
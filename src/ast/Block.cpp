@@ -28,8 +28,7 @@ Block::statements_iterator Block::statements_end() const
 
 void Block::addStatement(Statement* s) { mStatements.push_back(s); }
 
-boost::signals2::signal<void(Statement*, Statement*)>&
-Block::statementListChanged()
+Signal<void(Statement*, Statement*)>& Block::statementListChanged()
 {
     return mStatements.changed();
 }
@@ -83,8 +83,7 @@ public:
      *
      * @see  NodeList::elementChanged()
      */
-    boost::signals2::signal<void(Statement*, Statement*)>&
-    statementListChanged();
+    Signal<void(Statement*, Statement*)>& statementListChanged();
 
 private:
     NodeList<Statement> mStatements;
@@ -27,6 +27,8 @@ BooleanType::BooleanType()
 
 BooleanType* BooleanType::get()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (sInstance == nullptr) {
         sInstance = new BooleanType;
         sInstance->ref();
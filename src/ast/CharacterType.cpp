@@ -29,6 +29,8 @@ CharacterType::CharacterType()
 
 CharacterType* CharacterType::get()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (sInstance == nullptr) {
         sInstance = new CharacterType;
         sInstance->ref();
@@ -36,7 +36,7 @@ void DeclarationBlock::addDeclaration(DeclarationStatement* decl)
     mDeclarations.push_back(decl);
 }
 
-boost::signals2::signal<void(DeclarationStatement*, DeclarationStatement*)>&
+Signal<void(DeclarationStatement*, DeclarationStatement*)>&
 DeclarationBlock::declarationListChanged()
 {
     return mDeclarations.changed();
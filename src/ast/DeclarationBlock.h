@@ -88,7 +88,7 @@ public:
      *
      * @see  NodeList::elementChanged()
      */
-    boost::signals2::signal<void(DeclarationStatement*, DeclarationStatement*)>&
+    Signal<void(DeclarationStatement*, DeclarationStatement*)>&
     declarationListChanged();
 
 private:
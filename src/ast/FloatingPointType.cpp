@@ -21,6 +21,8 @@ FloatingPointType* FloatingPointType::sDouble = nullptr;
 
 FloatingPointType* FloatingPointType::getFloat()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (sFloat == nullptr) {
         sFloat = new FloatingPointType(false);
         sFloat->ref();
@@ -31,6 +33,8 @@ FloatingPointType* FloatingPointType::getFloat()
 
 FloatingPointType* FloatingPointType::getDouble()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (sDouble == nullptr) {
         sDouble = new FloatingPointType(true);
         sDouble->ref();
@@ -20,6 +20,8 @@ std::map<std::pair<Type*, NodeList<Type>*>, FunctionType*,
 FunctionType* FunctionType::_get(
     Type* returnType, NodeList<Type>* parameterTypes)
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     std::pair<Type*, NodeList<Type>*> signature(returnType, parameterTypes);
     FunctionType* ret = sInstances[signature];
 
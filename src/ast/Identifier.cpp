@@ -0,0 +1,114 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include "Identifier.h"
+
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <unordered_map>
+
+namespace soyac {
+namespace ast {
+
+namespace {
+
+/*
+ * The interned strings are kept in fixed-size chunks which are never moved
+ * or freed, so that Identifier::str() can read them without taking the
+ * pool's lock: a handle is only ever handed out after its string has been
+ * stored, and the chunk pointers are published with release semantics.
+ */
+const std::size_t CHUNK_BITS = 12;
+const std::size_t CHUNK_SIZE = std::size_t(1) << CHUNK_BITS;
+const std::size_t MAX_CHUNKS = std::size_t(1) << 16;
+
+struct IdentifierPool {
+    std::mutex mutex;
+    std::unordered_map<std::string_view, uint32_t> handles;
+    std::atomic<std::string*> chunks[MAX_CHUNKS];
+    std::atomic<uint32_t> count;
+
+    IdentifierPool()
+        : count(0)
+    {
+        for (std::size_t i = 0; i < MAX_CHUNKS; i++) {
+            chunks[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        intern(std::string_view());
+    }
+
+    uint32_t intern(std::string_view str)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = handles.find(str);
+
+        if (it != handles.end()) {
+            return it->second;
+        }
+
+        uint32_t id = count.load(std::memory_order_relaxed);
+        std::size_t chunkIndex = id >> CHUNK_BITS;
+        assert(chunkIndex < MAX_CHUNKS);
+
+        std::string* chunk = chunks[chunkIndex].load(std::memory_order_relaxed);
+
+        if (chunk == nullptr) {
+            chunk = new std::string[CHUNK_SIZE];
+            chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+
+        std::string& stored = chunk[id & (CHUNK_SIZE - 1)];
+        stored.assign(str.data(), str.size());
+        handles.emplace(std::string_view(stored), id);
+        count.store(id + 1, std::memory_order_release);
+
+        return id;
+    }
+
+    const std::string& str(uint32_t id)
+    {
+        std::string* chunk
+            = chunks[id >> CHUNK_BITS].load(std::memory_order_acquire);
+        return chunk[id & (CHUNK_SIZE - 1)];
+    }
+};
+
+IdentifierPool& pool()
+{
+    /*
+     * Created on first use and intentionally never destroyed, so that
+     * identifiers stay usable during static destruction.
+     */
+    static IdentifierPool* sPool = new IdentifierPool;
+    return *sPool;
+}
+
+} // namespace
+
+Identifier::Identifier(std::string_view str)
+    : mId(pool().intern(str))
+{
+}
+
+const std::string& Identifier::str() const { return pool().str(mId); }
+
+std::size_t Identifier::countInterned()
+{
+    return pool().count.load(std::memory_order_acquire);
+}
+
+std::ostream& operator<<(std::ostream& s, Identifier identifier)
+{
+    return s << identifier.str();
+}
+
+} // namespace ast
+} // namespace soyac
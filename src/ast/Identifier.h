@@ -0,0 +1,136 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_IDENTIFIER_H_
+#define SOYA_IDENTIFIER_H_
+
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+
+namespace soyac {
+namespace ast {
+
+/**
+ * Represents an interned identifier.
+ *
+ * All identifiers are stored once in a global, thread-safe identifier pool;
+ * an Identifier is merely a 32-bit handle to an entry of that pool. Thus,
+ * Identifiers can be copied, compared and hashed as cheaply as integers,
+ * and equal identifiers always have equal handles.
+ *
+ * Identifier is trivially default-constructible so that it can be used as
+ * a member of the parser's semantic value union. Like a built-in integer,
+ * a default-initialized Identifier has an indeterminate value; a
+ * value-initialized one (@c Identifier{}) is the empty identifier.
+ */
+class Identifier {
+public:
+    /**
+     * Creates an Identifier without interning anything.
+     */
+    Identifier() = default;
+
+    /**
+     * Creates an Identifier for the passed string, adding the string to
+     * the identifier pool if it is not interned yet.
+     *
+     * @param str  The identifier's string.
+     */
+    explicit Identifier(std::string_view str);
+
+    /**
+     * Creates an Identifier for the passed string (as null-terminated
+     * character array).
+     *
+     * @param str  The identifier's string.
+     */
+    explicit Identifier(const char* str)
+        : Identifier(std::string_view(str))
+    {
+    }
+
+    /**
+     * Creates an Identifier for the passed string.
+     *
+     * @param str  The identifier's string.
+     */
+    explicit Identifier(const std::string& str)
+        : Identifier(std::string_view(str))
+    {
+    }
+
+    /**
+     * Returns the identifier's handle, which is unique for every interned
+     * string. The empty identifier has the handle 0.
+     *
+     * @return  The identifier's handle.
+     */
+    uint32_t id() const { return mId; }
+
+    /**
+     * Returns the identifier's string. The returned reference stays valid
+     * for the lifetime of the program.
+     *
+     * @return  The identifier as string.
+     */
+    const std::string& str() const;
+
+    /**
+     * Returns @c true if the identifier is the empty identifier.
+     *
+     * @return  @c true if the identifier is empty; @c false otherwise.
+     */
+    bool empty() const { return mId == 0; }
+
+    /**
+     * Returns the number of identifiers interned so far (including the
+     * empty identifier).
+     *
+     * @return  The number of interned identifiers.
+     */
+    static std::size_t countInterned();
+
+    bool operator==(Identifier other) const { return mId == other.mId; }
+    bool operator!=(Identifier other) const { return mId != other.mId; }
+
+    /**
+     * Orders identifiers by handle (which is the order in which they were
+     * interned), not alphabetically.
+     */
+    bool operator<(Identifier other) const { return mId < other.mId; }
+
+    bool operator==(std::string_view other) const { return str() == other; }
+    bool operator!=(std::string_view other) const { return str() != other; }
+
+private:
+    uint32_t mId;
+};
+
+/**
+ * Writes the passed identifier's string into an output stream.
+ *
+ * @param s           The stream to write to.
+ * @param identifier  The Identifier to write.
+ */
+std::ostream& operator<<(std::ostream& s, Identifier identifier);
+
+} // namespace ast
+} // namespace soyac
+
+template <> struct std::hash<soyac::ast::Identifier> {
+    std::size_t operator()(soyac::ast::Identifier identifier) const
+    {
+        return identifier.id();
+    }
+};
+
+#endif
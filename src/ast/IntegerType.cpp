@@ -44,6 +44,8 @@ void IntegerType::initialize()
 
 IntegerType* IntegerType::get(int size, bool isSigned)
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     /*
      * We need to have all static members properly initialized before
      * creating any IntegerType, so do that if we haven't already done
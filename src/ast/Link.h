@@ -9,48 +9,171 @@
 #ifndef SOYA_LINK_H_
 #define SOYA_LINK_H_
 
-#include <boost/signals2/connection.hpp>
-#include <boost/signals2/signal.hpp>
-
 #include "Node.h"
+#include "Signal.h"
 
 namespace soyac::ast {
 
-namespace signals = boost::signals2;
+/**
+ * The non-template part of Link. Each LinkBase is an entry in its target
+ * node's intrusive use list (see Node::replaceWith()), which allows a node
+ * to find and retarget all Links pointing to it without any per-edge
+ * allocation or signal connection.
+ */
+class LinkBase {
+public:
+    LinkBase(const LinkBase&) = delete;
+    LinkBase& operator=(const LinkBase&) = delete;
+
+    /**
+     * Returns the link's target as a Node.
+     *
+     * @return  The link's target.
+     */
+    Node* targetNode() const { return mTargetNode; }
+
+protected:
+    /**
+     * Creates a LinkBase without target.
+     */
+    LinkBase()
+        : mTargetNode(nullptr)
+        , mNextUse(nullptr)
+        , mPrevUse(nullptr)
+    {
+    }
+
+    /**
+     * LinkBase destructor.
+     */
+    ~LinkBase() { }
+
+    /**
+     * Moves the link from its current target's use list into the passed
+     * node's use list (if the node is not null) and makes the node the
+     * link's target. Reference counts are not touched.
+     *
+     * @param target  The new target, or null.
+     */
+    void setTargetNode(Node* target)
+    {
+        Node::UsesLock lock(mTargetNode, target);
+        moveTo(target);
+    }
+
+    /**
+     * Makes the link take over the passed link's place in its target's use
+     * list, together with the reference the passed link holds on the
+     * target. The passed link is left without a target. This allows links
+     * to be moved around in memory, for instance when stored in a vector.
+     *
+     * The link must not have a target itself when this is called.
+     *
+     * @param other  The link to take over.
+     */
+    void takeOver(LinkBase& other)
+    {
+        Node::UsesLock lock(other.mTargetNode);
+
+        mTargetNode = other.mTargetNode;
+        mNextUse = other.mNextUse;
+        mPrevUse = other.mPrevUse;
+
+        if (mTargetNode != nullptr) {
+            *mPrevUse = this;
+
+            if (mNextUse != nullptr) {
+                mNextUse->mPrevUse = &mNextUse;
+            }
+        }
+
+        other.mTargetNode = nullptr;
+        other.mNextUse = nullptr;
+        other.mPrevUse = nullptr;
+    }
+
+    /**
+     * Called by Node::replaceWith() on every Link pointing to the replaced
+     * node, after the link has been moved to the replacing node's use list
+     * and given a reference to it. Implementations must notify the link's
+     * owner of the change. The reference the link held on the replaced
+     * node is released by replaceWith() afterwards.
+     *
+     * @param oldTarget  The replaced node.
+     * @param target     The replacing node, or null.
+     */
+    virtual void targetReplaced(Node* oldTarget, Node* target) = 0;
+
+private:
+    friend class Node;
+
+    Node* mTargetNode;
+    LinkBase* mNextUse;
+    LinkBase** mPrevUse;
+
+    /**
+     * Does the work of setTargetNode() without locking. The caller must
+     * hold the UsesLock of the link's current target and of the passed
+     * node.
+     *
+     * @param target  The new target, or null.
+     */
+    void moveTo(Node* target)
+    {
+        if (mTargetNode != nullptr) {
+            *mPrevUse = mNextUse;
+
+            if (mNextUse != nullptr) {
+                mNextUse->mPrevUse = mPrevUse;
+            }
+        }
+
+        mTargetNode = target;
+
+        if (target != nullptr) {
+            mNextUse = target->mUses;
+            mPrevUse = &target->mUses;
+
+            if (mNextUse != nullptr) {
+                mNextUse->mPrevUse = &mNextUse;
+            }
+
+            target->mUses = this;
+        }
+    }
+};
 
 /**
  * A smart pointer class that represents a reference to an abstract syntax
  * node. Each Link automatically manages the reference count of the Node
- * instance it refers to (the "target"). Additionally, Link instances listen to
- * their target node's "replaceRequested" signal (see Node::replaceRequested())
- * and adjust their targets accordingly when notified.
+ * instance it refers to (the "target"). Additionally, Link instances are
+ * registered in their target node's use list and adjust their targets
+ * accordingly when the target is replaced (see Node::replaceWith()).
  *
  * The accepted target node type of a Link may be constrained through its
  * template parameter.
  *
  * @tparam T  The target node type.
  */
-template <class T> class Link {
+template <class T> class Link : public LinkBase {
 public:
     /**
      * Creates a Link.
      *
      * @param target  The link's target.
      */
-    Link(T* target = nullptr)
-        : mTarget(nullptr)
-    {
-        setTarget(target);
-    }
+    Link(T* target = nullptr) { setTarget(target); }
 
     /**
      * Link destructor.
      */
-    ~Link()
+    virtual ~Link()
     {
-        if (mTarget != nullptr) {
-            mConnection.disconnect();
-            ((Node*)mTarget)->unref();
+        Node* target = targetNode();
+
+        if (target != nullptr) {
+            setTargetNode(nullptr);
+            target->unref();
         }
     }
 
@@ -58,9 +181,9 @@ public:
      * Copy constructor.
      */
     Link(const Link<T>& other)
-        : mTarget(nullptr)
+        : LinkBase()
     {
-        setTarget(other.mTarget);
+        setTarget(other.target());
     }
 
     /**
@@ -68,7 +191,7 @@ public:
      */
     Link<T>& operator=(const Link<T>& other)
     {
-        setTarget(other.mTarget);
+        setTarget(other.target());
         return *this;
     }
 
@@ -77,7 +200,7 @@ public:
      *
      * @return  The link's target.
      */
-    T* target() const { return mTarget; }
+    T* target() const { return (T*)targetNode(); }
 
     /**
      * Sets the link's target. This triggers the Link's "targetChanged"
@@ -88,23 +211,15 @@ public:
      */
     void setTarget(T* target)
     {
-        if (target != mTarget) {
-            mConnection.disconnect();
+        T* oldTarget = this->target();
 
+        if (target != oldTarget) {
             if (target) {
                 ((Node*)target)->ref();
-
-                mConnection = ((Node*)target)
-                                  ->replaceRequested()
-                                  .connect([this](auto old_, auto new_) {
-                                      onReplaceRequested(old_, new_);
-                                  });
             }
 
-            T* oldTarget = mTarget;
-            mTarget = target;
-
-            targetChanged()(oldTarget, mTarget);
+            setTargetNode((Node*)target);
+            targetChanged()(oldTarget, target);
 
             if (oldTarget) {
                 ((Node*)oldTarget)->unref();
@@ -123,24 +238,16 @@ public:
      *
      * @return  The "targetChanged" signal.
      */
-    typename signals::signal<void(T*, T*)>& targetChanged()
+    Signal<void(T*, T*)>& targetChanged() { return mTargetChanged; }
+
+protected:
+    virtual void targetReplaced(Node* oldTarget, Node* target)
     {
-        return mTargetChanged;
+        targetChanged()((T*)oldTarget, (T*)target);
     }
 
 private:
-    T* mTarget;
-    signals::signal<void(T*, T*)> mTargetChanged;
-    signals::connection mConnection;
-
-    /**
-     * Handler for the target node's "replaceRequested" signal
-     * (see Node::replaceRequested()).
-     */
-    void onReplaceRequested(Node* oldTarget, Node* newTarget)
-    {
-        setTarget((T*)newTarget);
-    }
+    Signal<void(T*, T*)> mTargetChanged;
 };
 
 } // namespace soyac::ast
@@ -13,7 +13,8 @@
 namespace soyac {
 namespace ast {
 
-std::map<std::string, Module*> Module::sInstances;
+std::unordered_map<Name, Module*> Module::sInstances;
+std::mutex Module::sInstancesMutex;
 
 Module::Module(const Name& name)
     : NamedEntity(name)
@@ -31,10 +32,11 @@ Module::Module(const Name& name)
 
 Module* Module::get(const Name& name, bool create)
 {
-    Module* m = sInstances[name.str()];
+    std::lock_guard<std::mutex> lock(sInstancesMutex);
+    Module* m = sInstances[name];
 
     if (m == nullptr && create == true) {
-        m = sInstances[name.str()] = new Module(name);
+        m = sInstances[name] = new Module(name);
         m->ref();
     }
 
@@ -59,6 +61,29 @@ void Module::addImport(Import* imp) { mImports.push_back(imp); }
 
 Block* Module::body() { return &mBody; }
 
+void Module::adoptArena(NodeArena* arena)
+{
+    mArenas.push_back(std::unique_ptr<NodeArena>(arena));
+}
+
+std::size_t Module::arenaBytesUsed() const
+{
+    std::size_t ret = 0;
+
+    for (const std::unique_ptr<NodeArena>& arena : mArenas) {
+        ret += arena->bytesUsed();
+    }
+
+    return ret;
+}
+
+void Module::setShared(bool shared)
+{
+    for (const std::unique_ptr<NodeArena>& arena : mArenas) {
+        arena->setShared(shared);
+    }
+}
+
 void Module::onBodyChanged(Statement* oldStmt, Statement* newStmt)
 {
     /*
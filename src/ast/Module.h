@@ -12,8 +12,13 @@
 #include "Block.h"
 #include "Import.h"
 #include "NamedEntity.h"
-#include <map>
+#include "NodeArena.h"
+#include <cstddef>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace soyac {
 namespace ast {
@@ -91,8 +96,41 @@ public:
      */
     Block* body();
 
+    /**
+     * Makes the module the owner of the passed NodeArena, which holds
+     * nodes parsed from one of the module's source files. The arena is
+     * destroyed together with the module, after the module's own nodes
+     * have been released.
+     *
+     * @param arena  The arena to take ownership of.
+     */
+    void adoptArena(NodeArena* arena);
+
+    /**
+     * Returns the number of bytes allocated from the arenas owned by the
+     * module.
+     *
+     * @return  The module's arena memory usage.
+     */
+    std::size_t arenaBytesUsed() const;
+
+    /**
+     * Sets whether the nodes parsed into the module's arenas may be linked
+     * to by several threads at once (see NodeArena::setShared()). This is
+     * only not the case for a module which no other module imports.
+     *
+     * @param shared  Whether the module's nodes are shared.
+     */
+    void setShared(bool shared);
+
 private:
-    static std::map<std::string, Module*> sInstances;
+    static std::unordered_map<Name, Module*> sInstances;
+    static std::mutex sInstancesMutex;
+
+    /*
+     * Declared before the other members so that it is destroyed last.
+     */
+    std::vector<std::unique_ptr<NodeArena>> mArenas;
     NodeList<Import> mImports;
     Block mBody;
 
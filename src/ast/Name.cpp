@@ -11,14 +11,16 @@
 namespace soyac {
 namespace ast {
 
+Name::Name(Identifier identifier) { mIdentifiers.push_back(identifier); }
+
 Name::Name(const std::string& identifier)
 {
-    mIdentifiers.push_back(identifier);
+    mIdentifiers.push_back(Identifier(identifier));
 }
 
 Name::Name(const char* identifier)
 {
-    mIdentifiers.push_back(std::string(identifier));
+    mIdentifiers.push_back(Identifier(identifier));
 }
 
 Name::identifiers_iterator Name::identifiers_begin() const
@@ -31,9 +33,9 @@ Name::identifiers_iterator Name::identifiers_end() const
     return mIdentifiers.end();
 }
 
-std::string Name::first() const { return mIdentifiers.front(); }
+Identifier Name::first() const { return mIdentifiers.front(); }
 
-std::string Name::last() const { return mIdentifiers.back(); }
+Identifier Name::last() const { return mIdentifiers.back(); }
 
 size_t Name::countIdentifiers() const { return mIdentifiers.size(); }
 
@@ -41,6 +43,10 @@ bool Name::isSimple() const { return countIdentifiers() == 1; }
 
 std::string Name::str() const
 {
+    if (isSimple()) {
+        return first().str();
+    }
+
     std::stringstream s;
     s << *this;
     return s.str();
@@ -48,27 +54,22 @@ std::string Name::str() const
 
 bool Name::operator==(const Name& other) const
 {
-    if (countIdentifiers() != other.countIdentifiers()) {
-        return false;
-    }
+    return mIdentifiers == other.mIdentifiers;
+}
 
-    Name::identifiers_iterator it1 = identifiers_begin();
-    Name::identifiers_iterator it2 = other.identifiers_begin();
+bool Name::operator!=(const Name& other) const { return !(*this == other); }
 
-    do {
-        if (*it1 != *it2) {
-            return false;
-        }
+std::size_t Name::hash() const
+{
+    std::size_t ret = 0;
 
-        it1++;
-        it2++;
-    } while (it1 != identifiers_end());
+    for (Identifier identifier : mIdentifiers) {
+        ret = (ret ^ identifier.id()) * 0x100000001b3ULL;
+    }
 
-    return true;
+    return ret;
 }
 
-bool Name::operator!=(const Name& other) const { return !(*this == other); }
-
 Name Name::operator+(const Name& other) const
 {
     Name ret(identifiers_begin(), identifiers_end());
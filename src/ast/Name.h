@@ -9,12 +9,14 @@
 #ifndef SOYA_NAME_H_
 #define SOYA_NAME_H_
 
+#include "Identifier.h"
 #include "Node.h"
 #include <cassert>
+#include <cstddef>
 #include <iostream>
+#include <llvm/ADT/SmallVector.h>
 #include <sstream>
 #include <string>
-#include <vector>
 
 namespace soyac {
 namespace ast {
@@ -22,11 +24,22 @@ namespace ast {
 /**
  * Represents a name.
  *
+ * A Name is stored as a small vector of interned Identifier handles, so
+ * copying, comparing and hashing Names does not touch any strings.
+ *
  * (See the Soya Language Reference, Chapter 7.)
  */
 class Name {
 public:
-    typedef std::vector<std::string>::const_iterator identifiers_iterator;
+    typedef llvm::SmallVectorImpl<Identifier>::const_iterator
+        identifiers_iterator;
+
+    /**
+     * Creates a simple Name consisting of the passed single identifier.
+     *
+     * @param identifier  The identifier.
+     */
+    Name(Identifier identifier);
 
     /**
      * Creates a simple Name consisting of the passed single identifier.
@@ -45,8 +58,8 @@ public:
 
     /**
      * Creates a Name consisting of the identifiers pointed to by the passed
-     * iterator range. The resulting Name must consist of at least one
-     * identifier.
+     * iterator range, which may either be Identifiers or strings. The
+     * resulting Name must consist of at least one identifier.
      *
      * @param first  The start iterator.
      * @param last   The end iterator.
@@ -54,7 +67,7 @@ public:
     template <class InputIterator> Name(InputIterator start, InputIterator end)
     {
         for (InputIterator it = start; it != end; it++) {
-            mIdentifiers.push_back(*it);
+            mIdentifiers.push_back(Identifier(*it));
         }
 
         assert(countIdentifiers() > 0);
@@ -79,14 +92,14 @@ public:
      *
      * @return  The name's first identifier.
      */
-    std::string first() const;
+    Identifier first() const;
 
     /**
      * Returns the last identifier of the name.
      *
      * @return  The name's last identifier.
      */
-    std::string last() const;
+    Identifier last() const;
 
     /**
      * Returns the number of identifiers of which the name consists.
@@ -131,6 +144,14 @@ public:
      */
     bool operator!=(const Name& other) const;
 
+    /**
+     * Returns a hash value for the name. Equal names have equal hash
+     * values.
+     *
+     * @return  The name's hash value.
+     */
+    std::size_t hash() const;
+
     /**
      * Creates and returns a Name which consists of the name's identifiers
      * and, additionally, the names of the passed other Name instance. For
@@ -143,7 +164,7 @@ public:
     Name operator+(const Name& other) const;
 
 private:
-    std::vector<std::string> mIdentifiers;
+    llvm::SmallVector<Identifier, 2> mIdentifiers;
 };
 
 /**
@@ -157,4 +178,11 @@ std::ostream& operator<<(std::ostream& s, const Name& name);
 } // namespace ast
 } // namespace soyac
 
+template <> struct std::hash<soyac::ast::Name> {
+    std::size_t operator()(const soyac::ast::Name& name) const
+    {
+        return name.hash();
+    }
+};
+
 #endif
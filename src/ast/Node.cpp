@@ -9,76 +9,287 @@
 #include "Node.h"
 #include "Link.h"
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <new>
+#include <utility>
+#include <vector>
 
 namespace soyac {
 namespace ast {
 
-using boost::signals2::signal;
+/*
+ * Every node is preceded by a header that records the NodeArena it was
+ * allocated in (or null for heap-allocated nodes), so that operator delete
+ * knows whether there is anything to release. The header is as large as
+ * the maximum alignment to keep the node itself suitably aligned.
+ */
+static const std::size_t NODE_HEADER_SIZE = alignof(std::max_align_t);
+
+/*
+ * The nodes allocated in an arena by the current thread whose constructors
+ * have not run yet. A node's constructor looks up its address here to find
+ * out whether the node lives in an arena (and thus has the arena in its
+ * header) rather than on the heap or the stack. Several nodes may be
+ * pending at once, as the arguments of a node's constructor are evaluated
+ * after the node is allocated and may allocate nodes themselves.
+ */
+static thread_local std::vector<const void*> sPendingArenaNodes;
+
+/**
+ * Removes the passed node from the pending arena nodes.
+ *
+ * @param node  The node.
+ * @return      @c true if the node was pending, @c false otherwise.
+ */
+static bool take_pending_arena_node(const void* node)
+{
+    for (std::size_t i = sPendingArenaNodes.size(); i > 0; i--) {
+        if (sPendingArenaNodes[i - 1] == node) {
+            sPendingArenaNodes[i - 1] = sPendingArenaNodes.back();
+            sPendingArenaNodes.pop_back();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * The use lists of shared nodes are guarded by a fixed number of mutexes,
+ * each on a cache line of its own, so that threads linking to different
+ * nodes rarely wait for each other.
+ */
+static const std::size_t USES_MUTEX_COUNT = 64;
+
+struct alignas(64) UsesMutex {
+    std::mutex mutex;
+};
+
+static UsesMutex sUsesMutexes[USES_MUTEX_COUNT];
+
+bool Node::sThreadSafe = false;
 
 Node::Node()
     : mRefCount(0)
+    , mInArena(take_pending_arena_node(this))
+    , mUses(nullptr)
 {
 }
 
 Node::~Node()
 {
-    if (mRefCount > 0) {
-        mRefCount = -1;
+    if (mRefCount.load(std::memory_order_relaxed) > 0) {
+        mRefCount.store(-1, std::memory_order_relaxed);
         _replaceWith(nullptr);
     }
 }
 
+/*
+ * A negative reference count marks a node which is being destroyed by the
+ * thread holding its last reference, so no other thread can be changing
+ * the count at the same time.
+ */
 void Node::ref()
 {
-    if (mRefCount < 0) {
+    if (mRefCount.load(std::memory_order_relaxed) < 0) {
         return;
-    } else {
-        mRefCount++;
     }
+
+    mRefCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 void Node::unref()
 {
-    if (mRefCount < 0) {
+    if (mRefCount.load(std::memory_order_relaxed) < 0) {
         return;
     }
 
-    mRefCount--;
-
-    if (mRefCount <= 0) {
+    if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) <= 1) {
         delete this;
     }
 }
 
+bool Node::isShared() const
+{
+    if (!mInArena) {
+        return true;
+    }
+
+    const char* block = (const char*)this - NODE_HEADER_SIZE;
+    return (*(NodeArena* const*)block)->isShared();
+}
+
+void Node::setThreadSafe(bool threadSafe) { sThreadSafe = threadSafe; }
+
+std::mutex* Node::usesMutex(const Node* node)
+{
+    if (node == nullptr || !node->isShared()) {
+        return nullptr;
+    }
+
+    std::uintptr_t address = (std::uintptr_t)node;
+    return &sUsesMutexes[(address / NODE_HEADER_SIZE) % USES_MUTEX_COUNT]
+                .mutex;
+}
+
+void Node::UsesLock::lock(const Node* node1, const Node* node2)
+{
+    std::mutex* mutex1 = usesMutex(node1);
+    std::mutex* mutex2 = usesMutex(node2);
+
+    /*
+     * Always lock the mutex with the lower address first, so that two
+     * threads locking the same pair of mutexes cannot deadlock.
+     */
+    if (mutex1 == mutex2) {
+        mutex2 = nullptr;
+    }
+
+    if (mutex1 == nullptr
+        || (mutex2 != nullptr && std::less<std::mutex*>()(mutex2, mutex1))) {
+        std::swap(mutex1, mutex2);
+    }
+
+    if (mutex1 != nullptr) {
+        mutex1->lock();
+    }
+
+    if (mutex2 != nullptr) {
+        mutex2->lock();
+    }
+
+    mMutex1 = mutex1;
+    mMutex2 = mutex2;
+}
+
+void Node::UsesLock::unlock()
+{
+    if (mMutex2 != nullptr) {
+        mMutex2->unlock();
+    }
+
+    mMutex1->unlock();
+}
+
+void* Node::operator new(std::size_t size)
+{
+    return operator new(size, nullptr);
+}
+
+void* Node::operator new(std::size_t size, NodeArena* arena)
+{
+    char* block;
+
+    if (arena != nullptr) {
+        block = (char*)arena->allocate(
+            NODE_HEADER_SIZE + size, alignof(std::max_align_t));
+    } else {
+        block = (char*)std::malloc(NODE_HEADER_SIZE + size);
+
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+    }
+
+    *(NodeArena**)block = arena;
+
+    if (arena != nullptr) {
+        sPendingArenaNodes.push_back(block + NODE_HEADER_SIZE);
+    }
+
+    return block + NODE_HEADER_SIZE;
+}
+
+void Node::operator delete(void* p)
+{
+    if (p == nullptr) {
+        return;
+    }
+
+    char* block = (char*)p - NODE_HEADER_SIZE;
+
+    if (*(NodeArena**)block == nullptr) {
+        std::free(block);
+    }
+}
+
+void Node::operator delete(void* p, NodeArena* arena)
+{
+    /*
+     * The constructor may have thrown before Node's constructor ran.
+     */
+    take_pending_arena_node(p);
+    operator delete(p);
+}
+
 const Location& Node::location() const { return mLocation; }
 
 void Node::setLocation(const Location& l) { mLocation = l; }
 
+std::size_t Node::countUses() const
+{
+    UsesLock lock(this);
+    std::size_t ret = 0;
+
+    for (LinkBase* use = mUses; use != nullptr; use = use->mNextUse) {
+        ret++;
+    }
+
+    return ret;
+}
+
 void Node::_replaceWith(Node* node)
 {
+    if (node == this) {
+        return;
+    }
+
     /*
      * Give the replacing node our location information.
      */
-    if (node) {
+    if (node && node->takesReplacedLocation()) {
         node->setLocation(location());
     }
 
     /*
-     * We need to ensure that the Node object isn't destroyed by the
-     * "replaceRequested" signal handlers even if they unref() the
-     * Node. Calling ref() before emitting the signal and unref()
-     * aferwards does the trick.
+     * We need to ensure that the Node object isn't destroyed while its
+     * uses are retargeted, even if that drops the last reference to it.
+     * Calling ref() before and unref() afterwards does the trick.
+     *
+     * Each use is moved to the replacing node's use list while both lists
+     * are locked, so that no other thread can unlink or retarget it in
+     * between. Only then is its owner notified, without holding the locks,
+     * as the owner may change other links in response. We are done as
+     * soon as our use list is empty.
      */
     ref();
-    mReplaceRequested(this, node);
-    unref();
-}
 
-signal<void(Node*, Node*)>& Node::replaceRequested()
-{
-    return mReplaceRequested;
+    for (;;) {
+        LinkBase* use;
+
+        {
+            UsesLock lock(this, node);
+            use = mUses;
+
+            if (use == nullptr) {
+                break;
+            }
+
+            if (node != nullptr) {
+                node->ref();
+            }
+
+            use->moveTo(node);
+        }
+
+        use->targetReplaced(this, node);
+        unref();
+    }
+
+    unref();
 }
 
 } // namespace ast
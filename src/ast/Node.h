@@ -10,14 +10,16 @@
 #define SOYA_AST_NODE_H_
 
 #include "Location.h"
-#include <boost/signals2/signal.hpp>
+#include "NodeArena.h"
+#include <atomic>
+#include <cstddef>
 #include <list>
+#include <mutex>
 
 namespace soyac {
 namespace ast {
 
-using boost::signals2::signal;
-
+class LinkBase;
 class Visitor;
 
 /**
@@ -40,7 +42,8 @@ class Visitor;
  * fully substiting one node with another in the abstract syntax tree. This
  * is useful in several circumstances, for instance for replacing
  * expressions with semantically equivalent, but simpler versions for
- * optimization purposes.
+ * optimization purposes. To make this possible, each node keeps an
+ * intrusive list of the Links pointing to it (its "uses").
  * - <b>Visitor hooks:</b> The Node class provides a visit() method, which
  *   visits the node with a specified Visitor. visit() is overridden by
  * every concrete child class of Node to call the correct visit method of
@@ -59,6 +62,42 @@ public:
      */
     virtual ~Node();
 
+    Node(const Node&) = delete;
+    Node& operator=(const Node&) = delete;
+
+    /**
+     * Allocates a node on the heap.
+     *
+     * @param size  The node's size.
+     * @return      The allocated memory.
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * Allocates a node in the passed NodeArena (or on the heap if the arena
+     * is null). A node allocated in an arena is destroyed like any other
+     * node, but its memory is only released together with the arena.
+     *
+     * @param size   The node's size.
+     * @param arena  The arena to allocate the node in, or null.
+     * @return       The allocated memory.
+     */
+    static void* operator new(std::size_t size, NodeArena* arena);
+
+    /**
+     * Releases the memory of a destroyed node, unless the node was
+     * allocated in a NodeArena.
+     *
+     * @param p  The memory to release.
+     */
+    static void operator delete(void* p);
+
+    /**
+     * Called if the constructor of a node allocated with
+     * operator new(std::size_t, NodeArena*) throws.
+     */
+    static void operator delete(void* p, NodeArena* arena);
+
     /**
      * Increases the reference count of the Node instance by one.
      */
@@ -97,6 +136,13 @@ public:
      * with references to the passed other node. Replacing a node with null
      * is not allowed.
      *
+     * With synchronization enabled (see setThreadSafe()), other threads may
+     * link to and unlink from both nodes at the same time. The owners of
+     * the retargeted links are notified afterwards, though, so the nodes
+     * owning them must not be modified by other threads meanwhile. Each
+     * module's nodes are therefore only replaced by the thread processing
+     * the module.
+     *
      * @param node  The node with which to replace. Null is ignored.
      */
     template <class N> void replaceWith(N* node)
@@ -106,6 +152,16 @@ public:
         }
     }
 
+    /**
+     * Returns whether the node takes over the location of a node it
+     * replaces (see replaceWith()). This is the case unless a child class
+     * overrides this.
+     *
+     * @return  @c true if the node takes over locations, @c false
+     *          otherwise.
+     */
+    virtual bool takesReplacedLocation() const { return true; }
+
     /**
      * Visits the node with the specified Visitor.
      *
@@ -118,28 +174,96 @@ public:
     virtual void* visit(Visitor* v) { return nullptr; }
 
     /**
-     * Returns the "replaceRequested" signal, which is emitted when the
-     * Node instance's replaceWith() method is called.
+     * Returns the number of Links pointing to the node.
      *
-     * Link instances pointing to the node subscribe to this signal to
-     * do the be notified when a replacement operation is required. The
-     * signal can also be subscribed to by other nodes or the
-     * signal-emitting Node instance itself, though.
-     *
-     * Note that after the each time the "replaceRequested" signal has been
-     * emitted, all signal handlers are disconnected.
+     * @return  The node's number of uses.
+     */
+    std::size_t countUses() const;
+
+    /**
+     * Returns whether the node may be linked to by several threads at once.
+     * Only nodes allocated in a NodeArena which is not shared (see
+     * NodeArena::setShared()) are known to be used by a single thread.
      *
-     * @par Callback Signature:
-     * <tt>void onReplaceRequested(Node* oldNode, Node* newNode);</tt>
+     * @return  @c true if the node is shared, @c false otherwise.
+     */
+    bool isShared() const;
+
+    /**
+     * Enables or disables the synchronization of use lists. With
+     * synchronization enabled, abstract syntax trees referring to the same
+     * nodes (for instance, built-in types or the entities of an imported
+     * module) may be analyzed and compiled by several threads at once.
+     * Synchronization is disabled by default. Reference counts are always
+     * atomic.
      *
-     * @return  The "replaceRequested" signal.
+     * @param threadSafe  Whether to synchronize.
      */
-    signal<void(Node*, Node*)>& replaceRequested();
+    static void setThreadSafe(bool threadSafe);
 
 private:
-    int mRefCount;
+    friend class LinkBase;
+
+    /**
+     * Locks the mutexes guarding the use lists of up to two nodes for its
+     * lifetime. The use lists share a fixed set of mutexes, and each node
+     * is guarded by the one its address maps to. Nodes which are not
+     * shared (see isShared()) are not locked, and nothing is locked unless
+     * synchronization is enabled (see setThreadSafe()).
+     */
+    class UsesLock {
+    public:
+        /**
+         * Creates a UsesLock.
+         *
+         * @param node1  The first node to lock, or null.
+         * @param node2  The second node to lock, or null.
+         */
+        UsesLock(const Node* node1, const Node* node2 = nullptr)
+            : mMutex1(nullptr)
+            , mMutex2(nullptr)
+        {
+            if (sThreadSafe) {
+                lock(node1, node2);
+            }
+        }
+
+        /**
+         * UsesLock destructor. Unlocks the locked mutexes.
+         */
+        ~UsesLock()
+        {
+            if (mMutex1 != nullptr) {
+                unlock();
+            }
+        }
+
+        UsesLock(const UsesLock&) = delete;
+        UsesLock& operator=(const UsesLock&) = delete;
+
+    private:
+        std::mutex* mMutex1;
+        std::mutex* mMutex2;
+
+        void lock(const Node* node1, const Node* node2);
+        void unlock();
+    };
+
+    static bool sThreadSafe;
+
+    std::atomic<int> mRefCount;
+    bool mInArena;
     Location mLocation;
-    signal<void(Node*, Node*)> mReplaceRequested;
+    LinkBase* mUses;
+
+    /**
+     * Returns the mutex guarding the passed node's use list, or null if
+     * the node is null or not shared.
+     *
+     * @param node  The node.
+     * @return      The node's mutex.
+     */
+    static std::mutex* usesMutex(const Node* node);
 
     /**
      * The concrete implementation of replaceWith().
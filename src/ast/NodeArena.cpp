@@ -0,0 +1,41 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include "NodeArena.h"
+
+namespace soyac {
+namespace ast {
+
+NodeArena::NodeArena()
+    : mShared(true)
+{
+}
+
+NodeArena::~NodeArena() { }
+
+void* NodeArena::allocate(std::size_t size, std::size_t alignment)
+{
+    return mAllocator.Allocate(size, llvm::Align(alignment));
+}
+
+std::size_t NodeArena::bytesUsed() const
+{
+    return mAllocator.getBytesAllocated();
+}
+
+std::size_t NodeArena::bytesReserved() const
+{
+    return mAllocator.getTotalMemory();
+}
+
+bool NodeArena::isShared() const { return mShared; }
+
+void NodeArena::setShared(bool shared) { mShared = shared; }
+
+} // namespace ast
+} // namespace soyac
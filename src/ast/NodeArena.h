@@ -0,0 +1,168 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_NODE_ARENA_H_
+#define SOYA_NODE_ARENA_H_
+
+#include <cstddef>
+#include <llvm/Support/Allocator.h>
+#include <new>
+#include <utility>
+
+namespace soyac {
+namespace ast {
+
+/**
+ * A bump-pointer arena in which the parser allocates the nodes of a module
+ * (see Node::operator new(std::size_t, NodeArena*)) and its temporary data.
+ *
+ * Memory allocated from a NodeArena is never released individually; it is
+ * released all at once when the arena is destroyed. Destroying a node that
+ * lives in an arena thus only runs its destructor. Each Module owns the
+ * arenas its source files were parsed into (see Module::adoptArena()), so
+ * nodes allocated in an arena must not be referenced after their module
+ * has been destroyed.
+ */
+class NodeArena {
+public:
+    /**
+     * Creates an empty NodeArena.
+     */
+    NodeArena();
+
+    /**
+     * NodeArena destructor. Releases all memory allocated from the arena.
+     */
+    ~NodeArena();
+
+    NodeArena(const NodeArena&) = delete;
+    NodeArena& operator=(const NodeArena&) = delete;
+
+    /**
+     * Allocates a block of memory from the arena.
+     *
+     * @param size       The block's size in bytes.
+     * @param alignment  The block's required alignment.
+     * @return           The allocated block.
+     */
+    void* allocate(std::size_t size, std::size_t alignment);
+
+    /**
+     * Allocates an object of type @c T in the arena and constructs it with
+     * the passed arguments. The object's destructor is never called.
+     *
+     * @param args  The constructor arguments.
+     * @return      The created object.
+     */
+    template <class T, class... Args> T* create(Args&&... args)
+    {
+        return new (allocate(sizeof(T), alignof(T)))
+            T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Returns the number of bytes allocated from the arena so far.
+     *
+     * @return  The number of used bytes.
+     */
+    std::size_t bytesUsed() const;
+
+    /**
+     * Returns the number of bytes the arena has reserved from the system
+     * (which is at least bytesUsed()).
+     *
+     * @return  The number of reserved bytes.
+     */
+    std::size_t bytesReserved() const;
+
+    /**
+     * Returns whether the nodes in the arena may be linked to by several
+     * threads at once (see Node::setThreadSafe()). This is the case unless
+     * declared otherwise with setShared().
+     *
+     * @return  @c true if the arena's nodes are shared, @c false otherwise.
+     */
+    bool isShared() const;
+
+    /**
+     * Sets whether the nodes in the arena may be linked to by several
+     * threads at once. The use lists of nodes in an arena which is not
+     * shared are only ever changed by one thread, and are therefore not
+     * synchronized. This must not be changed while other threads are
+     * working with the arena's nodes.
+     *
+     * @param shared  Whether the arena's nodes are shared.
+     */
+    void setShared(bool shared);
+
+private:
+    llvm::BumpPtrAllocator mAllocator;
+    bool mShared;
+};
+
+/**
+ * A standard library allocator that allocates from a NodeArena. Its
+ * deallocate() method does nothing.
+ *
+ * @tparam T  The allocated type.
+ */
+template <class T> class ArenaAllocator {
+public:
+    typedef T value_type;
+
+    /**
+     * Creates an ArenaAllocator.
+     *
+     * @param arena  The arena to allocate from.
+     */
+    ArenaAllocator(NodeArena* arena)
+        : mArena(arena)
+    {
+    }
+
+    /**
+     * Converting copy constructor.
+     */
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other)
+        : mArena(other.arena())
+    {
+    }
+
+    /**
+     * Returns the arena the allocator allocates from.
+     *
+     * @return  The allocator's arena.
+     */
+    NodeArena* arena() const { return mArena; }
+
+    T* allocate(std::size_t n)
+    {
+        return (T*)mArena->allocate(n * sizeof(T), alignof(T));
+    }
+
+    void deallocate(T* p, std::size_t n) { }
+
+    template <class U> bool operator==(const ArenaAllocator<U>& other) const
+    {
+        return mArena == other.arena();
+    }
+
+    template <class U> bool operator!=(const ArenaAllocator<U>& other) const
+    {
+        return mArena != other.arena();
+    }
+
+private:
+    NodeArena* mArena;
+};
+
+} // namespace ast
+} // namespace soyac
+
+#endif
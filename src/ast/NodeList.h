@@ -11,18 +11,25 @@
 
 #include "Link.h"
 #include "Node.h"
-#include <boost/signals2/signal.hpp>
-#include <functional>
-#include <list>
+#include "Signal.h"
+#include <cstddef>
+#include <llvm/ADT/SmallVector.h>
 
 namespace soyac {
 namespace ast {
 
 /**
  * Represents a list of abstract syntax tree nodes of the specified type.
- * Internally, a NodeList stores its elements as Link instances, which
- * gives it the same reference count management and Node::replaceWith()
- * awareness features.
+ * Internally, a NodeList stores its elements as links (see LinkBase),
+ * which gives it the same reference count management and
+ * Node::replaceWith() awareness features as Link.
+ *
+ * The elements are stored contiguously, and the first few of them inside
+ * the NodeList itself, so that iterating over a list does not need to
+ * chase pointers. Iterators refer to list positions rather than to
+ * elements; they stay valid if elements are added to the list or replaced
+ * with Node::replaceWith() while iterating, and compare equal to end()
+ * once they have moved past the list's last element.
  *
  * @tparam N  The Node subclass whose instances should be stored
  *            in the NodeList. Note that the type must be specified
@@ -30,8 +37,72 @@ namespace ast {
  */
 template <class N> class NodeList {
 private:
-    typename std::list<Link<N>*> mData;
-    typename boost::signals2::signal<void(N*, N*)> mChanged;
+    /**
+     * A list element. Elements may be moved in memory when the list
+     * grows or shrinks, taking their place in their target's use list
+     * with them.
+     */
+    class Element : public LinkBase {
+    public:
+        Element(NodeList* list, N* target)
+            : mList(list)
+        {
+            if (target != nullptr) {
+                ((Node*)target)->ref();
+                setTargetNode((Node*)target);
+            }
+        }
+
+        Element(Element&& other)
+            : LinkBase()
+            , mList(other.mList)
+        {
+            takeOver(other);
+        }
+
+        Element& operator=(Element&& other)
+        {
+            if (this != &other) {
+                release();
+                mList = other.mList;
+                takeOver(other);
+            }
+
+            return *this;
+        }
+
+        ~Element() { release(); }
+
+        N* target() const { return (N*)targetNode(); }
+
+    protected:
+        virtual void targetReplaced(Node* oldTarget, Node* target)
+        {
+            /*
+             * This might remove the element from the list, so "this" must
+             * not be accessed afterwards.
+             */
+            mList->onTargetChanged(oldTarget, target);
+        }
+
+    private:
+        NodeList* mList;
+
+        void release()
+        {
+            Node* target = targetNode();
+
+            if (target != nullptr) {
+                setTargetNode(nullptr);
+                target->unref();
+            }
+        }
+    };
+
+    typedef llvm::SmallVector<Element, 4> Elements;
+
+    Elements mData;
+    Signal<void(N*, N*)> mChanged;
 
     void onTargetChanged(Node* oldTarget, Node* newTarget)
     {
@@ -53,7 +124,7 @@ public:
          */
         const_iterator operator++()
         {
-            mIterator++;
+            mIndex++;
             return *this;
         }
 
@@ -62,35 +133,42 @@ public:
          */
         const_iterator operator++(int postfix)
         {
-            const_iterator it(mIterator);
-            mIterator++;
+            const_iterator it(*this);
+            mIndex++;
             return it;
         }
 
         /*
          * Dereferences the iterator.
          */
-        N* operator*() const { return (N*)(*mIterator)->target(); }
+        N* operator*() const { return (*mData)[mIndex].target(); }
 
         /**
          * Returns @c true if the iterator equals the passed other iterator.
          */
-        bool operator==(const_iterator it) { return mIterator == it.mIterator; }
+        bool operator==(const_iterator it) const
+        {
+            return mIndex == it.mIndex || (atEnd() && it.atEnd());
+        }
 
         /**
          * Returns @c true if the iterator does not equal the passed other
          * iterator.
          */
-        bool operator!=(const_iterator it) { return !(*this == it); }
+        bool operator!=(const_iterator it) const { return !(*this == it); }
 
     private:
         friend class NodeList;
-        typename std::list<Link<N>*>::const_iterator mIterator;
+        const Elements* mData;
+        std::size_t mIndex;
 
-        const_iterator(typename std::list<Link<N>*>::const_iterator it)
-            : mIterator(it)
+        const_iterator(const Elements* data, std::size_t index)
+            : mData(data)
+            , mIndex(index)
         {
         }
+
+        bool atEnd() const { return mIndex >= mData->size(); }
     };
 
     /**
@@ -113,30 +191,22 @@ public:
         }
     }
 
-    /**
-     * The NodeList destructor.
-     */
-    ~NodeList()
-    {
-        for (typename std::list<Link<N>*>::iterator it = mData.begin();
-            it != mData.end(); it++) {
-            delete *it;
-        }
-    }
-
     /**
      * Returns a constant iterator pointing to the list's first element.
      *
      * @return  The constant start iterator.
      */
-    const_iterator begin() const { return const_iterator(mData.begin()); }
+    const_iterator begin() const { return const_iterator(&mData, 0); }
 
     /**
      * Returns a constant iterator pointing past the list's last element.
      *
      * @return  The constant end iterator.
      */
-    const_iterator end() const { return const_iterator(mData.end()); }
+    const_iterator end() const
+    {
+        return const_iterator(&mData, static_cast<std::size_t>(-1));
+    }
 
     /**
      * Returns the number of elements in the list.
@@ -152,14 +222,7 @@ public:
      */
     void push_back(N* n)
     {
-        using namespace std::placeholders;
-
-        Link<N>* l = new Link<N>(n);
-
-        l->targetChanged().connect(
-            [this](auto old_, auto new_) { onTargetChanged(old_, new_); });
-
-        mData.push_back(l);
+        mData.emplace_back(this, n);
         changed()(nullptr, n);
     }
 
@@ -170,16 +233,24 @@ public:
      */
     void remove(N* n)
     {
-        for (typename std::list<Link<N>*>::iterator it = mData.begin();
-            it != mData.end();) {
-            if ((*it)->target() == n) {
-                Link<N>* removed = *it;
-                it = mData.erase(it);
+        for (std::size_t i = 0; i < mData.size();) {
+            if (mData[i].target() == n) {
+                /*
+                 * Keep the node alive until the "changed" signal has been
+                 * emitted.
+                 */
+                if (n != nullptr) {
+                    ((Node*)n)->ref();
+                }
 
+                mData.erase(mData.begin() + i);
                 changed()(n, nullptr);
-                delete removed;
+
+                if (n != nullptr) {
+                    ((Node*)n)->unref();
+                }
             } else {
-                it++;
+                i++;
             }
         }
     }
@@ -198,10 +269,7 @@ public:
      *
      * @return  The "changed" signal.
      */
-    typename boost::signals2::signal<void(N*, N*)>& changed()
-    {
-        return mChanged;
-    }
+    Signal<void(N*, N*)>& changed() { return mChanged; }
 };
 
 } // namespace ast
@@ -0,0 +1,102 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_SIGNAL_H_
+#define SOYA_SIGNAL_H_
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace soyac {
+namespace ast {
+
+template <class Signature> class Signal;
+
+/**
+ * A minimal, single-threaded signal with the part of the
+ * boost::signals2::signal interface used by the abstract syntax tree.
+ *
+ * A Signal without connected slots occupies a single pointer and never
+ * allocates memory, which matters for signals that exist once per
+ * abstract syntax tree edge (see Link::targetChanged()).
+ *
+ * Slots may safely connect further slots, or destroy the emitting Signal,
+ * while it is being emitted; slots connected during an emission are
+ * first called on the next emission.
+ *
+ * @tparam Args  The signal's argument types.
+ */
+template <class... Args> class Signal<void(Args...)> {
+public:
+    typedef std::function<void(Args...)> slot_type;
+
+    /**
+     * Creates a Signal without connected slots.
+     */
+    Signal() { }
+
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    /**
+     * Connects a slot to the signal.
+     *
+     * @param slot  The function object to call on emission.
+     */
+    void connect(slot_type slot)
+    {
+        if (!mSlots) {
+            mSlots.reset(new std::vector<slot_type>);
+        }
+
+        mSlots->push_back(std::move(slot));
+    }
+
+    /**
+     * Disconnects all slots from the signal.
+     */
+    void disconnect_all_slots() { mSlots.reset(); }
+
+    /**
+     * Returns @c true if no slot is connected to the signal.
+     *
+     * @return  Whether the signal has no slots.
+     */
+    bool empty() const { return !mSlots || mSlots->empty(); }
+
+    /**
+     * Emits the signal, calling all connected slots in the order of their
+     * connection.
+     *
+     * @param args  The arguments passed to the slots.
+     */
+    void operator()(Args... args) const
+    {
+        if (mSlots) {
+            /*
+             * Call a copy of the slot list, as a slot might destroy the
+             * signal (for instance, by deleting the Link it belongs to).
+             */
+            std::vector<slot_type> slots = *mSlots;
+
+            for (const slot_type& slot : slots) {
+                slot(args...);
+            }
+        }
+    }
+
+private:
+    std::unique_ptr<std::vector<slot_type>> mSlots;
+};
+
+} // namespace ast
+} // namespace soyac
+
+#endif
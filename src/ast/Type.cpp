@@ -17,6 +17,12 @@ Type::Type(const Name& name)
 {
 }
 
+std::recursive_mutex& Type::instancesMutex()
+{
+    static std::recursive_mutex sMutex;
+    return sMutex;
+}
+
 bool Type::isConvertableTo(Type* other) const
 {
     return isImplicitlyConvertableTo(other);
@@ -37,5 +43,7 @@ bool Type::isSubtypeOf(Type* other) const
     return (dynamic_cast<UnknownType*>(other) != nullptr);
 }
 
+bool Type::takesReplacedLocation() const { return false; }
+
 } // namespace ast
 } // namespace soyac
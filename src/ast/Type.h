@@ -10,6 +10,7 @@
 #define SOYA_TYPE_H_
 
 #include "DeclaredEntity.h"
+#include <mutex>
 
 namespace soyac {
 namespace ast {
@@ -71,6 +72,28 @@ public:
      *              @c false otherwise.
      */
     virtual bool isSubtypeOf(Type* other) const;
+
+    /**
+     * Returns @c false. A type keeps its location when it replaces another
+     * node (such as an UnknownType), as it is either declared elsewhere or,
+     * like the built-in types, shared by all code referring to it, possibly
+     * from several threads at once.
+     *
+     * @return  @c false.
+     */
+    virtual bool takesReplacedLocation() const;
+
+protected:
+    /**
+     * Returns the mutex guarding the instance registries of the built-in
+     * types (see, for instance, IntegerType::get()), which may be used by
+     * several threads at once. As creating a built-in type may create
+     * further built-in types, all registries share a single recursive
+     * mutex.
+     *
+     * @return  The registry mutex.
+     */
+    static std::recursive_mutex& instancesMutex();
 };
 
 } // namespace ast
@@ -25,10 +25,7 @@ void* UnknownArrayType::visit(Visitor* v)
     return v->visitUnknownArrayType(this);
 }
 
-UnknownType* UnknownArrayType::elementType() const
-{
-    return mElementType.target();
-}
+Type* UnknownArrayType::elementType() const { return mElementType.target(); }
 
 } // namespace ast
 } // namespace soyac
@@ -35,14 +35,16 @@ public:
     virtual void* visit(Visitor* v);
 
     /**
-     * Returns the (to-be-determined) element type of the array type.
+     * Returns the element type of the array type. This is an UnknownType
+     * until the element type has been resolved (and the UnknownType has
+     * been replaced with the actual type).
      *
      * @return  The array type's element type.
      */
-    UnknownType* elementType() const;
+    Type* elementType() const;
 
 private:
-    Link<UnknownType> mElementType;
+    Link<Type> mElementType;
 };
 
 } // namespace ast
@@ -32,7 +32,7 @@ UnknownType::UnknownType(const Name& name)
 
         it++;
 
-        for (; it != --name.identifiers_end(); it++) {
+        for (; it != name.identifiers_end() - 1; it++) {
             NamedEntity* parent = new NamedEntity(Name(*it));
 
             mQualifiedNameParents.back()->addChild(parent);
@@ -53,6 +53,8 @@ UnknownType::~UnknownType()
 
 UnknownType* UnknownType::getSingleton()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (!sInstance) {
         sInstance = new UnknownType("(unknown)");
         sInstance->ref();
@@ -21,6 +21,8 @@ VoidType::VoidType()
 
 VoidType* VoidType::get()
 {
+    std::lock_guard<std::recursive_mutex> lock(instancesMutex());
+
     if (sInstance == nullptr) {
         sInstance = new VoidType;
         sInstance->ref();
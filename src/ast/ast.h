@@ -39,6 +39,7 @@
 #include "FunctionParameter.h"
 #include "FunctionParameterExpression.h"
 #include "FunctionType.h"
+#include "Identifier.h"
 #include "IfStatement.h"
 #include "InstanceFunctionExpression.h"
 #include "InstanceVariableExpression.h"
@@ -53,6 +54,7 @@
 #include "Name.h"
 #include "NamedEntity.h"
 #include "Node.h"
+#include "NodeArena.h"
 #include "ObjectCreationExpression.h"
 #include "Property.h"
 #include "PropertyGetAccessor.h"
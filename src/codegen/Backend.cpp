@@ -0,0 +1,268 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/MC/MCSubtargetInfo.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/OptimizationLevel.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/CodeGen.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/TargetParser/Host.h>
+
+#include "Backend.h"
+#include <common/PhaseTimer.h>
+
+namespace soyac {
+namespace codegen {
+
+Backend::Backend()
+    : mOptimizationLevel(0)
+    , mTargetCPU("generic")
+{
+}
+
+unsigned Backend::optimizationLevel() const { return mOptimizationLevel; }
+
+void Backend::setOptimizationLevel(unsigned level)
+{
+    assert(level <= 3);
+    mOptimizationLevel = level;
+}
+
+const std::string& Backend::targetCPU() const { return mTargetCPU; }
+
+void Backend::setTargetCPU(const std::string& cpu) { mTargetCPU = cpu; }
+
+const std::string& Backend::targetFeatures() const { return mTargetFeatures; }
+
+void Backend::setTargetFeatures(const std::string& features)
+{
+    mTargetFeatures = features;
+}
+
+bool Backend::hasCustomTarget() const
+{
+    return mTargetCPU != "generic" || !mTargetFeatures.empty();
+}
+
+void Backend::validateTarget() const
+{
+    std::string errorCode;
+    std::string triple = targetTriple();
+    auto target = llvm::TargetRegistry::lookupTarget(triple, errorCode);
+
+    if (!errorCode.empty()) {
+        throw std::runtime_error("Unsupported target");
+    }
+
+    /*
+     * Create the subtarget information for the default CPU, as LLVM warns
+     * about an unknown one.
+     */
+    std::string cpu = resolvedTargetCPU();
+    std::unique_ptr<llvm::MCSubtargetInfo> subtargetInfo(
+        target->createMCSubtargetInfo(triple, "", ""));
+
+    if (!subtargetInfo->isCPUStringValid(cpu)) {
+        throw std::invalid_argument("unknown target CPU `" + cpu + "'");
+    }
+
+    llvm::ArrayRef<llvm::SubtargetFeatureKV> known
+        = subtargetInfo->getAllProcessorFeatures();
+    llvm::SmallVector<llvm::StringRef, 16> features;
+    llvm::StringRef(mTargetFeatures).split(features, ',', -1, false);
+
+    for (llvm::StringRef feature : features) {
+        if (feature[0] != '+' && feature[0] != '-') {
+            throw std::invalid_argument("target feature `" + feature.str()
+                + "' must start with `+' or `-'");
+        }
+
+        llvm::StringRef name = feature.drop_front();
+
+        if (std::none_of(known.begin(), known.end(),
+                [&](const llvm::SubtargetFeatureKV& kv) {
+                    return name == kv.Key;
+                })) {
+            throw std::invalid_argument(
+                "unknown target feature `" + name.str() + "'");
+        }
+    }
+}
+
+std::string Backend::targetTriple() const
+{
+    return llvm::sys::getDefaultTargetTriple();
+}
+
+std::unique_ptr<llvm::TargetMachine> Backend::createTargetMachine() const
+{
+    std::string errorCode;
+    std::string triple = targetTriple();
+    auto target = llvm::TargetRegistry::lookupTarget(triple, errorCode);
+
+    if (!errorCode.empty()) {
+        throw std::runtime_error("Unsupported target");
+    }
+
+    /*
+     * Without optimization, stick to LLVM's default code generation level
+     * (which is what we have always used) rather than CodeGenOptLevel::None.
+     */
+    llvm::CodeGenOptLevel codeGenLevel = llvm::CodeGenOptLevel::Default;
+
+    switch (mOptimizationLevel) {
+    case 1:
+        codeGenLevel = llvm::CodeGenOptLevel::Less;
+        break;
+    case 3:
+        codeGenLevel = llvm::CodeGenOptLevel::Aggressive;
+        break;
+    }
+
+    llvm::TargetOptions options;
+    return std::unique_ptr<llvm::TargetMachine>(
+        target->createTargetMachine(triple, resolvedTargetCPU(),
+            resolvedTargetFeatures(), options, llvm::Reloc::PIC_,
+            std::nullopt, codeGenLevel));
+}
+
+void Backend::prepare(
+    llvm::Module* module, llvm::TargetMachine* targetMachine) const
+{
+    module->setTargetTriple(targetMachine->getTargetTriple().str());
+    module->setDataLayout(targetMachine->createDataLayout());
+
+    if (!hasCustomTarget()) {
+        return;
+    }
+
+    std::string cpu = resolvedTargetCPU();
+    std::string features = resolvedTargetFeatures();
+
+    for (llvm::Function& func : *module) {
+        if (func.isDeclaration()) {
+            continue;
+        }
+
+        func.addFnAttr("target-cpu", cpu);
+
+        if (!features.empty()) {
+            func.addFnAttr("target-features", features);
+        }
+    }
+}
+
+void Backend::optimize(llvm::Module* module,
+    llvm::TargetMachine* targetMachine, Pipeline pipeline) const
+{
+    if (mOptimizationLevel == 0) {
+        return;
+    }
+
+    PhaseTimer timer("optimization");
+    llvm::OptimizationLevel level = llvm::OptimizationLevel::O2;
+
+    switch (mOptimizationLevel) {
+    case 1:
+        level = llvm::OptimizationLevel::O1;
+        break;
+    case 3:
+        level = llvm::OptimizationLevel::O3;
+        break;
+    }
+
+    llvm::LoopAnalysisManager loopAnalyses;
+    llvm::FunctionAnalysisManager functionAnalyses;
+    llvm::CGSCCAnalysisManager cgsccAnalyses;
+    llvm::ModuleAnalysisManager moduleAnalyses;
+
+    llvm::PassBuilder passBuilder(targetMachine);
+    passBuilder.registerModuleAnalyses(moduleAnalyses);
+    passBuilder.registerCGSCCAnalyses(cgsccAnalyses);
+    passBuilder.registerFunctionAnalyses(functionAnalyses);
+    passBuilder.registerLoopAnalyses(loopAnalyses);
+    passBuilder.crossRegisterProxies(
+        loopAnalyses, functionAnalyses, cgsccAnalyses, moduleAnalyses);
+
+    llvm::ModulePassManager passManager;
+
+    switch (pipeline) {
+    case PER_MODULE:
+        passManager = passBuilder.buildPerModuleDefaultPipeline(level);
+        break;
+    case LTO_PRE_LINK:
+        passManager = passBuilder.buildLTOPreLinkDefaultPipeline(level);
+        break;
+    case LTO:
+        passManager = passBuilder.buildLTODefaultPipeline(level, nullptr);
+        break;
+    }
+
+    passManager.run(*module, moduleAnalyses);
+}
+
+void Backend::emitObjectFile(llvm::Module* module,
+    llvm::TargetMachine* targetMachine, path destination,
+    std::error_code& error) const
+{
+    PhaseTimer timer("emission");
+    llvm::raw_fd_ostream out(destination.string(), error);
+
+    if (error) {
+        return;
+    }
+
+    llvm::legacy::PassManager passManager;
+    targetMachine->addPassesToEmitFile(passManager, out, nullptr,
+        llvm::CodeGenFileType::ObjectFile, true, nullptr);
+    passManager.run(*module);
+}
+
+std::string Backend::resolvedTargetCPU() const
+{
+    if (mTargetCPU == "native") {
+        return llvm::sys::getHostCPUName().str();
+    } else {
+        return mTargetCPU;
+    }
+}
+
+std::string Backend::resolvedTargetFeatures() const
+{
+    std::string features;
+
+    if (mTargetCPU == "native") {
+        for (auto& feature : llvm::sys::getHostCPUFeatures()) {
+            if (!features.empty()) {
+                features += ',';
+            }
+
+            features += feature.getValue() ? '+' : '-';
+            features += feature.getKey().str();
+        }
+    }
+
+    if (!mTargetFeatures.empty()) {
+        if (!features.empty()) {
+            features += ',';
+        }
+
+        features += mTargetFeatures;
+    }
+
+    return features;
+}
+
+} // namespace codegen
+} // namespace soyac
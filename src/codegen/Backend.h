@@ -0,0 +1,199 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_BACKEND_H_
+#define SOYA_BACKEND_H_
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <llvm/IR/Module.h>
+#include <llvm/Target/TargetMachine.h>
+
+namespace soyac {
+namespace codegen {
+
+using std::filesystem::path;
+
+/**
+ * Turns LLVM modules into native code for the host. A Backend holds the
+ * target and optimization options, creates the matching target machine,
+ * runs the LLVM optimization pipelines and emits object files.
+ */
+class Backend {
+public:
+    /**
+     * The optimization pipelines which can be run by optimize().
+     */
+    enum Pipeline {
+        /** The pipeline for a module compiled on its own. */
+        PER_MODULE,
+        /** The pipeline for a module which is to be linked with others
+            and optimized again with the LTO pipeline. */
+        LTO_PRE_LINK,
+        /** The pipeline for a program merged from multiple modules. */
+        LTO
+    };
+
+    /**
+     * Creates a Backend for the generic host CPU without optimization.
+     */
+    Backend();
+
+    /**
+     * Returns the optimization level.
+     *
+     * @return  The optimization level (0 to 3).
+     */
+    unsigned optimizationLevel() const;
+
+    /**
+     * Sets the optimization level. At level 0 (the default), optimize()
+     * does nothing; at levels 1 to 3, it runs LLVM's corresponding default
+     * optimization pipeline, and native code is generated with the
+     * matching code generation optimization level.
+     *
+     * @param level  The optimization level (0 to 3).
+     */
+    void setOptimizationLevel(unsigned level);
+
+    /**
+     * Returns the CPU for which code is generated, as passed to
+     * setTargetCPU().
+     *
+     * @return  The target CPU.
+     */
+    const std::string& targetCPU() const;
+
+    /**
+     * Sets the CPU for which code is generated, using the CPU names known
+     * to LLVM (for instance, "skylake" or "znver3"). The special name
+     * "native" selects the host's CPU and enables all features it
+     * supports. The default is "generic".
+     *
+     * @param cpu  The target CPU.
+     */
+    void setTargetCPU(const std::string& cpu);
+
+    /**
+     * Returns the target features set with setTargetFeatures().
+     *
+     * @return  The target features.
+     */
+    const std::string& targetFeatures() const;
+
+    /**
+     * Sets additional target features to enable or disable, given as
+     * a comma-separated list of LLVM feature names prefixed with "+" or
+     * "-" (for instance, "+avx2,-avx512f"). These are applied on top of
+     * the features implied by the target CPU.
+     *
+     * @param features  The target features.
+     */
+    void setTargetFeatures(const std::string& features);
+
+    /**
+     * Returns @c true if a target CPU or target features other than the
+     * defaults have been requested.
+     *
+     * @return  Whether a custom target has been requested.
+     */
+    bool hasCustomTarget() const;
+
+    /**
+     * Checks that the target CPU is known for the host's target and that
+     * the target features are known and prefixed with "+" or "-".
+     *
+     * @throw std::runtime_error     If the host's target is not supported.
+     * @throw std::invalid_argument  If the target CPU or one of the target
+     *                               features is invalid.
+     */
+    void validateTarget() const;
+
+    /**
+     * Returns the target triple of the host, which code is generated for.
+     *
+     * @return  The target triple.
+     */
+    std::string targetTriple() const;
+
+    /**
+     * Returns the name of the CPU to generate code for, with "native"
+     * resolved to the host's CPU.
+     *
+     * @return  The target CPU.
+     */
+    std::string resolvedTargetCPU() const;
+
+    /**
+     * Returns the target features to enable or disable, including those
+     * of the host's CPU if the target CPU is "native".
+     *
+     * @return  The target features.
+     */
+    std::string resolvedTargetFeatures() const;
+
+    /**
+     * Creates a target machine for the host, configured for the Backend's
+     * target and optimization options.
+     *
+     * @return  The target machine.
+     */
+    std::unique_ptr<llvm::TargetMachine> createTargetMachine() const;
+
+    /**
+     * Prepares the passed LLVM module for optimization and code generation
+     * with the passed target machine: sets the module's target triple and
+     * data layout and, if a custom target has been requested, adds
+     * "target-cpu" and "target-features" attributes to all functions
+     * defined in the module so that the optimizers tune and vectorize
+     * for that target.
+     *
+     * @param module         The LLVM module.
+     * @param targetMachine  The target machine.
+     */
+    void prepare(
+        llvm::Module* module, llvm::TargetMachine* targetMachine) const;
+
+    /**
+     * Runs the passed optimization pipeline at the Backend's optimization
+     * level on the passed LLVM module. Does nothing at optimization
+     * level 0.
+     *
+     * @param module         The LLVM module to optimize.
+     * @param targetMachine  The target machine to optimize for.
+     * @param pipeline       The pipeline to run.
+     */
+    void optimize(llvm::Module* module, llvm::TargetMachine* targetMachine,
+        Pipeline pipeline = PER_MODULE) const;
+
+    /**
+     * Generates native code for the passed (prepared) LLVM module and
+     * writes it to the passed object file.
+     *
+     * @param module         The LLVM module.
+     * @param targetMachine  The target machine.
+     * @param destination    The object file to write.
+     * @param error          Set if the object file cannot be written.
+     */
+    void emitObjectFile(llvm::Module* module,
+        llvm::TargetMachine* targetMachine, path destination,
+        std::error_code& error) const;
+
+private:
+    unsigned mOptimizationLevel;
+    std::string mTargetCPU;
+    std::string mTargetFeatures;
+};
+
+} // namespace codegen
+} // namespace soyac
+
+#endif
@@ -11,12 +11,12 @@
 #include <sstream>
 #include <vector>
 
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/GlobalVariable.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/IntrinsicInst.h>
 #include <llvm/IR/LegacyPassManager.h>
-#include <llvm/IR/ValueSymbolTable.h>
 #include <llvm/MC/TargetRegistry.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
@@ -25,6 +25,7 @@
 
 #include "CodeGenerator.h"
 #include <ast/ast.h>
+#include <common/PhaseTimer.h>
 
 #include "mangling.h"
 
@@ -34,7 +35,7 @@ namespace codegen {
 CodeGenerator::CodeGenerator(Module* module)
     : mModule(module)
     , mLLVMModule(new llvm::Module(module->name().str(), mContext))
-    , mTypeMapper(mContext, mLLVMModule->getDataLayout())
+    , mTypeMapper(mContext, mLLVMModule->getDataLayout(), mMangler)
     , mBuilder(mContext)
     , mEnclosing(nullptr)
     , mLValue(false)
@@ -43,14 +44,29 @@ CodeGenerator::CodeGenerator(Module* module)
     llvm::InitializeNativeTargetAsmPrinter();
 }
 
+const Backend& CodeGenerator::backend() const { return mBackend; }
+
+void CodeGenerator::setBackend(const Backend& backend) { mBackend = backend; }
+
 void CodeGenerator::toLLVMAssembly(path destination, std::error_code& error)
 {
-    auto llvmModule = static_cast<llvm::Module*>(visitModule(mModule));
+    llvm::Module* llvmModule = generate();
 
     if (!llvmModule) {
         return;
     }
 
+    if (mBackend.optimizationLevel() > 0 || mBackend.hasCustomTarget()) {
+        /*
+         * The optimizers need to know the target's data layout; this
+         * also shows up in the emitted LLVM assembly.
+         */
+        auto targetMachine = mBackend.createTargetMachine();
+        mBackend.prepare(llvmModule, targetMachine.get());
+        mBackend.optimize(llvmModule, targetMachine.get());
+    }
+
+    PhaseTimer timer("emission");
     llvm::raw_fd_ostream out(destination.string(), error);
 
     if (error) {
@@ -62,45 +78,53 @@ void CodeGenerator::toLLVMAssembly(path destination, std::error_code& error)
 
 void CodeGenerator::toObjectCode(path destination, std::error_code& error)
 {
-    auto llvmModule = static_cast<llvm::Module*>(visitModule(mModule));
+    llvm::Module* llvmModule = generate();
+    auto targetMachine = mBackend.createTargetMachine();
 
-    std::string errorCode;
-    auto targetTriple = llvm::sys::getDefaultTargetTriple();
-    auto target = llvm::TargetRegistry::lookupTarget(targetTriple, errorCode);
+    mBackend.prepare(llvmModule, targetMachine.get());
+    mBackend.optimize(llvmModule, targetMachine.get());
+    mBackend.emitObjectFile(
+        llvmModule, targetMachine.get(), destination, error);
+}
 
-    if (!errorCode.empty()) {
-        throw std::runtime_error("Unsupported target");
-    }
+void CodeGenerator::toBitcode(path destination, std::error_code& error)
+{
+    llvm::Module* llvmModule = generate();
+    auto targetMachine = mBackend.createTargetMachine();
 
-    llvm::TargetOptions options;
-    std::unique_ptr<llvm::TargetMachine> targetMachine {
-        target->createTargetMachine(
-            targetTriple, "generic", "", options, llvm::Reloc::PIC_)
-    };
+    mBackend.prepare(llvmModule, targetMachine.get());
+    mBackend.optimize(
+        llvmModule, targetMachine.get(), Backend::LTO_PRE_LINK);
 
+    PhaseTimer timer("emission");
     llvm::raw_fd_ostream out(destination.string(), error);
 
     if (error) {
         return;
     }
 
-    llvm::legacy::PassManager passManager;
-    targetMachine->addPassesToEmitFile(passManager, out, nullptr,
-        llvm::CodeGenFileType::ObjectFile, true, nullptr);
-
-    llvmModule->setTargetTriple(targetTriple);
-    llvmModule->setDataLayout(targetMachine->createDataLayout());
-    passManager.run(*llvmModule);
+    llvm::WriteBitcodeToFile(*llvmModule, out);
 }
 
 ///// Helper Methods
 //////////////////////////////////////////////////////////////
 
+llvm::Module* CodeGenerator::generate()
+{
+    PhaseTimer timer("code generation");
+    return static_cast<llvm::Module*>(visitModule(mModule));
+}
+
 void* CodeGenerator::visitLLValueExpression(LLValueExpression* expr)
 {
     return expr->value();
 }
 
+const std::string& CodeGenerator::mangledName(NamedEntity* entity)
+{
+    return mMangler.mangledName(entity);
+}
+
 llvm::PointerType* CodeGenerator::pointerType()
 {
     return llvm::PointerType::getUnqual(mContext);
@@ -202,12 +226,26 @@ llvm::Function* CodeGenerator::llfunction(Function* func)
 
         for (; a != llfunc->arg_end(); p++, a++) {
             a->setName(mangledName(*p));
+            mValues[*p] = &*a;
         }
     }
 
     return llfunc;
 }
 
+llvm::GlobalVariable* CodeGenerator::llglobal(Variable* var)
+{
+    llvm::Value*& value = mValues[var];
+
+    if (value == nullptr) {
+        value = new llvm::GlobalVariable(*mLLVMModule,
+            mTypeMapper.valueType(var->type()), false,
+            llvm::GlobalVariable::ExternalLinkage, nullptr, mangledName(var));
+    }
+
+    return static_cast<llvm::GlobalVariable*>(value);
+}
+
 llvm::Function* CodeGenerator::llinitializer(UserDefinedType* type)
 {
     llvm::Function* llfunc
@@ -250,28 +288,6 @@ llvm::Function* CodeGenerator::llallocator(ClassType* type)
     return llfunc;
 }
 
-llvm::Value* CodeGenerator::createGetInstanceData(
-    llvm::Value* instance, ClassType* type, bool lvalue)
-{
-    unsigned int classIndex = 0;
-    ClassType* cls = type;
-
-    while (cls->baseClass()) {
-        classIndex++;
-        cls = static_cast<ClassType*>(cls->baseClass());
-    }
-
-    auto pointerType = llvm::PointerType::getUnqual(mContext);
-
-    llvm::Value* dataPointer = mBuilder.CreateGEP(pointerType, instance,
-        {
-            llvm::ConstantInt::get(sizeType(), 0),
-            llvm::ConstantInt::get(sizeType(), classIndex),
-        });
-
-    return lvalue ? dataPointer : mBuilder.CreateLoad(pointerType, dataPointer);
-}
-
 void CodeGenerator::createInitializer(UserDefinedType* type)
 {
     llvm::Function* tmpFunction = mFunction;
@@ -280,15 +296,6 @@ void CodeGenerator::createInitializer(UserDefinedType* type)
     llvm::BasicBlock* tmpBlock = mBuilder.GetInsertBlock();
     mBuilder.SetInsertPoint(llvm::BasicBlock::Create(mContext, "", mFunction));
 
-    if (auto ctype = dynamic_cast<ClassType*>(type)) {
-        llvm::Value* data = createGCMalloc(mTypeMapper.objectType(ctype));
-
-        llvm::Value* thisVal = (llvm::Value*)ThisExpression(ctype).visit(this);
-
-        llvm::Value* dataPtr = createGetInstanceData(thisVal, ctype, true);
-        mBuilder.CreateStore(data, dataPtr);
-    }
-
     /*
      * Generate code for initializing all instance variables.
      */
@@ -522,21 +529,21 @@ llvm::Value* CodeGenerator::createBuiltInMethodCall(Expression* operand,
          * plus()
          */
         if (methodName == "plus") {
-            return mBuilder.CreateAdd(lh, rh);
+            return mBuilder.CreateFAdd(lh, rh);
         }
 
         /*
          * minus()
          */
         else if (methodName == "minus") {
-            return mBuilder.CreateSub(lh, rh);
+            return mBuilder.CreateFSub(lh, rh);
         }
 
         /*
          * mul()
          */
         else if (methodName == "mul") {
-            return mBuilder.CreateMul(lh, rh);
+            return mBuilder.CreateFMul(lh, rh);
         }
 
         /*
@@ -597,25 +604,20 @@ llvm::Value* CodeGenerator::createBuiltInMethodCall(Expression* operand,
         auto elementType
             = dynamic_cast<ArrayType*>(operand->type())->elementType();
 
-        if (methodName == "getElement") {
-            std::vector<llvm::Value*> indices;
-            indices.push_back(llvm::ConstantInt::get(sizeType(), 0, false));
-            indices.push_back(llvm::ConstantInt::get(sizeType(), 1, false));
-            indices.push_back(rh);
+        auto llvmElementType = mTypeMapper.valueType(elementType);
 
+        if (methodName == "getElement") {
+            llvm::Value* dataField
+                = mBuilder.CreateStructGEP(llvmArrayType, lh, 1);
             llvm::Value* address
-                = mBuilder.CreateGEP(llvmArrayType, lh, indices);
+                = mBuilder.CreateGEP(llvmElementType, dataField, rh);
 
-            auto llvmElementType = mTypeMapper.valueType(elementType);
             return mBuilder.CreateLoad(llvmElementType, address);
         } else if (methodName == "setElement") {
-            std::vector<llvm::Value*> indices;
-            indices.push_back(llvm::ConstantInt::get(sizeType(), 0, false));
-            indices.push_back(llvm::ConstantInt::get(sizeType(), 1, false));
-            indices.push_back(rh);
-
+            llvm::Value* dataField
+                = mBuilder.CreateStructGEP(llvmArrayType, lh, 1);
             llvm::Value* address
-                = mBuilder.CreateGEP(llvmArrayType, lh, indices);
+                = mBuilder.CreateGEP(llvmElementType, dataField, rh);
 
             LLValueExpression lhExpr(elementType, address);
             LLValueExpression rhExpr(elementType, rh2);
@@ -667,10 +669,15 @@ llvm::Value* CodeGenerator::createBuiltInPropertyCall(
 
 llvm::Value* CodeGenerator::createSizeof(llvm::Type* type)
 {
+    /*
+     * The size of a type is the address of the second element of an array
+     * of that type starting at null, which is folded into a constant once
+     * the target's data layout is known.
+     */
     llvm::PointerType* ptrType = llvm::PointerType::getUnqual(type);
 
     llvm::Value* tmp
-        = mBuilder.CreateGEP(ptrType, llvm::ConstantPointerNull::get(ptrType),
+        = mBuilder.CreateGEP(type, llvm::ConstantPointerNull::get(ptrType),
             llvm::ConstantInt::get(
                 llvm::IntegerType::getInt32Ty(mContext), 1, false));
 
@@ -678,6 +685,35 @@ llvm::Value* CodeGenerator::createSizeof(llvm::Type* type)
     return mBuilder.CreatePtrToInt(tmp, sizeType());
 }
 
+llvm::AllocaInst* CodeGenerator::createLocal(
+    llvm::Type* type, const std::string& name)
+{
+    llvm::BasicBlock& entry = mFunction->getEntryBlock();
+    llvm::IRBuilder<> entryBuilder(&entry, entry.begin());
+    llvm::AllocaInst* local = entryBuilder.CreateAlloca(type, nullptr, name);
+
+    /*
+     * Slots created outside of any block of the current function (such
+     * as in the initializer functions of structs and classes) live until
+     * the function returns.
+     */
+    if (!mBlockLocals.empty() && mBlockLocals.back().function == mFunction) {
+        mBuilder.CreateLifetimeStart(local);
+        mBlockLocals.back().locals.push_back(local);
+    }
+
+    return local;
+}
+
+void CodeGenerator::createBranch(llvm::BasicBlock* dest)
+{
+    llvm::BasicBlock* current = mBuilder.GetInsertBlock();
+
+    if (current->empty() || !current->back().isTerminator()) {
+        mBuilder.CreateBr(dest);
+    }
+}
+
 llvm::Value* CodeGenerator::createGCMalloc(llvm::Value* size)
 {
     llvm::Type* i8p
@@ -740,8 +776,6 @@ void* CodeGenerator::visitModule(soyac::ast::Module* m)
 
     m->body()->visit(this);
 
-    mBuilder.SetInsertPoint(&mFunction->back());
-
     if (m == Module::getProgram()) {
         mBuilder.CreateRet(
             llvm::ConstantInt::get(llvm::Type::getInt32Ty(mContext), 0, true));
@@ -757,11 +791,26 @@ void* CodeGenerator::visitModule(soyac::ast::Module* m)
 
 void* CodeGenerator::visitBlock(Block* b)
 {
+    mBlockLocals.push_back({ mFunction, {} });
+
     for (Block::statements_iterator it = b->statements_begin();
         it != b->statements_end(); it++) {
         (*it)->visit(this);
     }
 
+    /*
+     * End the lifetime of the block's stack slots, unless the block has
+     * been left already (by a return statement, for instance).
+     */
+    llvm::BasicBlock* last = mBuilder.GetInsertBlock();
+
+    if (last->empty() || !last->back().isTerminator()) {
+        for (llvm::AllocaInst* local : mBlockLocals.back().locals) {
+            mBuilder.CreateLifetimeEnd(local);
+        }
+    }
+
+    mBlockLocals.pop_back();
     return nullptr;
 }
 
@@ -819,6 +868,14 @@ void* CodeGenerator::visitForStatement(ForStatement* stmt)
 
     stmt->body()->visit(this);
 
+    /*
+     * The iterators get a block of their own, which is unreachable if
+     * the loop body always returns.
+     */
+    llvm::BasicBlock* next = llvm::BasicBlock::Create(mContext, "", mFunction);
+    createBranch(next);
+    mBuilder.SetInsertPoint(next);
+
     for (ForStatement::iterators_iterator it = stmt->iterators_begin();
         it != stmt->iterators_end(); it++) {
         (*it)->visit(this);
@@ -852,16 +909,16 @@ void* CodeGenerator::visitIfStatement(IfStatement* stmt)
     if (stmt->elseBody() != nullptr) {
         llvm::BasicBlock* ifEnd
             = llvm::BasicBlock::Create(mContext, "", mFunction);
-        mBuilder.CreateBr(ifEnd);
+        createBranch(ifEnd);
 
         mBuilder.SetInsertPoint(ifFalse);
         stmt->elseBody()->visit(this);
 
-        mBuilder.CreateBr(ifEnd);
+        createBranch(ifEnd);
         mBuilder.SetInsertPoint(ifEnd);
 
     } else {
-        mBuilder.CreateBr(ifFalse);
+        createBranch(ifFalse);
         mBuilder.SetInsertPoint(ifFalse);
     }
 
@@ -895,7 +952,7 @@ void* CodeGenerator::visitWhileStatement(WhileStatement* stmt)
     loop = llvm::BasicBlock::Create(mContext, "", mFunction);
     mBuilder.SetInsertPoint(loop);
     stmt->body()->visit(this);
-    mBuilder.CreateBr(start);
+    createBranch(start);
 
     end = llvm::BasicBlock::Create(mContext, "", mFunction);
 
@@ -1098,13 +1155,12 @@ void* CodeGenerator::visitVariable(Variable* var)
     llvm::Value* v;
 
     if (mFunction == mInitFunction) {
-        v = new llvm::GlobalVariable(*mLLVMModule,
-            mTypeMapper.valueType(var->type()), false,
-            llvm::GlobalVariable::ExternalLinkage, defaultValue(var->type()),
-            mangledName(var));
+        llvm::GlobalVariable* global = llglobal(var);
+        global->setInitializer(defaultValue(var->type()));
+        v = global;
     } else {
-        v = mBuilder.CreateAlloca(
-            mTypeMapper.valueType(var->type()), nullptr, mangledName(var).c_str());
+        v = createLocal(mTypeMapper.valueType(var->type()), mangledName(var));
+        mValues[var] = v;
 
         if (var->initializer() == nullptr) {
             Expression* rh
@@ -1148,6 +1204,14 @@ void* CodeGenerator::visitArrayCreationExpression(ArrayCreationExpression* expr)
 
     if (expr->lengthExpression() != nullptr) {
         len = (llvm::Value*)expr->lengthExpression()->visit(this);
+
+        /*
+         * The length is stored as (and multiplied with) a size_t value,
+         * so widen (or narrow) it to that type first.
+         */
+        IntegerType* lengthType
+            = (IntegerType*)expr->lengthExpression()->type();
+        len = mBuilder.CreateIntCast(len, sizeType(), lengthType->isSigned());
     } else {
         len = llvm::ConstantInt::get(sizeType(), elems.size(), false);
     }
@@ -1159,9 +1223,11 @@ void* CodeGenerator::visitArrayCreationExpression(ArrayCreationExpression* expr)
 
     ArrayType* arrayType = (ArrayType*)expr->type();
     llvm::Type* llvmArrayType = mTypeMapper.objectType(arrayType);
+    Type* elementType = arrayType->elementType();
+    llvm::Type* llvmElementType = mTypeMapper.valueType(elementType);
 
     llvm::Value* allocSize
-        = mBuilder.CreateMul(createSizeof(llvmArrayType), len);
+        = mBuilder.CreateMul(createSizeof(llvmElementType), len);
     allocSize = mBuilder.CreateAdd(allocSize, createSizeof(sizeType()));
 
     llvm::Value* array = createGCMalloc(allocSize);
@@ -1177,16 +1243,9 @@ void* CodeGenerator::visitArrayCreationExpression(ArrayCreationExpression* expr)
 
     mBuilder.CreateStore(len, lengthField);
 
-    Type* elementType = arrayType->elementType();
-    llvm::Type* llvmElementType = mTypeMapper.valueType(elementType);
-
     for (size_t index = 0; index < elems.size(); index++) {
-        std::vector<llvm::Value*> indices;
-        indices.push_back(llvm::ConstantInt::get(sizeType(), 0, false));
-        indices.push_back(llvm::ConstantInt::get(sizeType(), index, false));
-
-        llvm::Value* elemLH
-            = mBuilder.CreateGEP(llvmElementType, dataField, indices);
+        llvm::Value* elemLH = mBuilder.CreateGEP(llvmElementType, dataField,
+            llvm::ConstantInt::get(sizeType(), index, false));
 
         Expression* lh
             = new LLValueExpression(arrayType->elementType(), elemLH);
@@ -1300,7 +1359,10 @@ void* CodeGenerator::visitCallExpression(CallExpression* expr)
             llvmFunctionType->param_begin(), llvmFunctionType->param_end());
         params.insert(params.begin(), pointerType());
         args.insert(args.begin(), env);
-        llvm::Value* ret2 = mBuilder.CreateCall(llvmFunctionType, fptr, args);
+        llvm::FunctionType* llvmEnvFunctionType = llvm::FunctionType::get(
+            llvmFunctionType->getReturnType(), params, false);
+        llvm::Value* ret2
+            = mBuilder.CreateCall(llvmEnvFunctionType, fptr, args);
         mBuilder.CreateBr(end);
 
         mBuilder.SetInsertPoint(end);
@@ -1316,7 +1378,7 @@ void* CodeGenerator::visitCallExpression(CallExpression* expr)
      * If the call is direct, a simple LLVM 'call' instruction does the job.
      */
     else {
-        llvm::Value* callee;
+        llvm::Function* callee;
 
         if (dynamic_cast<FunctionExpression*>(expr->callee()) != nullptr) {
             FunctionExpression* fexpr = (FunctionExpression*)expr->callee();
@@ -1344,9 +1406,8 @@ void* CodeGenerator::visitCallExpression(CallExpression* expr)
                 instanceVal
                     = (llvm::Value*)instanceFunc->instance()->visit(this);
 
-                llvm::Type* instanceType = ((llvm::Function*)callee)
-                                               ->getFunctionType()
-                                               ->getParamType(0);
+                llvm::Type* instanceType
+                    = callee->getFunctionType()->getParamType(0);
 
                 if (instanceVal->getType() != instanceType) {
                     instanceVal
@@ -1357,10 +1418,7 @@ void* CodeGenerator::visitCallExpression(CallExpression* expr)
             args.insert(args.begin(), instanceVal);
         }
 
-        return mBuilder.CreateCall(
-            static_cast<llvm::FunctionType*>(
-                mTypeMapper.objectType(expr->callee()->type())),
-            callee, args);
+        return mBuilder.CreateCall(callee, args);
     }
 }
 
@@ -1562,7 +1620,7 @@ void* CodeGenerator::visitFloatingPointLiteral(FloatingPointLiteral* lit)
 void* CodeGenerator::visitFunctionExpression(FunctionExpression* expr)
 {
     auto funcType = mTypeMapper.valueType(expr->type());
-    auto funcVal = mBuilder.CreateAlloca(funcType);
+    auto funcVal = createLocal(funcType);
 
     auto fptrField = mBuilder.CreateStructGEP(funcType, funcVal, 0);
     auto fptr = llfunction(expr->target());
@@ -1578,15 +1636,14 @@ void* CodeGenerator::visitFunctionExpression(FunctionExpression* expr)
 void* CodeGenerator::visitFunctionParameterExpression(
     FunctionParameterExpression* expr)
 {
-    return mFunction->getValueSymbolTable()->lookup(
-        mangledName(expr->target()));
+    return mValues.lookup(expr->target());
 }
 
 void* CodeGenerator::visitInstanceFunctionExpression(
     InstanceFunctionExpression* expr)
 {
     auto funcType = mTypeMapper.valueType(expr->type());
-    auto funcVal = mBuilder.CreateAlloca(funcType);
+    auto funcVal = createLocal(funcType);
 
     auto fptrField = mBuilder.CreateStructGEP(funcType, funcVal, 0);
     auto fptr = llfunction(expr->target());
@@ -1604,43 +1661,26 @@ void* CodeGenerator::visitInstanceFunctionExpression(
 void* CodeGenerator::visitInstanceVariableExpression(
     InstanceVariableExpression* expr)
 {
-    bool tmp = mLValue;
-    mLValue = true;
-    llvm::Value* instanceVal = (llvm::Value*)expr->instance()->visit(this);
-    mLValue = tmp;
-
     UserDefinedType* utype
         = dynamic_cast<UserDefinedType*>(expr->instance()->type());
 
     assert(utype != nullptr);
 
     /*
-     * If the instance's type is a class, we need to retrieve the correct
-     * instance data pointer fist (see classPrivate()).
+     * A class instance is a pointer to its object, while a struct instance
+     * must be addressed as lvalue to get a pointer to its fields.
      */
-    if (auto classType = dynamic_cast<ClassType*>(utype)) {
-        instanceVal = createGetInstanceData(instanceVal, classType);
-    }
+    bool tmp = mLValue;
+    mLValue = dynamic_cast<StructType*>(utype) != nullptr;
+    llvm::Value* instanceVal = (llvm::Value*)expr->instance()->visit(this);
+    mLValue = tmp;
 
     /*
-     * To retrieve the right field from the struct or class, we need to know
-     * its index. Because the order of fields in the representing LLVM
-     * struct is the same as the instance variable declaration order in the
-     * Soya struct body, we get the index by looking where the variable to
-     * retrieve is placed in the struct's or class' body.
+     * The instance variables of the instance's class or struct, including
+     * those inherited from base classes, are fields of a single LLVM
+     * struct (see LLVMTypeMapper::objectType()).
      */
-
-    int index = 0;
-
-    for (DeclarationBlock::declarations_iterator it
-        = utype->body()->declarations_begin();
-        it != utype->body()->declarations_end(); it++) {
-        if ((*it)->declaredEntity() == expr->target()) {
-            break;
-        } else {
-            index++;
-        }
-    }
+    unsigned index = mTypeMapper.fieldIndex(expr->target());
 
     /*
      * Now that we have the index, we can retrieve the right field, using
@@ -1740,7 +1780,7 @@ void* CodeGenerator::visitObjectCreationExpression(
                 = mBuilder.CreateCall(llallocator((ClassType*)expr->type()));
         } else {
             instance
-                = mBuilder.CreateAlloca(mTypeMapper.valueType(expr->type()));
+                = createLocal(mTypeMapper.valueType(expr->type()));
         }
 
         args.push_back(instance);
@@ -1766,16 +1806,24 @@ void* CodeGenerator::visitObjectCreationExpression(
 
 void* CodeGenerator::visitThisExpression(ThisExpression* expr)
 {
-    return mFunction->getValueSymbolTable()->lookup("this");
+    /*
+     * The instance is passed as first argument (see llfunction()).
+     */
+    return &*mFunction->arg_begin();
 }
 
 void* CodeGenerator::visitVariableExpression(VariableExpression* expr)
 {
-    std::string name = mangledName(expr->target());
-    llvm::Value* ret = mFunction->getValueSymbolTable()->lookup(name);
+    llvm::Value* ret = mValues.lookup(expr->target());
 
+    /*
+     * A variable without value is a global variable declared later in the
+     * module, or in another module. Local variables and parameters always
+     * have a value once their declaration is visited.
+     */
     if (ret == nullptr) {
-        ret = mLLVMModule->getGlobalVariable(name);
+        assert(dynamic_cast<Module*>(expr->target()->parent()) != nullptr);
+        ret = llglobal(expr->target());
     }
 
     if (!mLValue) {
@@ -9,7 +9,9 @@
 #ifndef SOYA_CODE_GENERATOR_H_
 #define SOYA_CODE_GENERATOR_H_
 
+#include "Backend.h"
 #include "LLVMTypeMapper.h"
+#include "mangling.h"
 
 #include <filesystem>
 #include <stdint.h>
@@ -20,6 +22,7 @@
 #include <ast/NodeList.h>
 #include <ast/UserDefinedType.h>
 #include <ast/Visitor.h>
+#include <llvm/ADT/DenseMap.h>
 #include <llvm/IR/Function.h>
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/IR/Module.h>
@@ -40,10 +43,38 @@ public:
      */
     CodeGenerator(Module* module);
 
+    /**
+     * Returns the Backend used to optimize the generated LLVM IR and to
+     * turn it into native code.
+     *
+     * @return  The code generator's backend.
+     */
+    const Backend& backend() const;
+
+    /**
+     * Sets the Backend used to optimize the generated LLVM IR and to turn
+     * it into native code. The default is a Backend for the generic host
+     * CPU without optimization.
+     *
+     * @param backend  The backend.
+     */
+    void setBackend(const Backend& backend);
+
     void toLLVMAssembly(path destination, std::error_code& error);
 
     void toObjectCode(path destination, std::error_code& error);
 
+    /**
+     * Writes the module as LLVM bitcode to be optimized and compiled
+     * together with other modules at link time (see -flto). The module is
+     * prepared for the backend's target and, when optimizing, run through
+     * the LTO pre-link pipeline.
+     *
+     * @param destination  The bitcode file to write.
+     * @param error        Set if the file cannot be written.
+     */
+    void toBitcode(path destination, std::error_code& error);
+
 protected:
     /**
      * Visits an ArrayCreationExpression.
@@ -362,12 +393,40 @@ private:
     llvm::LLVMContext mContext;
     llvm::IRBuilder<> mBuilder;
     llvm::Module* mLLVMModule;
+    NameMangler mMangler;
     LLVMTypeMapper mTypeMapper;
 
     llvm::Function* mFunction;
     llvm::Function* mInitFunction;
     DeclaredEntity* mEnclosing;
     bool mLValue;
+    Backend mBackend;
+
+    /*
+     * A block being visited, together with the function it belongs to
+     * and the stack slots created in it with createLocal(), whose
+     * lifetime ends with the block.
+     */
+    struct BlockLocals {
+        llvm::Function* function;
+        std::vector<llvm::AllocaInst*> locals;
+    };
+
+    std::vector<BlockLocals> mBlockLocals;
+
+    /*
+     * The LLVM values of the variables and function parameters for which
+     * code has been generated: stack slots of local variables, global
+     * variables and function arguments.
+     */
+    llvm::DenseMap<const NamedEntity*, llvm::Value*> mValues;
+
+    /**
+     * Generates the LLVM module for the Module passed to the constructor.
+     *
+     * @return  The generated LLVM module.
+     */
+    llvm::Module* generate();
 
     /**
      * Visits an LLValueExpression (a CodeGenerator-only node class).
@@ -377,6 +436,15 @@ private:
      */
     void* visitLLValueExpression(LLValueExpression* expr);
 
+    /**
+     * Returns the mangled symbol name of the passed entity, which is
+     * computed only once per entity (see NameMangler).
+     *
+     * @param entity  The named entity.
+     * @return        The mangled name.
+     */
+    const std::string& mangledName(NamedEntity* entity);
+
     /**
      * Returns the default pointer type.
      */
@@ -400,6 +468,17 @@ private:
      */
     llvm::Constant* defaultValue(Type* type);
 
+    /**
+     * Returns the LLVM global variable representing the passed global
+     * Soya variable. If it has not been created yet, because the variable
+     * is declared later in the module or in another module, it is declared
+     * as external global variable.
+     *
+     * @param var  The global variable.
+     * @return     The corresponding LLVM global variable.
+     */
+    llvm::GlobalVariable* llglobal(Variable* var);
+
     /**
      * Returns the llvm::Function* instance representing the passed Soya
      * function. If no such instance already exists, it is created and
@@ -432,24 +511,6 @@ private:
      */
     llvm::Function* llallocator(ClassType* type);
 
-    /*
-     * Given an LLVM value representing a class instance reference,
-     * return a value that points to the data of that instance specific
-     * to the passed class of which the instance is composed (that is,
-     * the instance's concrete class or any of its base classes). The
-     * pointed-to data is represented as an LLVM struct as returned
-     * by llstructtype() with the passed class type as argument.
-     *
-     * @param instance  The instance value.
-     * @param type      The class type.
-     * @param lvalue    Whether the returned value should be an Lvalue
-     *                  (needed for class instance initialization).
-     * @return          An LLVM pointer value which points to the
-     *                  class-specific data of the instance.
-     */
-    llvm::Value* createGetInstanceData(
-        llvm::Value* instance, ClassType* type, bool lvalue = false);
-
     /**
      * Generates the initializer function (see llinitializer()) for the
      * passed class or struct type.
@@ -487,6 +548,30 @@ private:
     llvm::Value* createBuiltInPropertyCall(
         Expression* operand, const Name& propertyName);
 
+    /**
+     * Creates a stack slot of the passed type in the current function's
+     * entry block, where LLVM can promote it to registers, and marks the
+     * start of its lifetime at the current insertion point. The lifetime
+     * ends with the innermost block being visited, so that a slot created
+     * in a loop body is neither allocated anew in every iteration nor
+     * considered live across iterations.
+     *
+     * @param type  The slot's type.
+     * @param name  The slot's name.
+     * @return      The LLVM 'alloca' instruction creating the slot.
+     */
+    llvm::AllocaInst* createLocal(
+        llvm::Type* type, const std::string& name = "");
+
+    /**
+     * Creates an unconditional branch to the passed basic block, unless
+     * the current block has been terminated already (by a return
+     * statement, for instance).
+     *
+     * @param dest  The branch's destination.
+     */
+    void createBranch(llvm::BasicBlock* dest);
+
     /**
      * Creates instructions that determine the object size of the passed
      * LLVM type. The resulting size value is then returned.
@@ -9,8 +9,8 @@
 #include "LLVMTypeMapper.h"
 
 #include "ast/ast.h"
-#include "mangling.h"
 
+#include <cassert>
 #include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/Type.h>
 
@@ -18,10 +18,11 @@ using namespace soyac::ast;
 
 namespace soyac::codegen {
 
-LLVMTypeMapper::LLVMTypeMapper(
-    llvm::LLVMContext& context, const llvm::DataLayout& dataLayout)
+LLVMTypeMapper::LLVMTypeMapper(llvm::LLVMContext& context,
+    const llvm::DataLayout& dataLayout, NameMangler& mangler)
     : mContext(context)
     , mDataLayout(dataLayout)
+    , mMangler(mangler)
 {
 }
 
@@ -60,26 +61,7 @@ llvm::Type* LLVMTypeMapper::valueType(Type* type)
     }
 
     if (auto structType = dynamic_cast<StructType*>(type)) {
-        auto name = mangledName(structType);
-        auto llvmType = llvm::StructType::getTypeByName(mContext, name);
-
-        if (!llvmType) {
-            UserDefinedType* utype = (UserDefinedType*)type;
-            std::vector<llvm::Type*> memberTypes;
-
-            for (DeclarationBlock::declarations_iterator it
-                = utype->body()->declarations_begin();
-                it != utype->body()->declarations_end(); ++it) {
-                if (auto var
-                    = dynamic_cast<Variable*>((*it)->declaredEntity())) {
-                    memberTypes.push_back(valueType(var->type()));
-                }
-            }
-
-            llvmType = llvm::StructType::create(memberTypes);
-        }
-
-        return llvmType;
+        return getStructOrClassLayoutType(structType);
     }
 
     if (dynamic_cast<FunctionType*>(type)) {
@@ -96,39 +78,11 @@ llvm::Type* LLVMTypeMapper::valueType(Type* type)
      * Class Types
      */
     else if (dynamic_cast<ClassType*>(type) != nullptr) {
-        llvm::Type* llvmType
-            = llvm::StructType::getTypeByName(mContext, mangledName(type));
-
-        if (llvmType == nullptr) {
-            /*
-             * A class instance is represented by a pointer to an array,
-             * where each element in return points to the instance data
-             * of each class the instance is composed of (that is, the
-             * instance's class and all base classes).
-             */
-
-            int numClasses = 1;
-
-            ClassType* ctype = (ClassType*)type;
-
-            while (ctype->baseClass() != nullptr) {
-                numClasses++;
-                ctype = (ClassType*)ctype->baseClass();
-            }
-
-            llvm::Type* i8 = llvm::Type::getInt8Ty(mContext);
-            llvm::Type* i8p = llvm::PointerType::getUnqual(i8);
-
-            llvm::Type* refType = llvm::PointerType::getUnqual(
-                llvm::ArrayType::get(i8p, numClasses));
-
-            llvm::StructType* wrapperStruct = llvm::StructType::get(refType);
-
-            wrapperStruct->setName(mangledName(type));
-            llvmType = wrapperStruct;
-        }
-
-        return llvmType;
+        /*
+         * A class instance is referenced by a pointer to its object,
+         * which is laid out as described in objectType().
+         */
+        return llvm::PointerType::getUnqual(mContext);
     }
 
     /*
@@ -164,40 +118,8 @@ llvm::Type* LLVMTypeMapper::objectType(Type* type)
         return getStructOrClassLayoutType(structType);
     }
 
-    if (dynamic_cast<ClassType*>(type) != nullptr) {
-        llvm::Type* llvmType
-            = llvm::StructType::getTypeByName(mContext, mangledName(type));
-
-        if (llvmType == nullptr) {
-            /*
-             * A class instance is represented by a pointer to an array,
-             * where each element in return points to the instance data
-             * of each class the instance is composed of (that is, the
-             * instance's class and all base classes).
-             */
-
-            int numClasses = 1;
-
-            ClassType* ctype = (ClassType*)type;
-
-            while (ctype->baseClass() != nullptr) {
-                numClasses++;
-                ctype = (ClassType*)ctype->baseClass();
-            }
-
-            llvm::Type* i8 = llvm::Type::getInt8Ty(mContext);
-            llvm::Type* i8p = llvm::PointerType::getUnqual(i8);
-
-            llvm::Type* refType = llvm::PointerType::getUnqual(
-                llvm::ArrayType::get(i8p, numClasses));
-
-            llvm::StructType* wrapperStruct = llvm::StructType::get(refType);
-
-            wrapperStruct->setName(mangledName(type));
-            llvmType = wrapperStruct;
-        }
-
-        return llvmType;
+    if (auto classType = dynamic_cast<ClassType*>(type)) {
+        return getStructOrClassLayoutType(classType);
     }
 
     /*
@@ -208,31 +130,63 @@ llvm::Type* LLVMTypeMapper::objectType(Type* type)
     }
 }
 
+unsigned LLVMTypeMapper::fieldIndex(Variable* var)
+{
+    auto it = mFieldIndices.find(var);
+
+    if (it == mFieldIndices.end()) {
+        auto type = static_cast<UserDefinedType*>(var->parent());
+        getStructOrClassLayoutType(type);
+        it = mFieldIndices.find(var);
+    }
+
+    assert(it != mFieldIndices.end());
+    return it->second;
+}
+
 llvm::Type* LLVMTypeMapper::getPointerSizeType()
 {
     return mDataLayout.getIntPtrType(mContext);
 }
 
-llvm::Type* LLVMTypeMapper::getStructOrClassLayoutType(UserDefinedType* type)
+llvm::StructType* LLVMTypeMapper::getStructOrClassLayoutType(
+    UserDefinedType* type)
 {
-    auto name = mangledName(type);
-    auto llvmType = llvm::StructType::getTypeByName(mContext, name);
-
-    if (!llvmType) {
-        std::vector<llvm::Type*> memberTypes;
-
-        for (DeclarationBlock::declarations_iterator it
-            = type->body()->declarations_begin();
-            it != type->body()->declarations_end(); ++it) {
-            if (auto var = dynamic_cast<Variable*>((*it)->declaredEntity())) {
-                memberTypes.push_back(valueType(var->type()));
-            }
+    auto it = mLayoutTypes.find(type);
+
+    if (it != mLayoutTypes.end()) {
+        return it->second;
+    }
+
+    std::vector<llvm::Type*> memberTypes;
+
+    /*
+     * The instance variables of a class's base classes form a prefix of
+     * its layout, so that a pointer to an object can be used as a pointer
+     * to any of its base classes' objects.
+     */
+    if (auto classType = dynamic_cast<ClassType*>(type)) {
+        if (auto base = static_cast<ClassType*>(classType->baseClass())) {
+            auto baseType = getStructOrClassLayoutType(base);
+            memberTypes.assign(
+                baseType->element_begin(), baseType->element_end());
         }
+    }
 
-        llvmType = llvm::StructType::create(memberTypes);
+    for (DeclarationBlock::declarations_iterator it
+        = type->body()->declarations_begin();
+        it != type->body()->declarations_end(); ++it) {
+        if (auto var = dynamic_cast<Variable*>((*it)->declaredEntity())) {
+            mFieldIndices[var] = memberTypes.size();
+            memberTypes.push_back(valueType(var->type()));
+        }
     }
 
+    auto llvmType = llvm::StructType::create(
+        mContext, memberTypes, mMangler.mangledName(type));
+    mLayoutTypes[type] = llvmType;
+
     return llvmType;
 }
 
-} // namespace soyac::codegen
\ No newline at end of file
+} // namespace soyac::codegen
@@ -11,6 +11,10 @@
 
 #include "ast/Type.h"
 #include "ast/UserDefinedType.h"
+#include "ast/Variable.h"
+#include "mangling.h"
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/IR/DerivedTypes.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Type.h>
 
@@ -23,8 +27,8 @@ namespace soyac::codegen {
  */
 class LLVMTypeMapper {
 public:
-    LLVMTypeMapper(
-        llvm::LLVMContext& context, const llvm::DataLayout& dataLayout);
+    LLVMTypeMapper(llvm::LLVMContext& context,
+        const llvm::DataLayout& dataLayout, NameMangler& mangler);
 
     /**
      * Given a Soya type, returns its value representation as an LLVM type.
@@ -45,13 +49,38 @@ public:
      */
     llvm::Type* objectType(ast::Type* type);
 
+    /**
+     * Returns the index of the passed instance variable in the LLVM struct
+     * type describing the data layout of its struct or class (see
+     * objectType()). The layout of a class starts with the instance
+     * variables of its base classes, followed by its own in declaration
+     * order. Field indices are computed along with the layout of their
+     * struct or class, so looking one up takes constant time.
+     *
+     * @param var  The instance variable.
+     * @return     The variable's field index.
+     */
+    unsigned fieldIndex(ast::Variable* var);
+
 private:
     llvm::LLVMContext& mContext;
     const llvm::DataLayout& mDataLayout;
+    NameMangler& mMangler;
+    llvm::DenseMap<const ast::UserDefinedType*, llvm::StructType*>
+        mLayoutTypes;
+    llvm::DenseMap<const ast::Variable*, unsigned> mFieldIndices;
 
     llvm::Type* getPointerSizeType();
 
-    llvm::Type* getStructOrClassLayoutType(ast::UserDefinedType* type);
+    /**
+     * Returns the LLVM struct type describing the data layout of the
+     * passed struct or class, creating it on first request. The field
+     * indices of the type's instance variables are recorded alongside.
+     *
+     * @param type  The struct or class.
+     * @return      The layout type.
+     */
+    llvm::StructType* getStructOrClassLayoutType(ast::UserDefinedType* type);
 };
 
 } // namespace soyac::codegen
@@ -16,7 +16,7 @@ namespace soyac::codegen {
 
 using namespace ast;
 
-static std::string mangledSimpleName(std::string name)
+static std::string mangledSimpleName(const std::string& name)
 {
     if (name == CONSTRUCTOR_NAME) {
         return "constructor";
@@ -25,7 +25,30 @@ static std::string mangledSimpleName(std::string name)
     }
 }
 
-std::string mangledName(NamedEntity* entity)
+/**
+ * Appends the passed identifier to a mangled name, preceded by its length.
+ *
+ * @param result      The mangled name.
+ * @param identifier  The identifier.
+ */
+static void append_identifier(
+    std::string& result, const std::string& identifier)
+{
+    std::string sname = mangledSimpleName(identifier);
+    result += std::to_string(sname.length());
+    result += sname;
+}
+
+/**
+ * Computes the mangled name of the passed entity (see mangledName()). If a
+ * NameMangler is given, the mangled names of function parameter types are
+ * requested from it.
+ *
+ * @param entity   The named entity.
+ * @param mangler  The NameMangler, or null.
+ * @return         The mangled name.
+ */
+static std::string mangle(NamedEntity* entity, NameMangler* mangler)
 {
     /*
      * If the entity has no qualified name, it is a local entity; in this
@@ -73,28 +96,31 @@ std::string mangledName(NamedEntity* entity)
      * - The mangled name of the "ulong" type is "_ul".
      */
     Name name = entity->qualifiedName();
-    std::stringstream result;
-
-    result << "_";
+    std::string result = "_";
 
     auto it = name.identifiers_begin();
 
     /*
-     * Mangle the module identifier.
+     * Mangle the module identifier, each "::"-separated part of which is
+     * mangled as an identifier of its own.
      */
-    if (!Module::getProgram() || *it != Module::getProgram()->name().str()) {
-        char* modname = new char[(*it).length() + 1];
-        strcpy(modname, (*it).c_str());
+    if (!Module::getProgram() || *it != Module::getProgram()->name().first()) {
+        const std::string& modname = it->str();
+        std::string::size_type start = 0;
 
-        const char* mID = std::strtok(modname, ":");
+        while (start < modname.length()) {
+            std::string::size_type end = modname.find(':', start);
 
-        do {
-            std::string sname = mangledSimpleName(mID);
-            result << sname.length();
-            result << sname;
-        } while ((mID = std::strtok(0, ":")) != 0);
+            if (end == std::string::npos) {
+                end = modname.length();
+            }
+
+            if (end > start) {
+                append_identifier(result, modname.substr(start, end - start));
+            }
 
-        delete[] modname;
+            start = end + 1;
+        }
     }
 
     ++it;
@@ -103,12 +129,10 @@ std::string mangledName(NamedEntity* entity)
      * Mangle the remaining identifiers if the entity is not a module.
      */
     if (!dynamic_cast<Module*>(entity)) {
-        result << '_';
+        result += '_';
 
         for (; it != name.identifiers_end(); ++it) {
-            std::string sname = mangledSimpleName(*it);
-            result << sname.length();
-            result << sname;
+            append_identifier(result, it->str());
         }
     }
 
@@ -121,32 +145,50 @@ std::string mangledName(NamedEntity* entity)
             Type* paramType = (*it)->type();
 
             if (paramType == TYPE_BOOL) {
-                result << "_b";
+                result += "_b";
             } else if (paramType == TYPE_CHAR) {
-                result << "_c";
+                result += "_c";
             } else if (paramType == TYPE_FLOAT) {
-                result << "_f";
+                result += "_f";
             } else if (paramType == TYPE_DOUBLE) {
-                result << "_d";
+                result += "_d";
             } else if (paramType == TYPE_LONG) {
-                result << "_l";
+                result += "_l";
             } else if (paramType == TYPE_ULONG) {
-                result << "_ul";
+                result += "_ul";
             } else if (auto i = dynamic_cast<IntegerType*>(paramType)) {
-                result << (i->isSigned() ? "_i" : "_u");
+                result += (i->isSigned() ? "_i" : "_u");
 
                 if (paramType != TYPE_INT && paramType != TYPE_UINT) {
-                    result << i->size();
+                    result += std::to_string(i->size());
                 }
             }
 
-            else {
-                result << mangledName(paramType);
+            else if (mangler != nullptr) {
+                result += mangler->mangledName(paramType);
+            } else {
+                result += mangle(paramType, nullptr);
             }
         }
     }
 
-    return result.str();
+    return result;
+}
+
+std::string mangledName(NamedEntity* entity)
+{
+    return mangle(entity, nullptr);
+}
+
+const std::string& NameMangler::mangledName(NamedEntity* entity)
+{
+    auto it = mNames.find(entity);
+
+    if (it == mNames.end()) {
+        it = mNames.emplace(entity, mangle(entity, this)).first;
+    }
+
+    return it->second;
 }
 
 } // namespace soyac::codegen
@@ -11,6 +11,7 @@
 
 #include "ast/ast.h"
 #include <string>
+#include <unordered_map>
 
 namespace soyac::codegen
 {
@@ -24,6 +25,28 @@ namespace soyac::codegen
 std::string
 mangledName(ast::NamedEntity* entity);
 
+/**
+ * Computes the mangled symbol names of entities like mangledName(), but
+ * only once per entity: every name is remembered for later requests.
+ * A NameMangler is meant to be used by a single compilation (and thus,
+ * a single thread) only.
+ */
+class NameMangler
+{
+public:
+    /**
+     * Returns the mangled symbol name of the passed entity.
+     *
+     * @param entity  The named entity.
+     * @return        The mangled name, which stays valid as long as the
+     *                NameMangler exists.
+     */
+    const std::string& mangledName(ast::NamedEntity* entity);
+
+private:
+    std::unordered_map<const ast::NamedEntity*, std::string> mNames;
+};
+
 } // namespace soyac::codegen
 
 #endif // MANGLING_H
@@ -0,0 +1,237 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "PhaseTimer.h"
+
+namespace soyac {
+
+bool PhaseTimer::sEnabled = false;
+std::chrono::steady_clock::time_point PhaseTimer::sStartTime
+    = std::chrono::steady_clock::now();
+std::vector<PhaseTimer::Measurement> PhaseTimer::sMeasurements;
+std::mutex PhaseTimer::sMeasurementsMutex;
+
+static thread_local std::string tCurrentFile;
+
+/**
+ * Returns a number identifying the calling thread, counting from 0 in the
+ * order in which threads first measure a phase.
+ *
+ * @return  The thread's number.
+ */
+static unsigned thread_number()
+{
+    static std::atomic<unsigned> numThreads(0);
+    static thread_local unsigned number = numThreads++;
+    return number;
+}
+
+/**
+ * Returns the CPU time consumed by the calling thread in microseconds.
+ *
+ * @return  The thread's CPU time.
+ */
+static std::int64_t thread_cpu_time()
+{
+    timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return (std::int64_t)time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+/**
+ * Returns the peak resident set size of the compiler process in kilobytes.
+ *
+ * @return  The peak resident set size.
+ */
+static long peak_rss()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/**
+ * Writes the passed string to a stream as JSON string literal.
+ *
+ * @param out  The stream.
+ * @param str  The string.
+ */
+static void write_json_string(std::ostream& out, const std::string& str)
+{
+    out << '"';
+
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if ((unsigned char)c < 0x20) {
+            char escape[8];
+            std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+            out << escape;
+        } else {
+            out << c;
+        }
+    }
+
+    out << '"';
+}
+
+PhaseTimer::PhaseTimer(const char* phase)
+    : mPhase(phase)
+    , mCPUStart(0)
+{
+    if (sEnabled) {
+        mStart = std::chrono::steady_clock::now();
+        mCPUStart = thread_cpu_time();
+    }
+}
+
+PhaseTimer::~PhaseTimer()
+{
+    if (!sEnabled) {
+        return;
+    }
+
+    std::chrono::steady_clock::time_point end
+        = std::chrono::steady_clock::now();
+
+    Measurement m;
+    m.phase = mPhase;
+    m.file = tCurrentFile;
+    m.thread = thread_number();
+    m.start = std::chrono::duration_cast<std::chrono::microseconds>(
+        mStart - sStartTime)
+                  .count();
+    m.wallTime
+        = std::chrono::duration_cast<std::chrono::microseconds>(end - mStart)
+              .count();
+    m.cpuTime = thread_cpu_time() - mCPUStart;
+    m.peakRSS = peak_rss();
+
+    std::lock_guard<std::mutex> lock(sMeasurementsMutex);
+    sMeasurements.push_back(m);
+}
+
+void PhaseTimer::setEnabled(bool enabled) { sEnabled = enabled; }
+
+bool PhaseTimer::isEnabled() { return sEnabled; }
+
+void PhaseTimer::setCurrentFile(const std::string& file)
+{
+    tCurrentFile = file;
+}
+
+void PhaseTimer::showReport(std::ostream& out)
+{
+    /*
+     * Sum up the measurements per file and phase, with the empty file
+     * standing for the totals, keeping the order in which files and
+     * phases first occurred.
+     */
+    struct Row {
+        std::string file;
+        const char* phase;
+        std::int64_t wallTime;
+        std::int64_t cpuTime;
+        long peakRSS;
+    };
+
+    std::lock_guard<std::mutex> lock(sMeasurementsMutex);
+    std::vector<std::string> files(1);
+    std::vector<Row> rows;
+
+    for (const Measurement& m : sMeasurements) {
+        if (std::find(files.begin(), files.end(), m.file) == files.end()) {
+            files.push_back(m.file);
+        }
+
+        for (const std::string& file : { std::string(), m.file }) {
+            std::vector<Row>::iterator it = std::find_if(
+                rows.begin(), rows.end(), [&](const Row& row) {
+                    return row.file == file
+                        && std::strcmp(row.phase, m.phase) == 0;
+                });
+
+            if (it == rows.end()) {
+                rows.push_back({ file, m.phase, 0, 0, 0 });
+                it = rows.end() - 1;
+            }
+
+            it->wallTime += m.wallTime;
+            it->cpuTime += m.cpuTime;
+            it->peakRSS = std::max(it->peakRSS, m.peakRSS);
+
+            if (m.file.empty()) {
+                break;
+            }
+        }
+    }
+
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(4);
+
+    for (const std::string& file : files) {
+        std::int64_t wallTime = 0;
+        std::int64_t cpuTime = 0;
+
+        out << "===" << std::string(69, '-') << "===" << std::endl
+            << "  " << (file.empty() ? "Total" : file) << std::endl
+            << "===" << std::string(69, '-') << "===" << std::endl
+            << "    Wall (s)     CPU (s)  Peak RSS (MB)  Phase" << std::endl;
+
+        for (const Row& row : rows) {
+            if (row.file != file) {
+                continue;
+            }
+
+            out << std::setw(12) << row.wallTime / 1e6 << std::setw(12)
+                << row.cpuTime / 1e6 << std::setw(15) << row.peakRSS / 1024.0
+                << "  " << row.phase << std::endl;
+
+            wallTime += row.wallTime;
+            cpuTime += row.cpuTime;
+        }
+
+        out << std::setw(12) << wallTime / 1e6 << std::setw(12)
+            << cpuTime / 1e6 << std::setw(15) << "" << "  (total)" << std::endl
+            << std::endl;
+    }
+
+    out.flags(flags);
+}
+
+void PhaseTimer::writeTrace(std::ostream& out)
+{
+    std::lock_guard<std::mutex> lock(sMeasurementsMutex);
+
+    out << "{\"traceEvents\":[";
+
+    for (std::size_t i = 0; i < sMeasurements.size(); i++) {
+        const Measurement& m = sMeasurements[i];
+
+        out << (i > 0 ? ",\n" : "\n") << "{\"name\":";
+        write_json_string(out, m.phase);
+        out << ",\"cat\":\"soyac\",\"ph\":\"X\",\"pid\":1,\"tid\":" << m.thread
+            << ",\"ts\":" << m.start << ",\"dur\":" << m.wallTime
+            << ",\"args\":{\"file\":";
+        write_json_string(out, m.file);
+        out << ",\"cpu_us\":" << m.cpuTime << ",\"peak_rss_kb\":" << m.peakRSS
+            << "}}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+} // namespace soyac
@@ -0,0 +1,115 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_PHASE_TIMER_H_
+#define SOYA_PHASE_TIMER_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace soyac {
+
+/**
+ * Measures the time spent in a compiler phase, such as parsing or code
+ * generation, from its construction to its destruction. The measurements
+ * of all PhaseTimers are collected, attributed to the file processed by
+ * the measuring thread (see setCurrentFile()), and can be shown as a
+ * report or written as trace file.
+ *
+ * Unless enabled with setEnabled(), PhaseTimers measure nothing.
+ */
+class PhaseTimer {
+public:
+    /**
+     * Starts measuring a phase.
+     *
+     * @param phase  The phase's name.
+     */
+    PhaseTimer(const char* phase);
+
+    /**
+     * Stops measuring the phase and records the measurement.
+     */
+    ~PhaseTimer();
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+    /**
+     * Enables or disables the measurement of phases. Must not be called
+     * while phases are measured.
+     *
+     * @param enabled  Whether phases should be measured.
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * Returns @c true if phases are measured.
+     *
+     * @return  Whether phases are measured.
+     */
+    static bool isEnabled();
+
+    /**
+     * Sets the file processed by the calling thread, to which the phases
+     * measured by the thread are attributed.
+     *
+     * @param file  The file's name, or an empty string if the thread
+     *              processes no particular file.
+     */
+    static void setCurrentFile(const std::string& file);
+
+    /**
+     * Writes a report of the recorded measurements to the passed stream:
+     * the wall-clock and CPU time spent in every phase, in total and per
+     * file, and the peak resident set size of the compiler at the end of
+     * the phase.
+     *
+     * @param out  The stream to write the report to.
+     */
+    static void showReport(std::ostream& out);
+
+    /**
+     * Writes the recorded measurements to the passed stream in the Chrome
+     * trace event format, in which parallel phases are shown per thread.
+     *
+     * @param out  The stream to write the trace to.
+     */
+    static void writeTrace(std::ostream& out);
+
+private:
+    /**
+     * A recorded measurement.
+     */
+    struct Measurement {
+        const char* phase;
+        std::string file;
+        unsigned thread;
+        std::int64_t start;
+        std::int64_t wallTime;
+        std::int64_t cpuTime;
+        long peakRSS;
+    };
+
+    static bool sEnabled;
+    static std::chrono::steady_clock::time_point sStartTime;
+    static std::vector<Measurement> sMeasurements;
+    static std::mutex sMeasurementsMutex;
+
+    const char* mPhase;
+    std::chrono::steady_clock::time_point mStart;
+    std::int64_t mCPUStart;
+};
+
+} // namespace soyac
+
+#endif
@@ -0,0 +1,248 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <tuple>
+#include <unistd.h>
+#include <vector>
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Support/SHA256.h>
+
+#include "CompilationCache.h"
+#include "config.h"
+
+using std::filesystem::path;
+
+namespace soyac {
+namespace driver {
+
+std::map<ast::Module*, std::string> CompilationCache::sInterfaceHashes;
+std::mutex CompilationCache::sInterfaceHashesMutex;
+std::atomic<unsigned> CompilationCache::sHits(0);
+std::atomic<unsigned> CompilationCache::sMisses(0);
+std::atomic<std::uintmax_t> CompilationCache::sBytesRead(0);
+std::atomic<std::uintmax_t> CompilationCache::sBytesWritten(0);
+std::atomic<std::uintmax_t> CompilationCache::sBytesEvicted(0);
+
+/**
+ * Returns the path of the cache entry with the passed key and extension.
+ *
+ * @param key        The cache key.
+ * @param extension  The extension of the cached file.
+ * @return           The cache entry's path.
+ */
+static path entry_path(const std::string& key, const path& extension)
+{
+    path entry = path(config::cacheDirectory) / key;
+    entry += extension;
+    return entry;
+}
+
+/**
+ * Copies a file by writing a temporary file first and renaming it
+ * afterwards, so that a compiler process reading the destination in
+ * parallel never sees a partially written file.
+ *
+ * @param from  The file to copy.
+ * @param to    The destination.
+ * @return      The number of bytes copied, or 0 if copying failed.
+ */
+static std::uintmax_t copy_file_atomically(const path& from, const path& to)
+{
+    path tempPath(to);
+    tempPath += ".tmp" + std::to_string(getpid());
+
+    std::error_code error;
+    std::filesystem::copy_file(from, tempPath,
+        std::filesystem::copy_options::overwrite_existing, error);
+
+    if (!error) {
+        std::filesystem::rename(tempPath, to, error);
+    }
+
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        return 0;
+    }
+
+    std::uintmax_t size = std::filesystem::file_size(to, error);
+    return error ? 0 : size;
+}
+
+bool CompilationCache::isEnabled() { return !config::cacheDirectory.empty(); }
+
+std::string CompilationCache::hash(const std::string& data)
+{
+    return llvm::toHex(llvm::SHA256::hash(llvm::ArrayRef<uint8_t>(
+                           (const uint8_t*)data.data(), data.size())),
+        true);
+}
+
+std::string CompilationCache::fileHash(const path& file)
+{
+    std::ifstream in(file, std::ios::binary);
+    std::stringstream contents;
+    contents << in.rdbuf();
+
+    if (!in) {
+        return std::string("");
+    }
+
+    return hash(contents.str());
+}
+
+bool CompilationCache::retrieve(
+    const std::string& key, const path& outputFile, const path& interfaceFile)
+{
+    path outputEntry = entry_path(key, outputFile.extension());
+    path interfaceEntry = entry_path(key, ".soyb");
+    std::error_code error;
+
+    if (!std::filesystem::exists(outputEntry, error)
+        || (!interfaceFile.empty()
+            && !std::filesystem::exists(interfaceEntry, error))) {
+        sMisses++;
+        return false;
+    }
+
+    std::uintmax_t outputSize = copy_file_atomically(outputEntry, outputFile);
+    std::uintmax_t interfaceSize = 0;
+
+    if (outputSize != 0 && !interfaceFile.empty()) {
+        interfaceSize = copy_file_atomically(interfaceEntry, interfaceFile);
+    }
+
+    if (outputSize == 0 || (!interfaceFile.empty() && interfaceSize == 0)) {
+        sMisses++;
+        return false;
+    }
+
+    /*
+     * Mark the entries as recently used, so that trim() keeps them.
+     */
+    std::filesystem::file_time_type now
+        = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(outputEntry, now, error);
+
+    if (!interfaceFile.empty()) {
+        std::filesystem::last_write_time(interfaceEntry, now, error);
+    }
+
+    sHits++;
+    sBytesRead += outputSize + interfaceSize;
+    return true;
+}
+
+void CompilationCache::store(
+    const std::string& key, const path& outputFile, const path& interfaceFile)
+{
+    std::error_code error;
+    std::filesystem::create_directories(config::cacheDirectory, error);
+
+    if (error) {
+        return;
+    }
+
+    /*
+     * Store the interface file first: retrieve() only looks for it if
+     * the output file exists.
+     */
+    if (!interfaceFile.empty()) {
+        std::uintmax_t size
+            = copy_file_atomically(interfaceFile, entry_path(key, ".soyb"));
+
+        if (size == 0) {
+            return;
+        }
+
+        sBytesWritten += size;
+    }
+
+    sBytesWritten += copy_file_atomically(
+        outputFile, entry_path(key, outputFile.extension()));
+}
+
+void CompilationCache::trim()
+{
+    std::vector<std::tuple<std::filesystem::file_time_type, std::uintmax_t,
+        path>>
+        entries;
+    std::uintmax_t totalSize = 0;
+    std::uintmax_t sizeLimit = (std::uintmax_t)config::cacheSizeLimit << 20;
+    std::error_code error;
+
+    for (std::filesystem::directory_iterator it(config::cacheDirectory, error);
+        !error && it != std::filesystem::directory_iterator();
+        it.increment(error)) {
+        /*
+         * Leave alone the temporary files of compiler processes storing
+         * entries right now.
+         */
+        if (!it->is_regular_file(error)
+            || it->path().extension().string().compare(0, 4, ".tmp") == 0) {
+            continue;
+        }
+
+        std::uintmax_t size = it->file_size(error);
+        std::filesystem::file_time_type time = it->last_write_time(error);
+
+        if (!error) {
+            entries.emplace_back(time, size, it->path());
+            totalSize += size;
+        }
+    }
+
+    if (totalSize <= sizeLimit) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    for (auto& [time, size, entry] : entries) {
+        if (totalSize <= sizeLimit) {
+            break;
+        }
+
+        if (std::filesystem::remove(entry, error)) {
+            totalSize -= size;
+            sBytesEvicted += size;
+        }
+    }
+}
+
+void CompilationCache::setInterfaceHash(
+    ast::Module* m, const std::string& hash)
+{
+    std::lock_guard<std::mutex> lock(sInterfaceHashesMutex);
+    sInterfaceHashes[m] = hash;
+}
+
+std::string CompilationCache::interfaceHash(ast::Module* m)
+{
+    std::lock_guard<std::mutex> lock(sInterfaceHashesMutex);
+    std::map<ast::Module*, std::string>::iterator it
+        = sInterfaceHashes.find(m);
+
+    return (it != sInterfaceHashes.end()) ? it->second : std::string("");
+}
+
+void CompilationCache::showStatistics()
+{
+    std::cerr << config::programName << ": compilation cache: " << sHits
+              << ((sHits == 1) ? " hit, " : " hits, ") << sMisses
+              << ((sMisses == 1) ? " miss, " : " misses, ") << sBytesRead
+              << " bytes read, " << sBytesWritten << " bytes written, "
+              << sBytesEvicted << " bytes evicted" << std::endl;
+}
+
+} // namespace driver
+} // namespace soyac
@@ -0,0 +1,132 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_COMPILATION_CACHE_H_
+#define SOYA_COMPILATION_CACHE_H_
+
+#include <ast/Module.h>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace soyac {
+namespace driver {
+
+/**
+ * Provides static methods for accessing the persistent compilation cache
+ * in config::cacheDirectory. The cache stores the files generated for a
+ * source file under a key which is the hash of everything the generated
+ * code depends on (see FileProcessor), so that a source file compiled
+ * before with the same options and against the same module interfaces
+ * need not be compiled again.
+ *
+ * All methods may be called by several threads at once.
+ */
+class CompilationCache {
+public:
+    /**
+     * Returns @c true if a cache directory is configured.
+     *
+     * @return  Whether the cache is enabled.
+     */
+    static bool isEnabled();
+
+    /**
+     * Returns the hexadecimal SHA-256 hash of the passed data.
+     *
+     * @param data  The data to hash.
+     * @return      The data's hash.
+     */
+    static std::string hash(const std::string& data);
+
+    /**
+     * Reads the passed file and returns the hash of its contents, or an
+     * empty string if the file cannot be read.
+     *
+     * @param file  The file to hash.
+     * @return      The file's hash, or an empty string.
+     */
+    static std::string fileHash(const std::filesystem::path& file);
+
+    /**
+     * Copies the files cached under the passed key to the passed output
+     * and interface file paths. If nothing is cached under the key, or if
+     * an interface file is requested but was not cached, @c false is
+     * returned and no file is written.
+     *
+     * @param key            The cache key.
+     * @param outputFile     Where to put the cached output file.
+     * @param interfaceFile  Where to put the cached binary interface file,
+     *                       or an empty path if none is needed.
+     * @return               @c true if the files were retrieved;
+     *                       @c false otherwise.
+     */
+    static bool retrieve(const std::string& key,
+        const std::filesystem::path& outputFile,
+        const std::filesystem::path& interfaceFile);
+
+    /**
+     * Stores the passed output and interface files in the cache under the
+     * passed key. Failures to write to the cache are silently ignored.
+     *
+     * @param key            The cache key.
+     * @param outputFile     The output file.
+     * @param interfaceFile  The binary interface file, or an empty path.
+     */
+    static void store(const std::string& key,
+        const std::filesystem::path& outputFile,
+        const std::filesystem::path& interfaceFile);
+
+    /**
+     * Removes the least recently used files from the cache until its size
+     * is within config::cacheSizeLimit.
+     */
+    static void trim();
+
+    /**
+     * Records the hash of the passed module's interface, which becomes
+     * part of the cache key of every module importing it.
+     *
+     * @param m     The module.
+     * @param hash  The hash of the module's interface.
+     */
+    static void setInterfaceHash(ast::Module* m, const std::string& hash);
+
+    /**
+     * Returns the hash of the passed module's interface recorded with
+     * setInterfaceHash(), or an empty string if there is none.
+     *
+     * @param m  The module.
+     * @return   The hash of the module's interface, or an empty string.
+     */
+    static std::string interfaceHash(ast::Module* m);
+
+    /**
+     * Writes the number of cache hits and misses and the number of bytes
+     * read from, written to and evicted from the cache to the standard
+     * error stream.
+     */
+    static void showStatistics();
+
+private:
+    static std::map<ast::Module*, std::string> sInterfaceHashes;
+    static std::mutex sInterfaceHashesMutex;
+    static std::atomic<unsigned> sHits;
+    static std::atomic<unsigned> sMisses;
+    static std::atomic<std::uintmax_t> sBytesRead;
+    static std::atomic<std::uintmax_t> sBytesWritten;
+    static std::atomic<std::uintmax_t> sBytesEvicted;
+};
+
+} // namespace driver
+} // namespace soyac
+
+#endif
@@ -7,17 +7,25 @@
  */
 
 #include <array>
+#include <cerrno>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <llvm/Target/TargetMachine.h>
+#include <set>
+#include <sstream>
+#include <system_error>
 
 #include <analysis/BasicAnalyzer.h>
 #include <analysis/ControlFlowAnalyzer.h>
 #include <codegen/CodeGenerator.h>
+#include <common/PhaseTimer.h>
+#include <interface/InterfaceReader.h>
+#include <interface/InterfaceWriter.h>
 #include <parser/ParserDriver.h>
 
+#include "CompilationCache.h"
 #include "FileProcessor.h"
 #include "ProblemReport.h"
 #include "config.h"
@@ -27,6 +35,23 @@ using std::filesystem::path;
 namespace soyac {
 namespace driver {
 
+/**
+ * Returns the extension of the files generated by code generation with
+ * the current compiler options.
+ *
+ * @return  The output file extension.
+ */
+static std::string output_extension()
+{
+    if (config::emitLLVM) {
+        return ".ll";
+    } else if (config::linkTimeOptimization) {
+        return ".bc";
+    } else {
+        return ".o";
+    }
+}
+
 FileProcessor::FileProcessor(const std::string& inputFile)
     : mFilePath(inputFile)
 {
@@ -39,61 +64,267 @@ FileProcessor::FileProcessor(const std::string& inputFile)
 
 FileProcessor::~FileProcessor() { }
 
-std::string FileProcessor::process()
+codegen::Backend FileProcessor::createBackend()
 {
-    std::filesystem::path p(mFilePath);
+    codegen::Backend backend;
+    backend.setOptimizationLevel(config::optimizationLevel);
+    backend.setTargetCPU(config::targetCPU);
+    backend.setTargetFeatures(config::targetFeatures);
+    return backend;
+}
 
+std::string FileProcessor::process()
+{
     /*
-     * If the file to process is a source or interface file, we parse and
-     * validate it. In the case of a source file, we also translate the file
-     * to LLVM assembly.
+     * If the file to process is a source or interface file, we parse it
+     * and process the resulting module. Any other file is passed on
+     * unchanged.
      */
-    if (p.extension().string() == ".soya"
-        || p.extension().string() == ".soyi") {
+    if (isModuleFile()) {
+        ast::Module* m = parse();
+
         /*
-         * Parse the file.
+         * If parse() did not return a module, parsing failed.
          */
+        if (!m) {
+            return std::string("");
+        }
+
+        return process(m);
+    }
+
+    return mFilePath.string();
+}
+
+bool FileProcessor::isModuleFile() const
+{
+    return mFilePath.extension().string() == ".soya"
+        || mFilePath.extension().string() == ".soyi"
+        || isBinaryInterfaceFile();
+}
+
+void FileProcessor::addInputFile(const std::string& inputFile)
+{
+    mAdditionalFiles.push_back(inputFile);
+}
 
+bool FileProcessor::isBinaryInterfaceFile() const
+{
+    return mFilePath.extension().string() == ".soyb";
+}
+
+parser::ModuleHeader FileProcessor::scanHeader()
+{
+    if (isBinaryInterfaceFile()) {
+        interface::InterfaceReader reader(mFilePath.string());
+
+        if (!reader.isValid()) {
+            return parser::ModuleHeader();
+        }
+
+        return reader.scanHeader();
+    }
+
+    return parser::ParserDriver(mFilePath.string()).scanHeader();
+}
+
+ast::Module* FileProcessor::parse()
+{
+    if (isBinaryInterfaceFile()) {
+        return ast::Module::get(ast::Name(scanHeader().moduleName), true);
+    }
+
+    PhaseTimer::setCurrentFile(mFilePath.string());
+    PhaseTimer timer("parsing");
+    PassResult* result = nullptr;
+    ast::Module* m = parser::ParserDriver(mFilePath.string()).parse(result);
+
+    if (result != nullptr) {
+        ProblemReport::addPassResult(result);
+    }
+
+    return m;
+}
+
+std::string FileProcessor::process(ast::Module* m)
+{
+    PhaseTimer::setCurrentFile(mFilePath.string());
+
+    /*
+     * A binary interface file describes an already analyzed module, so
+     * its declarations only need to be read.
+     */
+    if (isBinaryInterfaceFile()) {
+        PhaseTimer timer("interface reading");
         PassResult* result = nullptr;
-        ast::Module* m = parser::ParserDriver(p.string()).parse(result);
+
+        try {
+            interface::InterfaceReader(mFilePath.string()).read(m, result);
+        } catch (const std::ifstream::failure&) {
+            throw std::system_error(errno, std::generic_category(),
+                "cannot read `" + mFilePath.string() + "'");
+        }
 
         if (result != nullptr) {
             ProblemReport::addPassResult(result);
+
+            if (result->foundErrors()) {
+                return std::string("");
+            }
         }
 
         /*
-         * If parse() did not return a module, parsing failed.
+         * Interface hashes are recorded even without a cache, as the
+         * workers of a compile server inherit them but may enable the
+         * cache.
          */
-        if (!m) {
-            return std::string("");
-        }
+        CompilationCache::setInterfaceHash(m, inputFilesHash());
+        return mFilePath.string();
+    }
 
+    /*
+     * Analyze the module. If errors were found in the module, we
+     * cannot proceed further as the abstract syntax tree is invalid.
+     */
+    if (!analyze(m)) {
+        return std::string("");
+    }
+
+    /*
+     * If the input file is a source file, generate code for it and return
+     * the generated file's path so that the file will be further processed
+     * if this is needed.
+     */
+    if (mFilePath.extension().string() == ".soya") {
         /*
-         * Analyze the module. If errors were found in the module, we
-         * cannot proceed further as the abstract syntax tree is invalid.
+         * Modules other than the program module can be imported, so
+         * provide a binary interface for them along with the code.
          */
-        if (!analyze(m)) {
-            return std::string("");
+        bool importable = (m != ast::Module::getProgram());
+        path outputPath(mFilePath);
+        path interfacePath;
+        std::string key;
+
+        outputPath.replace_extension(output_extension());
+
+        if (importable) {
+            interfacePath = mFilePath;
+            interfacePath.replace_extension(".soyb");
         }
 
         /*
-         * If the input file is a source file, generate LLVM assembly for
-         * it. We set 'p' to the generated LLVM assembly file's path so
-         * that the file will be further processed if this is needed.
+         * The module still had to be analyzed, since modules importing it
+         * need its symbol table, but code generation can be skipped if the
+         * generated files are cached.
          */
-        if (p.extension().string() == ".soya") {
-            return compile(m);
+        if (CompilationCache::isEnabled()) {
+            key = cacheKey(m);
         }
-        /*
-         * If we are processing an interface file, there won't be any
-         * compilation steps taken, so we can return now.
-         */
-        else {
-            return p.string();
+
+        if (key.empty()
+            || !CompilationCache::retrieve(key, outputPath, interfacePath)) {
+            outputPath = compile(m);
+
+            if (importable) {
+                generateInterfaceFile(m);
+            }
+
+            if (!key.empty()) {
+                CompilationCache::store(key, outputPath, interfacePath);
+            }
         }
+
+        if (importable && CompilationCache::isEnabled()) {
+            CompilationCache::setInterfaceHash(
+                m, CompilationCache::fileHash(interfacePath));
+        }
+
+        return outputPath.string();
+    }
+    /*
+     * If we are processing an interface file, there won't be any
+     * compilation steps taken, so we can return now.
+     */
+    else {
+        CompilationCache::setInterfaceHash(m, inputFilesHash());
+        return mFilePath.string();
     }
+}
 
-    return mFilePath.string();
+std::string FileProcessor::cacheKey(ast::Module* m)
+{
+    std::string sourceHash = inputFilesHash();
+
+    if (sourceHash.empty()) {
+        return std::string("");
+    }
+
+    codegen::Backend backend = createBackend();
+    std::stringstream data;
+    data << "soyac " << SOYAC_VERSION << "\n"
+         << "source " << sourceHash << "\n"
+         << "output " << output_extension() << "\n"
+         << "optimize " << backend.optimizationLevel() << "\n"
+         << "triple " << backend.targetTriple() << "\n"
+         << "cpu " << backend.resolvedTargetCPU() << "\n"
+         << "features " << backend.resolvedTargetFeatures() << "\n";
+
+    /*
+     * Mangled names depend on the program module's name.
+     */
+    if (ast::Module::getProgram() != nullptr) {
+        data << "program " << ast::Module::getProgram()->name().str() << "\n";
+    }
+
+    /*
+     * The generated code depends on the declarations of the imported
+     * modules, but not on their implementation.
+     */
+    std::set<std::string> imports(
+        parser::ParserDriver(mFilePath.string()).scanHeader().importedModules);
+
+    for (const path& file : mAdditionalFiles) {
+        parser::ModuleHeader header
+            = parser::ParserDriver(file.string()).scanHeader();
+        imports.insert(
+            header.importedModules.begin(), header.importedModules.end());
+    }
+
+    if (m->name() != "__core__") {
+        imports.insert("__core__");
+    }
+
+    for (const std::string& name : imports) {
+        ast::Module* imported = ast::Module::get(ast::Name(name));
+        std::string hash = (imported != nullptr)
+            ? CompilationCache::interfaceHash(imported)
+            : std::string("");
+
+        if (hash.empty()) {
+            return std::string("");
+        }
+
+        data << "import " << name << " " << hash << "\n";
+    }
+
+    return CompilationCache::hash(data.str());
+}
+
+std::string FileProcessor::inputFilesHash() const
+{
+    std::string hash = CompilationCache::fileHash(mFilePath);
+
+    for (const path& file : mAdditionalFiles) {
+        std::string fileHash = CompilationCache::fileHash(file);
+
+        if (hash.empty() || fileHash.empty()) {
+            return std::string("");
+        }
+
+        hash = CompilationCache::hash(hash + fileHash);
+    }
+
+    return hash;
 }
 
 bool FileProcessor::analyze(ast::Module* m)
@@ -103,7 +334,11 @@ bool FileProcessor::analyze(ast::Module* m)
     /*
      * Basic Analysis
      */
-    result = analysis::BasicAnalyzer().analyze(m);
+    {
+        PhaseTimer timer("basic analysis");
+        result = analysis::BasicAnalyzer().analyze(m);
+    }
+
     if (result != nullptr) {
         ProblemReport::addPassResult(result);
         if (result->foundErrors()) {
@@ -114,7 +349,11 @@ bool FileProcessor::analyze(ast::Module* m)
     /*
      * Control Flow Analysis
      */
-    result = analysis::ControlFlowAnalyzer().analyze(m);
+    {
+        PhaseTimer timer("control flow analysis");
+        result = analysis::ControlFlowAnalyzer().analyze(m);
+    }
+
     if (result != nullptr) {
         ProblemReport::addPassResult(result);
         if (result->foundErrors()) {
@@ -129,6 +368,8 @@ path FileProcessor::compile(soyac::ast::Module* m)
 {
     if (config::emitLLVM) {
         return generateLLVMAssemblyFile(m);
+    } else if (config::linkTimeOptimization) {
+        return generateBitcodeFile(m);
     } else {
         return generateObjectFile(m);
     }
@@ -140,12 +381,13 @@ path FileProcessor::generateLLVMAssemblyFile(ast::Module* m)
     outputPath.replace_extension(".ll");
 
     codegen::CodeGenerator generator(m);
+    generator.setBackend(createBackend());
     std::error_code error;
     generator.toLLVMAssembly(outputPath, error);
 
     if (error) {
-        std::cerr << error.message() << "\n";
-        std::exit(1);
+        throw std::system_error(
+            error, "cannot write `" + outputPath.string() + "'");
     }
 
     return outputPath;
@@ -157,12 +399,49 @@ path FileProcessor::generateObjectFile(soyac::ast::Module* m)
     outputPath.replace_extension(".o");
 
     codegen::CodeGenerator generator(m);
+    generator.setBackend(createBackend());
     std::error_code error;
     generator.toObjectCode(outputPath, error);
 
     if (error) {
-        std::cerr << error.message() << "\n";
-        std::exit(1);
+        throw std::system_error(
+            error, "cannot write `" + outputPath.string() + "'");
+    }
+
+    return outputPath;
+}
+
+path FileProcessor::generateBitcodeFile(soyac::ast::Module* m)
+{
+    path outputPath(mFilePath);
+    outputPath.replace_extension(".bc");
+
+    codegen::CodeGenerator generator(m);
+    generator.setBackend(createBackend());
+    std::error_code error;
+    generator.toBitcode(outputPath, error);
+
+    if (error) {
+        throw std::system_error(
+            error, "cannot write `" + outputPath.string() + "'");
+    }
+
+    return outputPath;
+}
+
+path FileProcessor::generateInterfaceFile(ast::Module* m)
+{
+    path outputPath(mFilePath);
+    outputPath.replace_extension(".soyb");
+
+    PhaseTimer timer("interface writing");
+    interface::InterfaceWriter writer(m);
+    std::error_code error;
+    writer.write(outputPath, error);
+
+    if (error) {
+        throw std::system_error(
+            error, "cannot write `" + outputPath.string() + "'");
     }
 
     return outputPath;
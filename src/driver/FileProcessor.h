@@ -11,12 +11,15 @@
 
 #include <analysis/ModulesRequiredException.h>
 #include <ast/Module.h>
+#include <codegen/Backend.h>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <llvm/IR/Module.h>
 #include <llvm/Support/Path.h>
+#include <parser/ParserDriver.h>
 #include <string>
+#include <vector>
 
 namespace soyac {
 namespace driver {
@@ -47,7 +50,9 @@ public:
      * compilation errors), an empty string is returned instead.
      *
      * If an I/O error occurs while an input source or interface file is
-     * read, a std::ifstream::failure exception is thrown.
+     * read, a std::ifstream::failure exception is thrown. If a binary
+     * interface file cannot be read or an output file cannot be written, a
+     * std::system_error exception is thrown instead.
      *
      * If the input file is a source or interface file, it may be that the
      * module specified by this file depends on other modules which have not
@@ -55,6 +60,8 @@ public:
      * soyac::ast::ModulesRequiredException.
      *
      * @throw std::ifstream::failure                If an I/O error occurs.
+     * @throw std::system_error                     If an output file cannot
+     *                                              be written.
      * @throw soyac::ast::ModulesRequiredException  If other modules need to
      *                                              be processed first.
      *
@@ -62,9 +69,116 @@ public:
      */
     std::string process();
 
+    /**
+     * Returns @c true if the input file is a source or interface file,
+     * that is, a file that must be read into a module before it can be
+     * processed further.
+     *
+     * @return  Whether the input file is a source or interface file.
+     */
+    bool isModuleFile() const;
+
+    /**
+     * Adds another source or interface file which contributes to the
+     * module of the input file. Its contents become part of the module's
+     * compilation cache key (see CompilationCache).
+     *
+     * @param inputFile  A path to the additional file.
+     */
+    void addInputFile(const std::string& inputFile);
+
+    /**
+     * Returns @c true if the input file is a binary interface file (see
+     * interface::InterfaceWriter), which is read without being parsed.
+     *
+     * @return  Whether the input file is a binary interface file.
+     */
+    bool isBinaryInterfaceFile() const;
+
+    /**
+     * Returns the module and import declarations of the input file, which
+     * must be a source or interface file (see isModuleFile()). For a
+     * binary interface file, the imports are the modules whose types its
+     * declarations use; if the file cannot be read by this compiler
+     * version, the returned module name is empty.
+     *
+     * @throw std::ifstream::failure  If an I/O error occurs.
+     *
+     * @return  The input file's module and import declarations.
+     */
+    parser::ModuleHeader scanHeader();
+
+    /**
+     * Parses the input file, which must be a source or interface file (see
+     * isModuleFile()), and returns the parsed module. If parsing fails,
+     * null is returned. Together with process(soyac::ast::Module*), this
+     * allows the imports of all modules to be known before any of them is
+     * analyzed.
+     *
+     * For a binary interface file, only the module is created; its
+     * declarations are read by process(soyac::ast::Module*), once the
+     * modules they refer to have been processed.
+     *
+     * @throw std::ifstream::failure  If an I/O error occurs.
+     *
+     * @return  The parsed module, or null.
+     */
+    soyac::ast::Module* parse();
+
+    /**
+     * Analyzes and, in the case of a source file, compiles the passed
+     * module returned by parse(). For a binary interface file, the
+     * module's declarations are read instead. The returned output file and
+     * the thrown exceptions are the same as for process().
+     *
+     * @throw std::system_error                     If the binary interface
+     *                                              file cannot be read or
+     *                                              an output file cannot
+     *                                              be written.
+     * @throw soyac::ast::ModulesRequiredException  If other modules need to
+     *                                              be processed first.
+     *
+     * @param m  The module parsed from the input file.
+     * @return   The generated output file, or an empty string.
+     */
+    std::string process(soyac::ast::Module* m);
+
+    /**
+     * Returns a codegen::Backend configured with the target and
+     * optimization options given on the command line.
+     *
+     * @return  The configured backend.
+     */
+    static codegen::Backend createBackend();
+
+    /**
+     * Returns the key under which the code generated for the passed
+     * module is stored in the compilation cache. The key is the hash of
+     * the module's source files, the compiler version, the code generation
+     * options (with the target CPU and features resolved as the backend
+     * resolves them, so that "native" stands for the actual host), the
+     * target triple and the interface hashes of the imported modules. If
+     * an imported module's interface hash is unknown, or a source file
+     * cannot be read, an empty string is returned, and the module is not
+     * cached.
+     *
+     * @param m  The module parsed from the input files.
+     * @return   The module's cache key, or an empty string.
+     */
+    std::string cacheKey(soyac::ast::Module* m);
+
 private:
     std::filesystem::path mFilePath;
     std::filesystem::path mTempDir;
+    std::vector<std::filesystem::path> mAdditionalFiles;
+
+    /**
+     * Returns the hash of the input files' contents, or an empty string if
+     * a file cannot be read.
+     *
+     * @return  The input files' hash, or an empty string.
+     */
+    std::string inputFilesHash() const;
 
     /**
      * Analyzes the passed Module. If there are modules required which are
@@ -94,6 +208,8 @@ private:
      * assembly, the file will be located in the input file's directory.
      * Otherwise, it is stored in the FileProcessor's temporary directory.)
      *
+     * @throw std::system_error  If the file cannot be written.
+     *
      * @param m  The module to generate code for.
      * @return   The resulting LLVM assembly file's path.
      */
@@ -103,10 +219,36 @@ private:
      * Generates a binary object file from the module and returns its path.
      * The file will be located in the input file's directory.
      *
+     * @throw std::system_error  If the file cannot be written.
+     *
      * @param m  The module to generate code for.
      * @return   The resulting object file's path.
      */
     std::filesystem::path generateObjectFile(soyac::ast::Module* m);
+
+    /**
+     * Generates an LLVM bitcode file from the module for link-time
+     * optimization and returns its path. The file will be located in the
+     * input file's directory.
+     *
+     * @throw std::system_error  If the file cannot be written.
+     *
+     * @param m  The module to generate code for.
+     * @return   The resulting bitcode file's path.
+     */
+    std::filesystem::path generateBitcodeFile(soyac::ast::Module* m);
+
+    /**
+     * Generates a binary interface file from the module and returns its
+     * path. The file will be located in the input file's directory, so
+     * that it is found alongside the generated object file.
+     *
+     * @throw std::system_error  If the file cannot be written.
+     *
+     * @param m  The module to generate the interface for.
+     * @return   The resulting binary interface file's path.
+     */
+    std::filesystem::path generateInterfaceFile(soyac::ast::Module* m);
 };
 
 } // namespace driver
@@ -13,9 +13,11 @@ namespace soyac {
 namespace driver {
 
 std::list<PassResult*> ProblemReport::sResults;
+std::mutex ProblemReport::sResultsMutex;
 
 void ProblemReport::addPassResult(PassResult* result)
 {
+    std::lock_guard<std::mutex> lock(sResultsMutex);
     sResults.push_back(result);
 }
 
@@ -10,6 +10,7 @@
 #define SOYA_PROBLEM_REPORT_H_
 
 #include <common/PassResult.h>
+#include <mutex>
 
 namespace soyac {
 namespace driver {
@@ -22,7 +23,7 @@ class ProblemReport {
 public:
     /**
      * Adds the problems stored in the passed PassResult to the
-     * error report.
+     * error report. May be called by several threads at once.
      *
      * @param result  The PassResult to be added.
      */
@@ -41,6 +42,7 @@ public:
 
 private:
     static std::list<PassResult*> sResults;
+    static std::mutex sResultsMutex;
 };
 
 } // namespace driver
@@ -12,14 +12,25 @@ namespace soyac {
 namespace driver {
 namespace config {
 
+std::string cacheDirectory("");
+unsigned cacheSizeLimit = 1024;
+bool cacheStatistics = false;
 bool compileOnly = false;
 bool emitAssembly = false;
 bool emitLLVM = false;
 std::vector<std::string> interfacePaths {};
+unsigned jobs = 1;
 std::vector<std::string> libraryPaths {};
+bool linkTimeOptimization = false;
+unsigned optimizationLevel = 0;
 std::string outputPath("./a.out");
 std::string programName("soyac");
+std::string serverSocket("");
 std::vector<std::string> sourcePaths {};
+std::string targetCPU("generic");
+std::string targetFeatures("");
+bool timeReport = false;
+std::string timeTraceFile("");
 
 std::vector<std::string> defaultInterfacePaths = { "/usr/local/include/soya",
     "/usr/local/include", "/usr/include/soya", "/usr/include" };
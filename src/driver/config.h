@@ -12,10 +12,30 @@
 #include <string>
 #include <vector>
 
+#define SOYAC_VERSION "0.1"
+
 namespace soyac {
 namespace driver {
 namespace config {
 
+/**
+ * The directory of the compilation cache (see CompilationCache). If
+ * empty, no cache is used. The default value is empty.
+ */
+extern std::string cacheDirectory;
+
+/**
+ * The size in megabytes up to which the compilation cache may grow.
+ * The default value is 1024.
+ */
+extern unsigned cacheSizeLimit;
+
+/**
+ * Whether statistics about the use of the compilation cache should be
+ * written to the standard error stream. The default value is @c false.
+ */
+extern bool cacheStatistics;
+
 /**
  * Whether the input files should only be compiled, but not linked.
  * The default value is @c false.
@@ -44,11 +64,30 @@ extern bool emitLLVM;
  */
 extern std::vector<std::string> interfacePaths;
 
+/**
+ * The maximum number of modules to analyze and compile in parallel.
+ * The default value is 1.
+ */
+extern unsigned jobs;
+
 /**
  * The paths in which to search for library files.
  */
 extern std::vector<std::string> libraryPaths;
 
+/**
+ * Whether modules should be compiled to LLVM bitcode and optimized
+ * together when linking (link-time optimization).
+ * The default value is @c false.
+ */
+extern bool linkTimeOptimization;
+
+/**
+ * The optimization level (0 to 3) at which to compile.
+ * The default value is 0 (no optimization).
+ */
+extern unsigned optimizationLevel;
+
 /**
  * Where to put the generated binary file when linking.
  */
@@ -59,11 +98,43 @@ extern std::string outputPath;
  */
 extern std::string programName;
 
+/**
+ * The path of the Unix domain socket on which to run a compile server
+ * (see runServer()). If empty, the input files are compiled directly.
+ * The default value is empty.
+ */
+extern std::string serverSocket;
+
 /**
  * The paths in which to search for source files.
  */
 extern std::vector<std::string> sourcePaths;
 
+/**
+ * The CPU to generate code for ("native" for the host's CPU).
+ * The default value is "generic".
+ */
+extern std::string targetCPU;
+
+/**
+ * Comma-separated target features to enable ("+feature") or disable
+ * ("-feature") in addition to those of the target CPU.
+ * The default value is empty.
+ */
+extern std::string targetFeatures;
+
+/**
+ * Whether the time spent in each compiler phase should be written to the
+ * standard error stream (see PhaseTimer). The default value is @c false.
+ */
+extern bool timeReport;
+
+/**
+ * The file to write a trace of the compiler phases to (see PhaseTimer).
+ * If empty, no trace is written. The default value is empty.
+ */
+extern std::string timeTraceFile;
+
 /**
  * Returns @c true object files resulting from compilation should be
  * linked together.
@@ -8,9 +8,18 @@
 
 #include "link.h"
 #include "config.h"
+#include <common/PhaseTimer.h>
 #include <cstdlib>
 #include <iostream>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Program.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Transforms/IPO/Internalize.h>
 #include <string>
 
 namespace soyac {
@@ -18,6 +27,7 @@ namespace driver {
 
 void linkFiles(const std::list<std::string>& objectFiles)
 {
+    PhaseTimer timer("linking");
     llvm::ErrorOr<std::string> gcc = llvm::sys::findProgramByName("cc");
 
     if (std::error_code code = gcc.getError()) {
@@ -25,6 +35,11 @@ void linkFiles(const std::list<std::string>& objectFiles)
         std::exit(1);
     }
 
+    /*
+     * The arguments only refer to their strings, so the library path
+     * options must be kept alive until the linker has run.
+     */
+    std::vector<std::string> libraryPathOptions;
     std::vector<llvm::StringRef> args;
     args.push_back("ld");
 
@@ -33,8 +48,12 @@ void linkFiles(const std::list<std::string>& objectFiles)
         args.push_back(it->c_str());
     }
 
-    for (auto lp : config::libraryPaths) {
-        args.push_back("-L" + lp);
+    for (const std::string& lp : config::libraryPaths) {
+        libraryPathOptions.push_back("-L" + lp);
+    }
+
+    for (const std::string& option : libraryPathOptions) {
+        args.push_back(option);
     }
 
     args.push_back("-lsr");
@@ -42,7 +61,67 @@ void linkFiles(const std::list<std::string>& objectFiles)
     args.push_back("-o");
     args.push_back(config::outputPath);
 
-    llvm::sys::ExecuteAndWait(*gcc, args);
+    if (llvm::sys::ExecuteAndWait(*gcc, args) != 0) {
+        std::cerr << config::programName << ": linking failed" << std::endl;
+        std::exit(1);
+    }
+}
+
+std::string linkBitcodeFiles(const std::list<std::string>& bitcodeFiles,
+    const codegen::Backend& backend, bool internalize)
+{
+    llvm::LLVMContext context;
+    auto program = std::make_unique<llvm::Module>("soya-lto", context);
+    llvm::Linker linker(*program);
+
+    for (const std::string& file : bitcodeFiles) {
+        PhaseTimer timer("bitcode linking");
+        llvm::SMDiagnostic diagnostic;
+        std::unique_ptr<llvm::Module> module
+            = llvm::parseIRFile(file, diagnostic, context);
+
+        if (!module) {
+            diagnostic.print(config::programName.c_str(), llvm::errs());
+            std::exit(1);
+        }
+
+        if (linker.linkInModule(std::move(module))) {
+            std::cerr << config::programName << ": cannot link `" << file
+                      << "'" << std::endl;
+            std::exit(1);
+        }
+    }
+
+    std::unique_ptr<llvm::TargetMachine> targetMachine
+        = backend.createTargetMachine();
+    backend.prepare(program.get(), targetMachine.get());
+
+    if (internalize) {
+        llvm::internalizeModule(*program, [](const llvm::GlobalValue& value) {
+            return value.getName() == "main";
+        });
+    }
+
+    backend.optimize(
+        program.get(), targetMachine.get(), codegen::Backend::LTO);
+
+    llvm::SmallString<128> objectFile;
+    std::error_code error
+        = llvm::sys::fs::createTemporaryFile("soyac-lto", "o", objectFile);
+
+    if (!error) {
+        backend.emitObjectFile(
+            program.get(), targetMachine.get(), objectFile.str().str(), error);
+    }
+
+    if (error) {
+        std::cerr << config::programName
+                  << ": cannot write object file: " << error.message()
+                  << std::endl;
+        std::exit(1);
+    }
+
+    return objectFile.str().str();
 }
 
 } // namespace driver
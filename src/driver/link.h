@@ -9,6 +9,7 @@
 #ifndef SOYA_LINK__H_
 #define SOYA_LINK__H_
 
+#include <codegen/Backend.h>
 #include <list>
 #include <string>
 
@@ -25,6 +26,26 @@ namespace driver {
  */
 void linkFiles(const std::list<std::string>& objectFiles);
 
+/**
+ * Merges the passed LLVM bitcode files into a single module, optimizes
+ * the whole program with the passed backend's link-time optimization
+ * pipeline and writes the result to a temporary object file, whose path
+ * is returned.
+ *
+ * If @c internalize is @c true, all symbols except "main" are made
+ * internal before optimization, which allows unused functions to be
+ * removed and all others to be inlined without keeping an external copy.
+ * This must only be requested if no other object file refers to a symbol
+ * defined in the bitcode files.
+ *
+ * @param bitcodeFiles  The bitcode files to link.
+ * @param backend       The backend to optimize and generate code with.
+ * @param internalize   Whether to internalize all symbols except "main".
+ * @return              The path of the generated object file.
+ */
+std::string linkBitcodeFiles(const std::list<std::string>& bitcodeFiles,
+    const codegen::Backend& backend, bool internalize);
+
 } // namespace driver
 } // namespace soyac
 
@@ -7,24 +7,39 @@
  */
 
 #include <algorithm>
+#include <cassert>
 #include <cerrno>
+#include <condition_variable>
+#include <cstdio>
 #include <cstring>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/program_options.hpp>
 #include <llvm/Support/TargetSelect.h>
 
+#include "CompilationCache.h"
 #include "FileProcessor.h"
 #include "ProblemReport.h"
 #include "config.h"
 #include "link.h"
+#include "server.h"
 #include <analysis/ModulesRequiredException.h>
-
-#define SOYAC_VERSION "0.1"
+#include <common/PhaseTimer.h>
+#include <interface/InterfaceReader.h>
+#include <parser/ParserDriver.h>
 
 namespace po = boost::program_options;
 
@@ -33,6 +48,42 @@ using namespace soyac::driver;
 using soyac::analysis::ModulesRequiredException;
 
 static std::list<std::string> sObjectFiles;
+static std::list<std::string> sBitcodeFiles;
+
+/**
+ * Additional command-line parser which allows the code generation and
+ * instrumentation options (-flto, -ftime-report, -ftime-trace, -march,
+ * -mcpu and -mattr) to be written with a single dash, as in
+ * "-march=native".
+ *
+ * @param arg  The command-line argument.
+ * @return     The option name and value, or a pair of empty strings if
+ *             the argument is not a single-dash code generation option.
+ */
+static std::pair<std::string, std::string> parse_codegen_option(
+    const std::string& arg)
+{
+    static const char* const flagOptions[]
+        = { "flto", "ftime-report", "ftime-trace" };
+    static const char* const valueOptions[]
+        = { "ftime-trace", "march", "mattr", "mcpu" };
+
+    for (const char* option : flagOptions) {
+        if (arg == std::string("-") + option) {
+            return std::make_pair(option, std::string());
+        }
+    }
+
+    for (const char* option : valueOptions) {
+        std::string prefix = std::string("-") + option + "=";
+
+        if (arg.compare(0, prefix.length(), prefix) == 0) {
+            return std::make_pair(option, arg.substr(prefix.length()));
+        }
+    }
+
+    return std::make_pair(std::string(), std::string());
+}
 
 /**
  * Parses the passed command-line argument vector and stores all option
@@ -51,11 +102,34 @@ static std::vector<std::string> parse_command_line(int argc, const char** argv)
 
     desc.add_options()("help", "Show this help message and exit")(
         "emit-llvm", "Compile to LLVM assembly only, do not assemble or link")(
+        "flto", "Optimize the whole program when linking")("ftime-report",
+        "Show the time spent in each compiler phase")("ftime-trace",
+        po::value<std::string>()->implicit_value(""),
+        "Write a Chrome trace of the compiler phases to <file>")("cache-dir",
+        po::value<std::string>(),
+        "Reuse the output of unchanged modules cached in <directory>")(
+        "cache-size", po::value<unsigned>()->default_value(1024),
+        "Limit the compilation cache to <n> megabytes")(
+        "cache-stats", "Show compilation cache statistics")(
         "compile-only,c", "Compile and assemble only, do not link")(
+        "connect", po::value<std::string>(),
+        "Let the compile server listening on <socket> compile the files")(
         "include-path,I", po::value<std::vector<std::string>>(),
-        "Add <directory> to the interface file search path")("library-path,L",
+        "Add <directory> to the interface file search path")("jobs,j",
+        po::value<unsigned>()->default_value(1),
+        "Analyze and compile up to <n> modules in parallel")("library-path,L",
         po::value<std::vector<std::string>>(),
-        "Add <directory> to the library path")("o",
+        "Add <directory> to the library path")("server",
+        po::value<std::string>(),
+        "Run a compile server on <socket>, loading the interface files")(
+        "march",
+        po::value<std::string>(),
+        "Generate code for CPU <cpu> (\"native\" for the host CPU)")("mattr",
+        po::value<std::string>(),
+        "Enable (+) or disable (-) the comma-separated target features")(
+        "mcpu", po::value<std::string>(), "Same as -march")("optimize,O",
+        po::value<unsigned>()->default_value(0),
+        "Optimize at level <level> (0 to 3, -O alone means 1)")("output,o",
         po::value<std::string>()->default_value("a.out"),
         "Output the linked binary to <file>")("source-path,s",
         po::value<std::vector<std::string>>(),
@@ -66,9 +140,21 @@ static std::vector<std::string> parse_command_line(int argc, const char** argv)
     po::positional_options_description p;
     p.add("input-file", -1);
 
+    /*
+     * A plain "-O" means "-O1". This is not done with an implicit value,
+     * as that would make "-O file.soya" take the file name as the level.
+     */
+    std::vector<std::string> args(argv + 1, argv + argc);
+    std::replace(
+        args.begin(), args.end(), std::string("-O"), std::string("-O1"));
+
     po::variables_map vars;
-    po::command_line_parser parser(argc, argv);
-    po::store(parser.options(desc).positional(p).run(), vars);
+    po::command_line_parser parser(args);
+    po::store(parser.options(desc)
+                  .positional(p)
+                  .extra_parser(parse_codegen_option)
+                  .run(),
+        vars);
     po::notify(vars);
 
     if (vars.count("help")) {
@@ -80,6 +166,34 @@ static std::vector<std::string> parse_command_line(int argc, const char** argv)
         config::emitLLVM = true;
     }
 
+    if (vars.count("flto")) {
+        config::linkTimeOptimization = true;
+    }
+
+    if (vars.count("ftime-report")) {
+        config::timeReport = true;
+    }
+
+    if (vars.count("ftime-trace")) {
+        config::timeTraceFile = vars["ftime-trace"].as<std::string>();
+
+        if (config::timeTraceFile.empty()) {
+            config::timeTraceFile = "soyac-time-trace.json";
+        }
+    }
+
+    if (vars.count("cache-dir")) {
+        config::cacheDirectory = vars["cache-dir"].as<std::string>();
+    }
+
+    if (vars.count("cache-size")) {
+        config::cacheSizeLimit = vars["cache-size"].as<unsigned>();
+    }
+
+    if (vars.count("cache-stats")) {
+        config::cacheStatistics = true;
+    }
+
     if (vars.count("compile-only")) {
         config::compileOnly = true;
     }
@@ -89,13 +203,64 @@ static std::vector<std::string> parse_command_line(int argc, const char** argv)
             = vars["include-path"].as<std::vector<std::string>>();
     }
 
+    if (vars.count("jobs")) {
+        config::jobs = vars["jobs"].as<unsigned>();
+
+        if (config::jobs == 0) {
+            std::cerr << config::programName
+                      << ": the number of jobs must be at least 1" << std::endl;
+            std::exit(1);
+        }
+    }
+
     if (vars.count("library-path")) {
         config::libraryPaths
             = vars["library-path"].as<std::vector<std::string>>();
     }
 
-    if (vars.count("o")) {
-        config::outputPath = vars["o"].as<std::string>();
+    if (vars.count("march")) {
+        config::targetCPU = vars["march"].as<std::string>();
+    }
+
+    if (vars.count("mcpu")) {
+        config::targetCPU = vars["mcpu"].as<std::string>();
+    }
+
+    if (vars.count("mattr")) {
+        config::targetFeatures = vars["mattr"].as<std::string>();
+    }
+
+    /*
+     * LLVM only warns about an unknown CPU or feature (once per module),
+     * and then quietly generates code for the default target.
+     */
+    if (vars.count("march") || vars.count("mcpu") || vars.count("mattr")) {
+        try {
+            FileProcessor::createBackend().validateTarget();
+        } catch (const std::exception& e) {
+            std::cerr << config::programName << ": " << e.what()
+                      << std::endl;
+            std::exit(1);
+        }
+    }
+
+    if (vars.count("optimize")) {
+        config::optimizationLevel = vars["optimize"].as<unsigned>();
+
+        if (config::optimizationLevel > 3) {
+            std::cerr << config::programName
+                      << ": invalid optimization level `"
+                      << config::optimizationLevel << "'" << std::endl;
+            std::exit(1);
+        }
+    }
+
+    if (vars.count("output")) {
+        config::outputPath = vars["output"].as<std::string>();
+    }
+
+    if (vars.count("server")) {
+        config::serverSocket = vars["server"].as<std::string>();
     }
 
     if (vars.count("source-path")) {
@@ -114,6 +279,45 @@ static std::vector<std::string> parse_command_line(int argc, const char** argv)
     }
 }
 
+/**
+ * Returns the interface file for the module at the passed path (given
+ * without extension), or an empty string if there is none. A binary
+ * interface file (.soyb) is preferred to a textual one (.soyi), unless it
+ * is older than the textual one or was written by an incompatible
+ * compiler version.
+ *
+ * @param modulePath  The module's path without extension.
+ * @return            The interface file, or an empty string.
+ */
+static std::string find_interface_file(const std::filesystem::path& modulePath)
+{
+    std::filesystem::path binaryPath(modulePath);
+    std::filesystem::path textPath(modulePath);
+    std::error_code error;
+
+    binaryPath.replace_extension(".soyb");
+    textPath.replace_extension(".soyi");
+
+    bool hasText = std::filesystem::exists(textPath, error);
+
+    if (std::filesystem::exists(binaryPath, error)
+        && (!hasText
+            || std::filesystem::last_write_time(binaryPath, error)
+                >= std::filesystem::last_write_time(textPath, error))) {
+        try {
+            if (interface::InterfaceReader(binaryPath.string()).isValid()) {
+                return binaryPath.string();
+            }
+        } catch (const std::ifstream::failure&) {
+            /*
+             * Fall back to the textual interface file.
+             */
+        }
+    }
+
+    return hasText ? textPath.string() : std::string("");
+}
+
 /**
  * Searches for a source or interface file which provides the specified module
  * and returns its path. If no module with the passed name can be found, an
@@ -125,9 +329,9 @@ std::string find_module(const std::string& moduleName)
 {
     /*
      * Translate the module name to a file path we can search for (without
-     * the .soya or .soyi extension). We do so by replacing all occurrences
-     * of "::" with a path separator. So, for instance, "foo::bar::baz" becomes
-     * "foo/bar/baz".
+     * the .soya, .soyb or .soyi extension). We do so by replacing all
+     * occurrences of "::" with a path separator. So, for instance,
+     * "foo::bar::baz" becomes "foo/bar/baz".
      */
     std::string modulePath
         = std::regex_replace(moduleName, std::regex("::"), "/");
@@ -139,15 +343,16 @@ std::string find_module(const std::string& moduleName)
      */
 
     std::filesystem::path filePath(modulePath);
+    std::string interfacePath;
 
     filePath.replace_extension(".soya");
     if (std::filesystem::exists(filePath)) {
         return filePath.string();
     }
 
-    filePath.replace_extension(".soyi");
-    if (std::filesystem::exists(filePath)) {
-        return filePath.string();
+    interfacePath = find_interface_file(modulePath);
+    if (interfacePath != "") {
+        return interfacePath;
     }
 
     /*
@@ -162,9 +367,10 @@ std::string find_module(const std::string& moduleName)
             return filePath.string();
         }
 
-        filePath.replace_extension(".soyi");
-        if (std::filesystem::exists(filePath)) {
-            return filePath.string();
+        interfacePath
+            = find_interface_file(std::filesystem::path(p) / modulePath);
+        if (interfacePath != "") {
+            return interfacePath;
         }
     }
 
@@ -173,11 +379,10 @@ std::string find_module(const std::string& moduleName)
      * we look for it in the interface file search path (if specified).
      */
     for (std::string p : config::interfacePaths) {
-        filePath = (std::filesystem::path(p)) / modulePath;
-
-        filePath.replace_extension(".soyi");
-        if (std::filesystem::exists(filePath)) {
-            return filePath.string();
+        interfacePath
+            = find_interface_file(std::filesystem::path(p) / modulePath);
+        if (interfacePath != "") {
+            return interfacePath;
         }
     }
 
@@ -185,11 +390,10 @@ std::string find_module(const std::string& moduleName)
      * Last but not least, we look in the default interface paths.
      */
     for (std::string p : config::defaultInterfacePaths) {
-        filePath = (std::filesystem::path(p)) / modulePath;
-
-        filePath.replace_extension(".soyi");
-        if (std::filesystem::exists(filePath)) {
-            return filePath.string();
+        interfacePath
+            = find_interface_file(std::filesystem::path(p) / modulePath);
+        if (interfacePath != "") {
+            return interfacePath;
         }
     }
 
@@ -200,131 +404,541 @@ std::string find_module(const std::string& moduleName)
 }
 
 /**
- * Processes the passed list of files. If the list contains source files
- * which depend on modules not provided by any file in the list, these
- * modules are searched for using find_module() and, if found, are processed
- * too.
+ * A module to be analyzed and compiled by process_files(), together with
+ * its place in the import graph. Files which are not parsed into a module
+ * (such as object files) are represented by jobs without a module. If
+ * processing the module fails for reasons other than errors in the code,
+ * the error message is recorded in the job.
+ */
+struct ModuleJob {
+    ModuleJob(const FileProcessor& processor, ast::Module* module)
+        : processor(processor)
+        , module(module)
+        , pendingImports(0)
+        , scheduled(false)
+    {
+    }
+
+    FileProcessor processor;
+    ast::Module* module;
+    std::set<std::string> imports;
+    std::vector<ModuleJob*> dependents;
+    unsigned pendingImports;
+    bool scheduled;
+    std::string outputFile;
+    std::string error;
+};
+
+/**
+ * Analyzes and compiles the module of the passed job and stores the
+ * generated output file in the job. This runs on the threads started by
+ * run_jobs(), so if processing fails, the error message is recorded in
+ * the job rather than printed right away.
  *
- * @param files  The files to process.
+ * @param job  The job to process.
  */
-static void process_files(std::vector<std::string>& files)
+static void process_job(ModuleJob* job)
 {
-    std::vector<std::string> required;
+    std::stringstream error;
 
-    /*
-     * Try to process the passed files.
-     */
-    for (std::vector<std::string>::iterator it = files.begin();
-        it != files.end();) {
-        try {
-            FileProcessor proc(*it);
-            std::string outputFile;
-
-            try {
-                outputFile = proc.process();
-            } catch (const std::ifstream::failure& exc) {
-                std::cerr << config::programName
-                          << ": "
-                             "cannot read `"
-                          << *it << "': " << std::strerror(errno) << std::endl;
-
-                std::exit(1);
+    try {
+        job->outputFile = job->processor.process(job->module);
+    } catch (const ModulesRequiredException& e) {
+        /*
+         * All imports were looked for before, so a module still missing
+         * now was not provided by the file found for it.
+         */
+        for (ModulesRequiredException::const_modules_iterator it
+            = e.modules_begin();
+            it != e.modules_end(); it++) {
+            error << config::programName << ": cannot find required module '"
+                  << *it << "'" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        /*
+         * Anything else (such as a std::system_error for a file which
+         * cannot be written) must not escape the thread either.
+         */
+        error << config::programName << ": " << e.what() << std::endl;
+    }
+
+    job->error = error.str();
+}
+
+/**
+ * Processes the passed jobs' modules with the passed number of threads.
+ * A module is only processed once all modules it imports have been
+ * processed, but modules independent of each other are processed in
+ * parallel. Once processing a module fails (see process_job()), no
+ * further modules are started.
+ *
+ * @param jobs        The jobs to process.
+ * @param numThreads  The number of threads to use.
+ * @return            @c true if no job failed, @c false otherwise.
+ */
+static bool run_jobs(
+    const std::vector<std::unique_ptr<ModuleJob>>& jobs, unsigned numThreads)
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<ModuleJob*> ready;
+    std::size_t remaining = 0;
+    std::size_t running = 0;
+    bool failed = false;
+
+    for (const std::unique_ptr<ModuleJob>& job : jobs) {
+        if (job->module != nullptr) {
+            remaining++;
+
+            if (job->pendingImports == 0) {
+                job->scheduled = true;
+                ready.push_back(job.get());
             }
+        }
+    }
 
-            /*
-             * If the output file is an object file, add it to the object
-             * file list for linking.
-             */
-            if (config::linkingRequested() && outputFile != ""
-                && outputFile.substr(outputFile.length() - 2) == ".o") {
-                sObjectFiles.push_back(outputFile);
+    auto work = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        for (;;) {
+            changed.wait(lock, [&]() {
+                return remaining == 0 || failed || !ready.empty()
+                    || running == 0;
+            });
+
+            if (remaining == 0 || failed) {
+                return;
             }
 
             /*
-             * If a file has been processed, we can remove it from the
-             * file list. This leaves us with a list with only those
-             * source files which depend on the required modules.
-             */
-            it = files.erase(it);
-        } catch (const ModulesRequiredException& e) {
-            /*
-             * If further modules must be loaded to compile a file,
-             * we add those modules to a list.
+             * If no module is ready and none is being processed, only
+             * modules importing each other are left. Break the cycle by
+             * processing one of them anyway.
              */
-            for (ModulesRequiredException::const_modules_iterator m_it
-                = e.modules_begin();
-                m_it != e.modules_end(); m_it++) {
-                required.push_back(*m_it);
+            if (ready.empty()) {
+                for (const std::unique_ptr<ModuleJob>& job : jobs) {
+                    if (job->module != nullptr && !job->scheduled) {
+                        job->scheduled = true;
+                        ready.push_back(job.get());
+                        break;
+                    }
+                }
             }
 
-            it++;
+            ModuleJob* job = ready.front();
+            ready.pop_front();
+            running++;
+
+            lock.unlock();
+            process_job(job);
+            lock.lock();
+
+            running--;
+            remaining--;
+
+            if (!job->error.empty()) {
+                failed = true;
+            }
+
+            for (ModuleJob* dependent : job->dependents) {
+                if (--dependent->pendingImports == 0
+                    && !dependent->scheduled) {
+                    dependent->scheduled = true;
+                    ready.push_back(dependent);
+                }
+            }
+
+            changed.notify_all();
+        }
+    };
+
+    /*
+     * The nodes of a module which no other module imports are only linked
+     * to by the thread processing it, so their use lists need no locking.
+     */
+    if (numThreads > 1) {
+        for (const std::unique_ptr<ModuleJob>& job : jobs) {
+            if (job->module != nullptr && job->dependents.empty()) {
+                job->module->setShared(false);
+            }
+        }
+    }
+
+    ast::Node::setThreadSafe(numThreads > 1);
+
+    std::vector<std::thread> threads;
+
+    for (unsigned i = 1; i < numThreads; i++) {
+        threads.emplace_back(work);
+    }
+
+    work();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    ast::Node::setThreadSafe(false);
+    return !failed;
+}
+
+/**
+ * Processes the passed list of files. First, the module and import
+ * declarations of all source and interface files are scanned. If the
+ * files import modules not provided by any file in the list, these
+ * modules are searched for using find_module() and, if found, are scanned
+ * too. Once all files are known, each of them is parsed exactly once, and
+ * the parsed modules are analyzed and compiled in the order given by
+ * their imports, using up to config::jobs threads.
+ *
+ * @param files  The files to process.
+ */
+static void process_files(const std::vector<std::string>& files)
+{
+    std::vector<std::pair<std::string, parser::ModuleHeader>> headers;
+    std::set<std::string> provided;
+    std::set<std::string> searched;
+    std::deque<std::string> queue(files.begin(), files.end());
+    std::size_t resolved = 0;
+
+    while (!queue.empty()) {
+        /*
+         * Scan the queued files.
+         */
+        while (!queue.empty()) {
+            std::string file = queue.front();
+            queue.pop_front();
+            parser::ModuleHeader header;
+
+            if (FileProcessor(file).isModuleFile()) {
+                try {
+                    header = FileProcessor(file).scanHeader();
+                } catch (const std::ifstream::failure& exc) {
+                    std::cerr << config::programName << ": cannot read `"
+                              << file << "': " << std::strerror(errno)
+                              << std::endl;
+
+                    std::exit(1);
+                }
+
+                /*
+                 * Modules loaded before (by a compile server, see serve())
+                 * must not be loaded again.
+                 */
+                if (ast::Module::get(ast::Name(header.moduleName))
+                    != nullptr) {
+                    continue;
+                }
+
+                /*
+                 * Apart from the "__core__" module itself, every module
+                 * implicitly imports "__core__".
+                 */
+                if (header.moduleName != "__core__") {
+                    header.importedModules.insert("__core__");
+                }
+
+                provided.insert(header.moduleName);
+            }
+
+            headers.emplace_back(file, header);
+        }
+
+        /*
+         * Only now that all queued files are scanned, look for the
+         * imported modules which none of them provides.
+         */
+        for (; resolved < headers.size(); resolved++) {
+            for (const std::string& name :
+                headers[resolved].second.importedModules) {
+                if (provided.count(name) != 0
+                    || !searched.insert(name).second
+                    || ast::Module::get(ast::Name(name)) != nullptr) {
+                    continue;
+                }
+
+                std::string path = find_module(name);
+
+                if (path == "") {
+                    std::cerr << config::programName
+                              << ": cannot find required module '" << name
+                              << "'" << std::endl;
+                    std::exit(1);
+                }
+
+                queue.push_back(path);
+            }
         }
     }
 
     /*
-     * In the list of required modules, replace all module names with
-     * paths to corresponding source files using find_module().
+     * Parse every module file once.
      */
-    for (auto it = required.begin(); it != required.end();) {
+    std::vector<std::unique_ptr<ModuleJob>> jobs;
+    std::unordered_map<ast::Module*, ModuleJob*> moduleJobs;
+    unsigned parsed = 0;
+    unsigned parseCount = parser::ParserDriver::parseCount();
+
+    for (auto& [file, header] : headers) {
+        FileProcessor proc(file);
+
+        if (!proc.isModuleFile()) {
+            jobs.emplace_back(new ModuleJob(proc, nullptr));
+            jobs.back()->outputFile = proc.process();
+            continue;
+        }
+
+        ast::Module* m;
+
+        try {
+            m = proc.parse();
+
+            if (!proc.isBinaryInterfaceFile()) {
+                parsed++;
+            }
+        } catch (const std::ifstream::failure& exc) {
+            std::cerr << config::programName << ": cannot read `" << file
+                      << "': " << std::strerror(errno) << std::endl;
+
+            std::exit(1);
+        }
+
         /*
-         * It could be that the required module was already provided by one
-         * of the files passed to this function. If this is the case, remove
-         * it from the list of required modules.
+         * Skip files which failed to parse. Files contributing to a
+         * module parsed before add their imports to that module's job.
          */
-        if (soyac::ast::Module::get(soyac::ast::Name(*it)) != nullptr) {
-            it = required.erase(it);
-        } else {
-            std::string path = find_module(*it);
-
-            if (path == "") {
-                std::cerr << config::programName
-                          << ": cannot find required module '" << *it << "'"
-                          << std::endl;
-                std::exit(1);
-            } else {
-                *it = path;
-                it++;
+        if (m == nullptr) {
+            continue;
+        } else if (moduleJobs.count(m) != 0) {
+            moduleJobs[m]->processor.addInputFile(file);
+            moduleJobs[m]->imports.insert(
+                header.importedModules.begin(), header.importedModules.end());
+            continue;
+        }
+
+        jobs.emplace_back(new ModuleJob(proc, m));
+        jobs.back()->imports = header.importedModules;
+        moduleJobs[m] = jobs.back().get();
+    }
+
+    assert(parser::ParserDriver::parseCount() - parseCount == parsed);
+
+    /*
+     * Build the import graph.
+     */
+    for (const std::unique_ptr<ModuleJob>& job : jobs) {
+        for (const std::string& name : job->imports) {
+            auto it = moduleJobs.find(ast::Module::get(ast::Name(name)));
+
+            if (it != moduleJobs.end() && it->second != job.get()) {
+                it->second->dependents.push_back(job.get());
+                job->pendingImports++;
             }
         }
     }
 
     /*
-     * Process the required files. After that, we can go on to process
-     * the files which required them.
+     * If a module could not be processed, report why (in the order of the
+     * input files) once all threads have finished.
      */
+    if (!run_jobs(jobs, config::jobs)) {
+        for (const std::unique_ptr<ModuleJob>& job : jobs) {
+            std::cerr << job->error;
+        }
 
-    if (!required.empty()) {
-        process_files(required);
+        std::exit(1);
     }
 
-    if (!files.empty()) {
-        process_files(files);
+    /*
+     * Add the resulting object and bitcode files to the corresponding
+     * file list for linking, in the order of the input files.
+     */
+    if (config::linkingRequested()) {
+        for (const std::unique_ptr<ModuleJob>& job : jobs) {
+            std::string extension
+                = std::filesystem::path(job->outputFile).extension().string();
+
+            if (extension == ".o") {
+                sObjectFiles.push_back(job->outputFile);
+            } else if (extension == ".bc") {
+                sBitcodeFiles.push_back(job->outputFile);
+            }
+        }
     }
 }
 
-int main(int argc, const char** argv)
+static int compile(int argc, const char** argv);
+
+/**
+ * Loads the passed interface files, as well as the "__core__" module, and
+ * runs a compile server on config::serverSocket (see runServer()), whose
+ * workers start out with the loaded modules and an initialized target.
+ *
+ * @param interfaceFiles  The interface files to load.
+ * @return                The server's exit status.
+ */
+static int serve(const std::vector<std::string>& interfaceFiles)
 {
-    llvm::InitializeNativeTarget();
-    llvm::InitializeNativeTargetAsmPrinter();
+    std::string socketPath = config::serverSocket;
+    std::vector<std::string> files(interfaceFiles);
+    config::serverSocket.clear();
 
-    config::programName = argv[0];
+    /*
+     * Source files cannot be loaded, as their object files would be
+     * linked into every program compiled by the server.
+     */
+    for (const std::string& file : files) {
+        FileProcessor proc(file);
+
+        if (!proc.isModuleFile()
+            || std::filesystem::path(file).extension() == ".soya") {
+            std::cerr << config::programName << ": `" << file
+                      << "' is not an interface file" << std::endl;
+            return 1;
+        }
+    }
+
+    if (files.empty()) {
+        std::string corePath = find_module("__core__");
+
+        if (corePath == "") {
+            std::cerr << config::programName
+                      << ": cannot find required module '__core__'"
+                      << std::endl;
+            return 1;
+        }
 
+        files.push_back(corePath);
+    }
+
+    process_files(files);
+
+    if (ProblemReport::show() == true) {
+        return 1;
+    }
+
+    /*
+     * Creating a target machine initializes LLVM's target information
+     * (and detects the host CPU if requested) once for all workers.
+     */
+    FileProcessor::createBackend().createTargetMachine();
+
+    return runServer(socketPath, compile);
+}
+
+/**
+ * Runs the compiler with the passed command-line arguments and returns its
+ * exit status. This is also done by the workers of a compile server for
+ * every request.
+ *
+ * @param argc  The argument count.
+ * @param argv  The argument vector.
+ * @return      The exit status.
+ */
+static int compile(int argc, const char** argv)
+{
     std::vector<std::string> inputFiles = parse_command_line(argc, argv);
 
+    if (!config::serverSocket.empty()) {
+        return serve(inputFiles);
+    }
+
     if (inputFiles.size() == 0) {
         std::cerr << config::programName << ": no input files" << std::endl;
         return 1;
     }
 
+    PhaseTimer::setEnabled(
+        config::timeReport || !config::timeTraceFile.empty());
+
     process_files(inputFiles);
+    PhaseTimer::setCurrentFile("");
 
-    if (ProblemReport::show() == true) {
-        return 1;
+    if (CompilationCache::isEnabled()) {
+        CompilationCache::trim();
+
+        if (config::cacheStatistics) {
+            CompilationCache::showStatistics();
+        }
     }
 
-    if (config::linkingRequested()) {
+    int status = 0;
+
+    if (ProblemReport::show() == true) {
+        status = 1;
+    } else if (config::linkingRequested()) {
+        /*
+         * With link-time optimization, the bitcode files are merged and
+         * optimized as a whole first. Symbols can only be internalized if
+         * no native object file might refer to them.
+         */
+        std::string ltoObjectFile;
+
+        if (!sBitcodeFiles.empty()) {
+            ltoObjectFile = linkBitcodeFiles(sBitcodeFiles,
+                FileProcessor::createBackend(), sObjectFiles.empty());
+            sObjectFiles.push_back(ltoObjectFile);
+        }
+
         linkFiles(sObjectFiles);
+
+        if (!ltoObjectFile.empty()) {
+            std::remove(ltoObjectFile.c_str());
+        }
+    }
+
+    if (config::timeReport) {
+        PhaseTimer::showReport(std::cerr);
+    }
+
+    if (!config::timeTraceFile.empty()) {
+        std::ofstream trace(config::timeTraceFile);
+        PhaseTimer::writeTrace(trace);
+
+        if (!trace) {
+            std::cerr << config::programName << ": cannot write `"
+                      << config::timeTraceFile << "'" << std::endl;
+            status = 1;
+        }
     }
 
-    return 0;
+    return status;
+}
+
+int main(int argc, const char** argv)
+{
+    config::programName = argv[0];
+
+    /*
+     * If a compile server is to be used, the arguments (apart from the
+     * --connect option) are forwarded to it without initializing anything.
+     * If no server is listening, the files are compiled directly.
+     */
+    std::vector<const char*> args;
+    std::string socketPath;
+
+    for (int i = 0; i < argc; i++) {
+        std::string arg(argv[i]);
+
+        if (arg == "--connect" && i + 1 < argc) {
+            socketPath = argv[++i];
+        } else if (arg.compare(0, 10, "--connect=") == 0) {
+            socketPath = arg.substr(10);
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    if (!socketPath.empty()) {
+        int status = forwardToServer(socketPath, args);
+
+        if (status >= 0) {
+            return status;
+        }
+    }
+
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+
+    return compile(args.size(), args.data());
 }
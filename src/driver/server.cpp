@@ -0,0 +1,339 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "server.h"
+
+namespace soyac {
+namespace driver {
+
+/*
+ * A request consists of the number of strings that follow, sent together
+ * with the client's standard input, output and error file descriptors,
+ * and the strings themselves, each preceded by its length: the client's
+ * working directory and its command-line arguments. The reply is the
+ * exit status of the compilation.
+ */
+
+static const int NUM_FORWARDED_FDS = 3;
+
+/**
+ * Fills in the address of the Unix domain socket at the passed path.
+ *
+ * @param socketPath  The socket's path.
+ * @param address     The address to fill in.
+ * @return            @c false if the path is too long for a socket address;
+ *                    @c true otherwise.
+ */
+static bool socket_address(const std::string& socketPath, sockaddr_un& address)
+{
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+
+    if (socketPath.length() >= sizeof(address.sun_path)) {
+        return false;
+    }
+
+    std::strcpy(address.sun_path, socketPath.c_str());
+    return true;
+}
+
+/**
+ * Writes the passed data to a socket, retrying until all of it is written.
+ *
+ * @param fd    The socket.
+ * @param data  The data to write.
+ * @param size  The size of the data.
+ * @return      @c true if all data was written; @c false otherwise.
+ */
+static bool write_all(int fd, const void* data, std::size_t size)
+{
+    const char* p = (const char*)data;
+
+    while (size > 0) {
+        ssize_t written = write(fd, p, size);
+
+        if (written < 0 && errno == EINTR) {
+            continue;
+        } else if (written <= 0) {
+            return false;
+        }
+
+        p += written;
+        size -= written;
+    }
+
+    return true;
+}
+
+/**
+ * Reads the passed number of bytes from a socket.
+ *
+ * @param fd    The socket.
+ * @param data  Where to store the data.
+ * @param size  The number of bytes to read.
+ * @return      @c true if all bytes were read; @c false otherwise.
+ */
+static bool read_all(int fd, void* data, std::size_t size)
+{
+    char* p = (char*)data;
+
+    while (size > 0) {
+        ssize_t numRead = read(fd, p, size);
+
+        if (numRead < 0 && errno == EINTR) {
+            continue;
+        } else if (numRead <= 0) {
+            return false;
+        }
+
+        p += numRead;
+        size -= numRead;
+    }
+
+    return true;
+}
+
+/**
+ * Reads a request from a client connection and runs the compiler for it
+ * in a worker process. Returns the exit status to send back to the client,
+ * or -1 if the request cannot be read.
+ *
+ * @param conn      The client connection.
+ * @param compiler  The function compiling the request.
+ * @return          The request's exit status, or -1.
+ */
+static int handle_request(int conn, CompilerFunction compiler)
+{
+    uint32_t count;
+    int fds[NUM_FORWARDED_FDS];
+    char control[CMSG_SPACE(sizeof(fds))];
+    iovec iov = { &count, sizeof(count) };
+    msghdr message;
+
+    std::memset(&message, 0, sizeof(message));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    if (recvmsg(conn, &message, MSG_WAITALL) != sizeof(count)) {
+        return -1;
+    }
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+
+    if (cmsg == nullptr || cmsg->cmsg_type != SCM_RIGHTS
+        || cmsg->cmsg_len != CMSG_LEN(sizeof(fds))) {
+        return -1;
+    }
+
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+    /*
+     * The first string is the working directory, the others are the
+     * command-line arguments.
+     */
+    std::vector<std::string> strings;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t length;
+
+        if (!read_all(conn, &length, sizeof(length))) {
+            return -1;
+        }
+
+        strings.emplace_back(length, '\0');
+
+        if (!read_all(conn, &strings.back()[0], length)) {
+            return -1;
+        }
+    }
+
+    if (strings.size() < 2) {
+        return -1;
+    }
+
+    pid_t worker = fork();
+
+    if (worker == 0) {
+        close(conn);
+
+        for (int i = 0; i < NUM_FORWARDED_FDS; i++) {
+            dup2(fds[i], i);
+            close(fds[i]);
+        }
+
+        if (chdir(strings[0].c_str()) != 0) {
+            std::cerr << config::programName << ": cannot change to `"
+                      << strings[0] << "': " << std::strerror(errno)
+                      << std::endl;
+            std::exit(1);
+        }
+
+        std::vector<const char*> args;
+
+        for (std::size_t i = 1; i < strings.size(); i++) {
+            args.push_back(strings[i].c_str());
+        }
+
+        args.push_back(nullptr);
+        std::exit(compiler(args.size() - 1, args.data()));
+    }
+
+    for (int i = 0; i < NUM_FORWARDED_FDS; i++) {
+        close(fds[i]);
+    }
+
+    int status;
+
+    if (worker < 0 || waitpid(worker, &status, 0) != worker) {
+        return 1;
+    }
+
+    if (WIFEXITED(status)) {
+        return WEXITSTATUS(status);
+    } else {
+        return 128 + WTERMSIG(status);
+    }
+}
+
+int runServer(const std::string& socketPath, CompilerFunction compiler)
+{
+    sockaddr_un address;
+
+    if (!socket_address(socketPath, address)) {
+        std::cerr << config::programName << ": socket path `" << socketPath
+                  << "' is too long" << std::endl;
+        return 1;
+    }
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(socketPath.c_str());
+
+    if (server < 0
+        || bind(server, (const sockaddr*)&address, sizeof(address)) != 0
+        || listen(server, SOMAXCONN) != 0) {
+        std::cerr << config::programName << ": cannot listen on `"
+                  << socketPath << "': " << std::strerror(errno)
+                  << std::endl;
+        return 1;
+    }
+
+    /*
+     * Every connection is handled by a process of its own, so that the
+     * server can accept new requests while others are compiled. These
+     * processes are reaped automatically.
+     */
+    std::signal(SIGCHLD, SIG_IGN);
+
+    for (;;) {
+        int conn = accept(server, nullptr, nullptr);
+
+        if (conn < 0) {
+            continue;
+        }
+
+        pid_t handler = fork();
+
+        if (handler == 0) {
+            close(server);
+            std::signal(SIGCHLD, SIG_DFL);
+
+            int32_t status = handle_request(conn, compiler);
+
+            if (status >= 0) {
+                write_all(conn, &status, sizeof(status));
+            }
+
+            _exit(0);
+        }
+
+        close(conn);
+    }
+}
+
+int forwardToServer(
+    const std::string& socketPath, const std::vector<const char*>& args)
+{
+    sockaddr_un address;
+
+    if (!socket_address(socketPath, address)) {
+        return -1;
+    }
+
+    int conn = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (conn < 0
+        || connect(conn, (const sockaddr*)&address, sizeof(address)) != 0) {
+        if (conn >= 0) {
+            close(conn);
+        }
+
+        return -1;
+    }
+
+    char* cwd = getcwd(nullptr, 0);
+    std::vector<std::string> strings;
+    strings.push_back((cwd != nullptr) ? cwd : ".");
+    strings.insert(strings.end(), args.begin(), args.end());
+    std::free(cwd);
+
+    uint32_t count = strings.size();
+    int fds[NUM_FORWARDED_FDS] = { STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO };
+    char control[CMSG_SPACE(sizeof(fds))];
+    iovec iov = { &count, sizeof(count) };
+    msghdr message;
+
+    std::memset(&message, 0, sizeof(message));
+    std::memset(control, 0, sizeof(control));
+    message.msg_iov = &iov;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&message);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    bool sent = (sendmsg(conn, &message, 0) == sizeof(count));
+
+    for (std::size_t i = 0; sent && i < strings.size(); i++) {
+        uint32_t length = strings[i].length();
+        sent = write_all(conn, &length, sizeof(length))
+            && write_all(conn, strings[i].data(), length);
+    }
+
+    int32_t status;
+
+    if (!sent || !read_all(conn, &status, sizeof(status))) {
+        std::cerr << config::programName
+                  << ": the compile server terminated unexpectedly"
+                  << std::endl;
+        status = 1;
+    }
+
+    close(conn);
+    return status;
+}
+
+} // namespace driver
+} // namespace soyac
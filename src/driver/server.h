@@ -0,0 +1,62 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_SERVER_H_
+#define SOYA_SERVER_H_
+
+#include <string>
+#include <vector>
+
+namespace soyac {
+namespace driver {
+
+/**
+ * A function which runs the compiler with the passed command-line
+ * arguments and returns its exit status.
+ */
+typedef int (*CompilerFunction)(int argc, const char** argv);
+
+/**
+ * Runs a compile server listening on the Unix domain socket at the passed
+ * path, which is created (or replaced) for this purpose. For every request
+ * received from forwardToServer(), a worker process is forked from the
+ * server, changes to the client's working directory, takes over its
+ * standard input, output and error streams and runs the passed compiler
+ * function with the client's arguments. The worker's exit status is then
+ * sent back to the client.
+ *
+ * As the workers are forked, they start out with everything loaded and
+ * initialized by the server before, but any state they change is
+ * discarded with them.
+ *
+ * This function only returns if the socket cannot be set up.
+ *
+ * @param socketPath  The path of the socket to listen on.
+ * @param compiler    The function compiling a request.
+ * @return            The exit status to terminate the server with.
+ */
+int runServer(const std::string& socketPath, CompilerFunction compiler);
+
+/**
+ * Forwards the passed command-line arguments (including the program name)
+ * to the compile server listening on the passed socket, together with the
+ * current working directory and standard streams, and waits for the
+ * server to compile them.
+ *
+ * @param socketPath  The path of the server's socket.
+ * @param args        The command-line arguments.
+ * @return            The exit status of the compilation, or -1 if no server
+ *                    is listening on the socket.
+ */
+int forwardToServer(
+    const std::string& socketPath, const std::vector<const char*>& args);
+
+} // namespace driver
+} // namespace soyac
+
+#endif
@@ -0,0 +1,156 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_INTERFACE_FORMAT_H_
+#define SOYA_INTERFACE_FORMAT_H_
+
+#include <cstdint>
+
+/*
+ * The layout of binary interface files (.soyb). A binary interface file
+ * describes the declarations of an analyzed module: all types, functions,
+ * variables, constructors and properties with their resolved types. It is
+ * read by mapping it into memory and pointing the record arrays below into
+ * the mapping, so all records are plain, fixed-size and aligned to their
+ * size.
+ *
+ * A file starts with a FileHeader, followed by the sections it refers to.
+ * Strings are stored as null-terminated UTF-8 byte sequences in the string
+ * section and referred to by their byte offset in it. All other references
+ * are indices into the respective section. Integers are stored in the byte
+ * order of the machine which wrote the file; files written with another
+ * byte order are rejected because of their mismatching magic number.
+ */
+
+namespace soyac {
+namespace interface {
+
+/**
+ * The magic number at the start of every binary interface file ("SOYB" in
+ * the byte order of the writing machine).
+ */
+const uint32_t INTERFACE_MAGIC = 0x42594f53;
+
+/**
+ * The format version. Files with another version are not read.
+ */
+const uint32_t INTERFACE_VERSION = 1;
+
+/**
+ * Marks an absent type or entity reference.
+ */
+const uint32_t NO_INDEX = 0xffffffff;
+
+/**
+ * The kinds of TypeRecord.
+ */
+enum TypeKind {
+    TYPE_KIND_INTEGER, ///< a = size (see IntegerType::get()), b = signedness
+    TYPE_KIND_BOOLEAN,
+    TYPE_KIND_CHARACTER,
+    TYPE_KIND_FLOAT,
+    TYPE_KIND_DOUBLE,
+    TYPE_KIND_VOID,
+    TYPE_KIND_ARRAY, ///< a = element type
+    TYPE_KIND_FUNCTION, ///< a = return type, b/c = parameter type indices
+    TYPE_KIND_DECLARED, ///< a = entity declared in the file
+    TYPE_KIND_IMPORTED ///< a = module name, b = type name
+};
+
+/**
+ * The kinds of EntityRecord.
+ */
+enum EntityKind {
+    ENTITY_KIND_CLASS,
+    ENTITY_KIND_CONSTRUCTOR,
+    ENTITY_KIND_ENUM,
+    ENTITY_KIND_FUNCTION,
+    ENTITY_KIND_PROPERTY,
+    ENTITY_KIND_STRUCT,
+    ENTITY_KIND_VARIABLE
+};
+
+/**
+ * Flags of property entities.
+ */
+enum PropertyFlags { PROPERTY_HAS_GET = 1, PROPERTY_HAS_SET = 2 };
+
+/**
+ * A contiguous range of records in the file.
+ */
+struct Section {
+    uint32_t offset; ///< byte offset from the start of the file
+    uint32_t count; ///< number of records (bytes for the string section)
+};
+
+/**
+ * The header at the start of a binary interface file.
+ */
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t moduleName; ///< string
+    uint32_t firstImport; ///< first string index in the index section
+    uint32_t importCount;
+    uint32_t declarationCount; ///< entities 0 to declarationCount - 1
+    Section strings;
+    Section indices; ///< uint32_t
+    Section types; ///< TypeRecord
+    Section entities; ///< EntityRecord
+    Section parameters; ///< ParameterRecord
+    Section constants; ///< ConstantRecord
+};
+
+/**
+ * A type used in the declarations. Types only refer to types with a lower
+ * index, or to entities.
+ */
+struct TypeRecord {
+    uint32_t kind;
+    uint32_t a;
+    uint32_t b;
+    uint32_t c;
+};
+
+/**
+ * A declared entity. The members of a class or struct are stored as
+ * consecutive records, as are the parameters of a function or
+ * constructor and the values of an enum.
+ */
+struct EntityRecord {
+    uint32_t kind;
+    uint32_t modifiers; ///< bit n set = DeclaredEntity::Modifier n
+    uint32_t name; ///< string
+    uint32_t type; ///< (return) type or enum's underlying type
+    uint32_t baseClass; ///< type or NO_INDEX
+    uint32_t first; ///< first member, parameter or value
+    uint32_t count; ///< number of members, parameters or values
+    uint32_t flags; ///< PropertyFlags
+};
+
+/**
+ * A function or constructor parameter.
+ */
+struct ParameterRecord {
+    uint32_t name; ///< string
+    uint32_t type;
+};
+
+/**
+ * An enum value.
+ */
+struct ConstantRecord {
+    uint32_t name; ///< string
+    uint32_t isSigned;
+    int64_t value;
+};
+
+} // namespace interface
+} // namespace soyac
+
+#endif
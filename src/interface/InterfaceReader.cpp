@@ -0,0 +1,463 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <boost/format.hpp>
+#include <stdexcept>
+
+#include <analysis/SymbolTable.h>
+#include <ast/ast.h>
+
+#include "InterfaceReader.h"
+
+using namespace soyac::ast;
+using soyac::analysis::SymbolTable;
+
+namespace soyac {
+namespace interface {
+
+/**
+ * Returns @c true if a section of records of the passed size lies within
+ * a file of the passed size and is properly aligned.
+ *
+ * @param section     The section.
+ * @param recordSize  The size of the section's records.
+ * @param fileSize    The file's size.
+ * @return            Whether the section is valid.
+ */
+static bool is_valid_section(
+    const Section& section, std::size_t recordSize, std::size_t fileSize)
+{
+    return section.offset % 8 == 0 && section.offset <= fileSize
+        && section.count <= (fileSize - section.offset) / recordSize;
+}
+
+InterfaceReader::InterfaceReader(const std::string& fileName)
+    : mFileName(fileName)
+    , mFile(fileName)
+    , mHeader((const FileHeader*)mFile.data())
+    , mModule(nullptr)
+{
+}
+
+bool InterfaceReader::isValid() const
+{
+    if (mFile.size() < sizeof(FileHeader)
+        || mHeader->magic != INTERFACE_MAGIC
+        || mHeader->version != INTERFACE_VERSION) {
+        return false;
+    }
+
+    if (!is_valid_section(mHeader->strings, 1, mFile.size())
+        || !is_valid_section(mHeader->indices, sizeof(uint32_t), mFile.size())
+        || !is_valid_section(mHeader->types, sizeof(TypeRecord), mFile.size())
+        || !is_valid_section(
+            mHeader->entities, sizeof(EntityRecord), mFile.size())
+        || !is_valid_section(
+            mHeader->parameters, sizeof(ParameterRecord), mFile.size())
+        || !is_valid_section(
+            mHeader->constants, sizeof(ConstantRecord), mFile.size())) {
+        return false;
+    }
+
+    /*
+     * If the string section ends with a null character, every string in
+     * it does.
+     */
+    if (mHeader->strings.count == 0
+        || mFile.data()[mHeader->strings.offset + mHeader->strings.count - 1]
+            != '\0') {
+        return false;
+    }
+
+    try {
+        scanHeader();
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+
+    return true;
+}
+
+parser::ModuleHeader InterfaceReader::scanHeader() const
+{
+    parser::ModuleHeader header;
+    header.moduleName = string(mHeader->moduleName);
+
+    for (uint32_t i = 0; i < mHeader->importCount; i++) {
+        header.importedModules.insert(string(
+            *record<uint32_t>(mHeader->indices, mHeader->firstImport + i)));
+    }
+
+    return header;
+}
+
+void InterfaceReader::read(Module* m, PassResult*& result)
+{
+    PassResultBuilder resultBuilder;
+    mModule = m;
+
+    try {
+        if (!isValid()) {
+            throw std::runtime_error(
+                "Not a binary interface file, or written by an incompatible "
+                "compiler version.");
+        }
+
+        mTypes.assign(mHeader->types.count, nullptr);
+        mEntities.assign(mHeader->entities.count, nullptr);
+
+        if (mHeader->declarationCount > mEntities.size()) {
+            throw std::runtime_error("Malformed binary interface file.");
+        }
+
+        /*
+         * Create the types first, as all other declarations may refer
+         * to them.
+         */
+        for (uint32_t i = 0; i < mEntities.size(); i++) {
+            uint32_t kind = record<EntityRecord>(mHeader->entities, i)->kind;
+
+            if (kind == ENTITY_KIND_CLASS || kind == ENTITY_KIND_ENUM
+                || kind == ENTITY_KIND_STRUCT) {
+                mEntities[i] = createEntity(i);
+            }
+        }
+
+        for (uint32_t i = 0; i < mEntities.size(); i++) {
+            if (mEntities[i] == nullptr) {
+                mEntities[i] = createEntity(i);
+            }
+        }
+
+        for (uint32_t i = 0; i < mHeader->declarationCount; i++) {
+            m->body()->addStatement(new DeclarationStatement(mEntities[i]));
+        }
+
+        for (uint32_t i = 0; i < mEntities.size(); i++) {
+            if (dynamic_cast<UserDefinedType*>(mEntities[i]) != nullptr) {
+                completeType(i);
+            }
+        }
+
+        /*
+         * Every entity must have been added to the module or to a type.
+         */
+        for (DeclaredEntity* entity : mEntities) {
+            if (entity->parent() == nullptr) {
+                throw std::runtime_error("Malformed binary interface file.");
+            }
+        }
+
+        fillSymbolTable();
+    } catch (const std::runtime_error& e) {
+        resultBuilder.addError(Location(mFileName, 0, 0, 0, 0), e.what());
+    }
+
+    result = resultBuilder.result();
+}
+
+template <class R>
+const R* InterfaceReader::record(const Section& section, uint32_t index) const
+{
+    if (index >= section.count) {
+        throw std::runtime_error("Malformed binary interface file.");
+    }
+
+    return (const R*)(mFile.data() + section.offset) + index;
+}
+
+std::string InterfaceReader::string(uint32_t offset) const
+{
+    if (offset >= mHeader->strings.count) {
+        throw std::runtime_error("Malformed binary interface file.");
+    }
+
+    return std::string(mFile.data() + mHeader->strings.offset + offset);
+}
+
+Type* InterfaceReader::type(uint32_t index)
+{
+    const TypeRecord* r = record<TypeRecord>(mHeader->types, index);
+
+    if (mTypes[index] != nullptr) {
+        return mTypes[index];
+    }
+
+    /*
+     * Composed types only refer to types with lower indices, which rules
+     * out cycles.
+     */
+    auto checkComponent = [index](uint32_t component) {
+        if (component >= index) {
+            throw std::runtime_error("Malformed binary interface file.");
+        }
+
+        return component;
+    };
+
+    Type* ret = nullptr;
+
+    switch (r->kind) {
+    case TYPE_KIND_INTEGER:
+        if ((int)r->a < -1 || (int)r->a > 64) {
+            throw std::runtime_error("Malformed binary interface file.");
+        }
+
+        ret = IntegerType::get((int)r->a, r->b != 0);
+        break;
+    case TYPE_KIND_BOOLEAN:
+        ret = TYPE_BOOL;
+        break;
+    case TYPE_KIND_CHARACTER:
+        ret = TYPE_CHAR;
+        break;
+    case TYPE_KIND_FLOAT:
+        ret = TYPE_FLOAT;
+        break;
+    case TYPE_KIND_DOUBLE:
+        ret = TYPE_DOUBLE;
+        break;
+    case TYPE_KIND_VOID:
+        ret = TYPE_VOID;
+        break;
+    case TYPE_KIND_ARRAY:
+        ret = ArrayType::get(type(checkComponent(r->a)));
+        break;
+    case TYPE_KIND_FUNCTION: {
+        std::vector<Type*> parameterTypes;
+
+        for (uint32_t i = 0; i < r->c; i++) {
+            parameterTypes.push_back(type(checkComponent(
+                *record<uint32_t>(mHeader->indices, r->b + i))));
+        }
+
+        ret = FunctionType::get(type(checkComponent(r->a)),
+            parameterTypes.begin(), parameterTypes.end());
+        break;
+    }
+    case TYPE_KIND_DECLARED:
+        if (r->a < mEntities.size()) {
+            ret = dynamic_cast<Type*>(mEntities[r->a]);
+        }
+        break;
+    case TYPE_KIND_IMPORTED: {
+        std::string moduleName = string(r->a);
+        std::string typeName = string(r->b);
+        Module* m = Module::get(Name(moduleName));
+        SymbolTable* table = (m != nullptr) ? SymbolTable::get(m) : nullptr;
+
+        if (table != nullptr) {
+            ret = dynamic_cast<Type*>(table->lookup(Name(typeName)));
+        }
+
+        if (ret == nullptr) {
+            throw std::runtime_error(
+                (boost::format("Unknown type '%1%.%2%'.") % moduleName
+                    % typeName)
+                    .str());
+        }
+        break;
+    }
+    }
+
+    if (ret == nullptr) {
+        throw std::runtime_error("Malformed binary interface file.");
+    }
+
+    mTypes[index] = ret;
+    return ret;
+}
+
+DeclaredEntity* InterfaceReader::createEntity(uint32_t index)
+{
+    const EntityRecord* r = record<EntityRecord>(mHeader->entities, index);
+    Name name(string(r->name));
+    DeclaredEntity* ret = nullptr;
+
+    std::vector<FunctionParameter*> parameters;
+
+    if (r->kind == ENTITY_KIND_CONSTRUCTOR || r->kind == ENTITY_KIND_FUNCTION) {
+        for (uint32_t i = 0; i < r->count; i++) {
+            const ParameterRecord* p
+                = record<ParameterRecord>(mHeader->parameters, r->first + i);
+
+            parameters.push_back(
+                new FunctionParameter(Name(string(p->name)), type(p->type)));
+        }
+    }
+
+    switch (r->kind) {
+    case ENTITY_KIND_CLASS:
+        ret = new ClassType(name, new DeclarationBlock);
+        break;
+    case ENTITY_KIND_CONSTRUCTOR:
+        /*
+         * Constructors always have an initializer and a body, but neither
+         * is needed to call them.
+         */
+        ret = new Constructor(new UnresolvedDefaultConstructorInitializer,
+            parameters.begin(), parameters.end(), new Block);
+        break;
+    case ENTITY_KIND_ENUM: {
+        IntegerType* underlyingType = dynamic_cast<IntegerType*>(type(r->type));
+        std::vector<EnumConstant*> values;
+
+        if (underlyingType == nullptr) {
+            throw std::runtime_error("Malformed binary interface file.");
+        }
+
+        for (uint32_t i = 0; i < r->count; i++) {
+            const ConstantRecord* c
+                = record<ConstantRecord>(mHeader->constants, r->first + i);
+
+            values.push_back(new EnumConstant(Name(string(c->name)),
+                IntegerValue(c->value, c->isSigned != 0)));
+        }
+
+        ret = new EnumType(name, underlyingType, values.begin(), values.end());
+        break;
+    }
+    case ENTITY_KIND_FUNCTION:
+        ret = new Function(
+            name, type(r->type), parameters.begin(), parameters.end());
+        break;
+    case ENTITY_KIND_PROPERTY:
+        ret = new Property(name, type(r->type),
+            (r->flags & PROPERTY_HAS_GET) ? new PropertyGetAccessor(nullptr)
+                                          : nullptr,
+            (r->flags & PROPERTY_HAS_SET) ? new PropertySetAccessor(nullptr)
+                                          : nullptr);
+        break;
+    case ENTITY_KIND_STRUCT:
+        ret = new StructType(name, new DeclarationBlock);
+        break;
+    case ENTITY_KIND_VARIABLE:
+        ret = new Variable(name, type(r->type));
+        break;
+    default:
+        throw std::runtime_error("Malformed binary interface file.");
+    }
+
+    for (int modifier = DeclaredEntity::EXTERN;
+        modifier <= DeclaredEntity::STATIC; modifier++) {
+        if (r->modifiers & (1u << modifier)) {
+            ret->addModifier((DeclaredEntity::Modifier)modifier);
+        }
+    }
+
+    return ret;
+}
+
+void InterfaceReader::completeType(uint32_t index)
+{
+    const EntityRecord* r = record<EntityRecord>(mHeader->entities, index);
+    UserDefinedType* udt = (UserDefinedType*)mEntities[index];
+    ClassType* cls = dynamic_cast<ClassType*>(udt);
+
+    /*
+     * Replace the base class placeholder created by the ClassType
+     * constructor, like BasicAnalyzer::visitClassType() does.
+     */
+    if (cls != nullptr) {
+        if (r->baseClass == NO_INDEX) {
+            delete cls->baseClass();
+        } else {
+            ClassType* base = dynamic_cast<ClassType*>(type(r->baseClass));
+
+            for (ClassType* c = base; c != nullptr;
+                c = dynamic_cast<ClassType*>(c->baseClass())) {
+                if (c == cls) {
+                    throw std::runtime_error(
+                        "Malformed binary interface file.");
+                }
+            }
+
+            cls->baseClass()->replaceWith(base);
+        }
+    }
+
+    for (uint32_t i = r->first; i < r->first + r->count; i++) {
+        if (i < mHeader->declarationCount || i >= mEntities.size()
+            || mEntities[i]->parent() != nullptr) {
+            throw std::runtime_error("Malformed binary interface file.");
+        }
+
+        udt->body()->addDeclaration(new DeclarationStatement(mEntities[i]));
+    }
+}
+
+void InterfaceReader::fillSymbolTable()
+{
+    SymbolTable* table = SymbolTable::get(mModule, true);
+
+    for (uint32_t i = 0; i < mHeader->declarationCount; i++) {
+        table->addGlobal(mEntities[i]);
+    }
+
+    for (DeclaredEntity* entity : mEntities) {
+        if (ClassType* cls = dynamic_cast<ClassType*>(entity)) {
+            table->enterScope(cls);
+
+            for (ClassType* base = dynamic_cast<ClassType*>(cls->baseClass());
+                base != nullptr;
+                base = dynamic_cast<ClassType*>(base->baseClass())) {
+                for (DeclarationBlock::declarations_iterator it
+                    = base->body()->declarations_begin();
+                    it != base->body()->declarations_end(); it++) {
+                    DeclaredEntity* member = (*it)->declaredEntity();
+
+                    if (!member->hasModifier(DeclaredEntity::PRIVATE)
+                        && dynamic_cast<Constructor*>(member) == nullptr
+                        && dynamic_cast<Variable*>(member) == nullptr) {
+                        table->add(member);
+                    }
+                }
+            }
+
+            /*
+             * Non-private member variables are accessed through the
+             * properties generated for them.
+             */
+            for (DeclarationBlock::declarations_iterator it
+                = cls->body()->declarations_begin();
+                it != cls->body()->declarations_end(); it++) {
+                DeclaredEntity* member = (*it)->declaredEntity();
+
+                if (dynamic_cast<Variable*>(member) == nullptr
+                    || member->hasModifier(DeclaredEntity::PRIVATE)) {
+                    table->add(member);
+                }
+            }
+
+            table->leaveScope();
+        } else if (StructType* st = dynamic_cast<StructType*>(entity)) {
+            table->enterScope(st);
+
+            for (DeclarationBlock::declarations_iterator it
+                = st->body()->declarations_begin();
+                it != st->body()->declarations_end(); it++) {
+                table->add((*it)->declaredEntity());
+            }
+
+            table->leaveScope();
+        } else if (EnumType* et = dynamic_cast<EnumType*>(entity)) {
+            table->enterScope(et);
+
+            for (EnumType::values_iterator it = et->values_begin();
+                it != et->values_end(); it++) {
+                table->add(*it);
+            }
+
+            table->add(et->equalsMethod());
+            table->leaveScope();
+        }
+    }
+}
+
+} // namespace interface
+} // namespace soyac
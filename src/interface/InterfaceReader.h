@@ -0,0 +1,141 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_INTERFACE_READER_H_
+#define SOYA_INTERFACE_READER_H_
+
+#include <ast/DeclaredEntity.h>
+#include <ast/Module.h>
+#include <ast/Type.h>
+#include <common/PassResult.h>
+#include <parser/ParserDriver.h>
+#include <parser/SourceFile.h>
+#include <string>
+#include <vector>
+
+#include "InterfaceFormat.h"
+
+namespace soyac {
+namespace interface {
+
+/**
+ * Reads a binary interface file written by InterfaceWriter. The file is
+ * mapped into memory, and its records are used in place; no parsing or
+ * analysis is involved in restoring the declarations it describes.
+ */
+class InterfaceReader {
+public:
+    /**
+     * Opens a binary interface file.
+     *
+     * If the file cannot be opened or read, a std::ifstream::failure
+     * exception is thrown; errno describes the cause of the failure.
+     *
+     * @throw std::ifstream::failure  If an I/O error occurs.
+     *
+     * @param fileName  The path to the binary interface file.
+     */
+    InterfaceReader(const std::string& fileName);
+
+    /**
+     * Returns @c true if the file is a binary interface file of the format
+     * version understood by this compiler. Only the header is checked;
+     * read() reports any inconsistencies in the rest of the file.
+     *
+     * @return  Whether the file can be read.
+     */
+    bool isValid() const;
+
+    /**
+     * Returns the name of the module described by the file, and the names
+     * of the modules whose types are used in its declarations. The file
+     * must be valid (see isValid()).
+     *
+     * @return  The file's module name and imported modules.
+     */
+    parser::ModuleHeader scanHeader() const;
+
+    /**
+     * Adds the declarations described by the file to the passed module and
+     * fills the module's symbol table, so that other modules can import
+     * it as if it had been parsed and analyzed. (Usually, the module is
+     * the one named by scanHeader().) All modules returned by scanHeader()
+     * must have been processed before.
+     *
+     * If the file turns out to be malformed or refers to a type which does
+     * not exist, a PassResult with the error information is created, to
+     * which a pointer is stored at the passed location.
+     *
+     * @param m       The module to add the declarations to.
+     * @param result  The location at which to store the PassResult pointer.
+     */
+    void read(soyac::ast::Module* m, PassResult*& result);
+
+private:
+    std::string mFileName;
+    parser::SourceFile mFile;
+    const FileHeader* mHeader;
+    soyac::ast::Module* mModule;
+    std::vector<soyac::ast::Type*> mTypes;
+    std::vector<soyac::ast::DeclaredEntity*> mEntities;
+
+    /**
+     * Returns a pointer to the record with the passed index in a section,
+     * or throws an exception if the index is out of range.
+     *
+     * @param section  The section.
+     * @param index    The record's index.
+     * @return         The record.
+     */
+    template <class R>
+    const R* record(const Section& section, uint32_t index) const;
+
+    /**
+     * Returns the string at the passed offset in the string section.
+     *
+     * @param offset  The string's offset.
+     * @return        The string.
+     */
+    std::string string(uint32_t offset) const;
+
+    /**
+     * Returns the type with the passed index.
+     *
+     * @param index  The type's index.
+     * @return       The type.
+     */
+    soyac::ast::Type* type(uint32_t index);
+
+    /**
+     * Creates the entity with the passed index. The members of classes
+     * and structs are not created yet.
+     *
+     * @param index  The entity's index.
+     * @return       The entity.
+     */
+    soyac::ast::DeclaredEntity* createEntity(uint32_t index);
+
+    /**
+     * Adds the members of the class or struct with the passed index and
+     * resolves the class' base class.
+     *
+     * @param index  The class' or struct's index.
+     */
+    void completeType(uint32_t index);
+
+    /**
+     * Adds the module's declarations to its symbol table, in the same way
+     * as analysis::BasicAnalyzer does.
+     */
+    void fillSymbolTable();
+};
+
+} // namespace interface
+} // namespace soyac
+
+#endif
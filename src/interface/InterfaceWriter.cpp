@@ -0,0 +1,346 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+#include <ast/ast.h>
+
+#include "InterfaceWriter.h"
+
+using namespace soyac::ast;
+using std::filesystem::path;
+
+namespace soyac {
+namespace interface {
+
+/**
+ * Returns the modifiers of a declared entity as bit mask (see
+ * EntityRecord::modifiers).
+ *
+ * @param entity  The declared entity.
+ * @return        The entity's modifier mask.
+ */
+static uint32_t modifier_mask(DeclaredEntity* entity)
+{
+    static const DeclaredEntity::Modifier modifiers[]
+        = { DeclaredEntity::EXTERN, DeclaredEntity::PRIVATE,
+              DeclaredEntity::PROTECTED, DeclaredEntity::PUBLIC,
+              DeclaredEntity::STATIC };
+
+    uint32_t mask = 0;
+
+    for (DeclaredEntity::Modifier modifier : modifiers) {
+        if (entity->hasModifier(modifier)) {
+            mask |= 1u << modifier;
+        }
+    }
+
+    return mask;
+}
+
+/**
+ * Appends a section's contents to the passed file image, aligned to eight
+ * bytes, and sets the section's offset and record count.
+ *
+ * @param image    The file image.
+ * @param section  The section.
+ * @param data     The section's contents.
+ * @param count    The number of records.
+ * @param size     The size of the section's contents in bytes.
+ */
+static void append_section(std::string& image, Section& section,
+    const void* data, std::size_t count, std::size_t size)
+{
+    image.resize((image.size() + 7) & ~(std::size_t)7, '\0');
+    section.offset = image.size();
+    section.count = count;
+    image.append((const char*)data, size);
+}
+
+template <class R>
+static void append_section(
+    std::string& image, Section& section, const std::vector<R>& records)
+{
+    append_section(image, section, records.data(), records.size(),
+        records.size() * sizeof(R));
+}
+
+InterfaceWriter::InterfaceWriter(Module* module)
+    : mModule(module)
+{
+}
+
+void InterfaceWriter::write(const path& destination, std::error_code& error)
+{
+    /*
+     * Number the entities breadth-first, so that the module's declarations
+     * come first and the members of every class or struct are numbered
+     * consecutively.
+     */
+    for (Block::statements_iterator it = mModule->body()->statements_begin();
+        it != mModule->body()->statements_end(); it++) {
+        DeclarationStatement* dstmt = dynamic_cast<DeclarationStatement*>(*it);
+
+        if (dstmt != nullptr) {
+            mEntityIndices[dstmt->declaredEntity()] = mEntities.size();
+            mEntities.push_back(dstmt->declaredEntity());
+        }
+    }
+
+    uint32_t declarationCount = mEntities.size();
+    mEntityRecords.resize(mEntities.size());
+
+    for (std::size_t i = 0; i < mEntities.size(); i++) {
+        UserDefinedType* type = dynamic_cast<UserDefinedType*>(mEntities[i]);
+
+        if (type != nullptr) {
+            mEntityRecords[i].first = mEntities.size();
+
+            for (DeclarationBlock::declarations_iterator it
+                = type->body()->declarations_begin();
+                it != type->body()->declarations_end(); it++) {
+                mEntityIndices[(*it)->declaredEntity()] = mEntities.size();
+                mEntities.push_back((*it)->declaredEntity());
+            }
+
+            mEntityRecords[i].count
+                = mEntities.size() - mEntityRecords[i].first;
+            mEntityRecords.resize(mEntities.size());
+        }
+    }
+
+    for (uint32_t i = 0; i < mEntities.size(); i++) {
+        addEntity(i);
+    }
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = INTERFACE_MAGIC;
+    header.version = INTERFACE_VERSION;
+    header.moduleName = addString(mModule->name().str());
+    header.firstImport = mIndices.size();
+    header.importCount = mImportedModules.size();
+    header.declarationCount = declarationCount;
+
+    for (const std::string& name : mImportedModules) {
+        mIndices.push_back(addString(name));
+    }
+
+    std::string image(sizeof(header), '\0');
+    append_section(image, header.strings, mStrings.data(), mStrings.size(),
+        mStrings.size());
+    append_section(image, header.indices, mIndices);
+    append_section(image, header.types, mTypes);
+    append_section(image, header.entities, mEntityRecords);
+    append_section(image, header.parameters, mParameters);
+    append_section(image, header.constants, mConstants);
+    std::memcpy(&image[0], &header, sizeof(header));
+
+    /*
+     * Write to a temporary file first and rename it afterwards, so that
+     * a compiler process reading the interface in parallel never sees a
+     * partially written file.
+     */
+    path tempPath(destination);
+    tempPath += ".tmp";
+
+    std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+    out.write(image.data(), image.size());
+    out.close();
+
+    if (!out) {
+        int cause = (errno != 0) ? errno : EIO;
+        std::error_code ignored;
+        std::filesystem::remove(tempPath, ignored);
+
+        error = std::error_code(cause, std::generic_category());
+        return;
+    }
+
+    std::filesystem::rename(tempPath, destination, error);
+}
+
+uint32_t InterfaceWriter::addString(const std::string& str)
+{
+    std::map<std::string, uint32_t>::iterator it = mStringOffsets.find(str);
+
+    if (it != mStringOffsets.end()) {
+        return it->second;
+    }
+
+    uint32_t offset = mStrings.size();
+    mStrings.append(str.c_str(), str.length() + 1);
+    mStringOffsets[str] = offset;
+
+    return offset;
+}
+
+uint32_t InterfaceWriter::addType(Type* type)
+{
+    std::unordered_map<Type*, uint32_t>::iterator it = mTypeIndices.find(type);
+
+    if (it != mTypeIndices.end()) {
+        return it->second;
+    }
+
+    TypeRecord record;
+    std::memset(&record, 0, sizeof(record));
+
+    if (IntegerType* intType = dynamic_cast<IntegerType*>(type)) {
+        /*
+         * "int" and "long" are distinct from the sized integer types of
+         * the same size and are registered as sizes 0 and -1.
+         */
+        record.kind = TYPE_KIND_INTEGER;
+        record.b = intType->isSigned();
+
+        if (intType == TYPE_INT || intType == TYPE_UINT) {
+            record.a = 0;
+        } else if (intType == TYPE_LONG || intType == TYPE_ULONG) {
+            record.a = (uint32_t)-1;
+        } else {
+            record.a = intType->size();
+        }
+    } else if (type == TYPE_BOOL) {
+        record.kind = TYPE_KIND_BOOLEAN;
+    } else if (type == TYPE_CHAR) {
+        record.kind = TYPE_KIND_CHARACTER;
+    } else if (type == TYPE_FLOAT) {
+        record.kind = TYPE_KIND_FLOAT;
+    } else if (type == TYPE_DOUBLE) {
+        record.kind = TYPE_KIND_DOUBLE;
+    } else if (type == TYPE_VOID) {
+        record.kind = TYPE_KIND_VOID;
+    } else if (ArrayType* arrayType = dynamic_cast<ArrayType*>(type)) {
+        record.kind = TYPE_KIND_ARRAY;
+        record.a = addType(arrayType->elementType());
+    } else if (FunctionType* funcType = dynamic_cast<FunctionType*>(type)) {
+        std::vector<uint32_t> parameterTypes;
+
+        for (FunctionType::parameterTypes_iterator pit
+            = funcType->parameterTypes_begin();
+            pit != funcType->parameterTypes_end(); pit++) {
+            parameterTypes.push_back(addType(*pit));
+        }
+
+        record.kind = TYPE_KIND_FUNCTION;
+        record.a = addType(funcType->returnType());
+        record.b = mIndices.size();
+        record.c = parameterTypes.size();
+        mIndices.insert(
+            mIndices.end(), parameterTypes.begin(), parameterTypes.end());
+    } else if (mEntityIndices.count(type) != 0) {
+        record.kind = TYPE_KIND_DECLARED;
+        record.a = mEntityIndices[type];
+    } else {
+        /*
+         * A type declared in another module. Types are only declared at
+         * module level, so the qualified name consists of the module's
+         * name and the type's name.
+         */
+        Name qname = type->qualifiedName();
+        assert(dynamic_cast<UnknownType*>(type) == nullptr);
+        assert(qname.countIdentifiers() == 2);
+
+        record.kind = TYPE_KIND_IMPORTED;
+        record.a = addString(qname.first().str());
+        record.b = addString(qname.last().str());
+        mImportedModules.insert(qname.first().str());
+    }
+
+    uint32_t index = mTypes.size();
+    mTypes.push_back(record);
+    mTypeIndices[type] = index;
+
+    return index;
+}
+
+void InterfaceWriter::addEntity(uint32_t index)
+{
+    DeclaredEntity* entity = mEntities[index];
+    EntityRecord record = mEntityRecords[index];
+
+    record.modifiers = modifier_mask(entity);
+    record.name = addString(entity->name().str());
+    record.type = NO_INDEX;
+    record.baseClass = NO_INDEX;
+    record.flags = 0;
+
+    if (ClassType* classType = dynamic_cast<ClassType*>(entity)) {
+        record.kind = ENTITY_KIND_CLASS;
+
+        if (classType->baseClass() != nullptr) {
+            record.baseClass = addType(classType->baseClass());
+        }
+    } else if (dynamic_cast<StructType*>(entity) != nullptr) {
+        record.kind = ENTITY_KIND_STRUCT;
+    } else if (EnumType* enumType = dynamic_cast<EnumType*>(entity)) {
+        record.kind = ENTITY_KIND_ENUM;
+        record.type = addType(enumType->underlyingType());
+        record.first = mConstants.size();
+
+        for (EnumType::values_iterator it = enumType->values_begin();
+            it != enumType->values_end(); it++) {
+            ConstantRecord constant;
+            constant.name = addString((*it)->name().str());
+            constant.isSigned = (*it)->value().isSigned();
+            constant.value = (*it)->value().data();
+            mConstants.push_back(constant);
+        }
+
+        record.count = mConstants.size() - record.first;
+    } else if (Constructor* cons = dynamic_cast<Constructor*>(entity)) {
+        record.kind = ENTITY_KIND_CONSTRUCTOR;
+        addParameters(cons, record);
+    } else if (Function* func = dynamic_cast<Function*>(entity)) {
+        record.kind = ENTITY_KIND_FUNCTION;
+        record.type = addType(func->returnType());
+        addParameters(func, record);
+    } else if (Property* prop = dynamic_cast<Property*>(entity)) {
+        record.kind = ENTITY_KIND_PROPERTY;
+        record.type = addType(prop->type());
+
+        if (prop->getAccessor() != nullptr) {
+            record.flags |= PROPERTY_HAS_GET;
+        }
+
+        if (prop->setAccessor() != nullptr) {
+            record.flags |= PROPERTY_HAS_SET;
+        }
+    } else if (Variable* var = dynamic_cast<Variable*>(entity)) {
+        record.kind = ENTITY_KIND_VARIABLE;
+        record.type = addType(var->type());
+    } else {
+        assert(false);
+    }
+
+    mEntityRecords[index] = record;
+}
+
+void InterfaceWriter::addParameters(Function* func, EntityRecord& record)
+{
+    std::vector<ParameterRecord> parameters;
+
+    for (Function::parameters_iterator it = func->parameters_begin();
+        it != func->parameters_end(); it++) {
+        ParameterRecord parameter;
+        parameter.name = addString((*it)->name().str());
+        parameter.type = addType((*it)->type());
+        parameters.push_back(parameter);
+    }
+
+    record.first = mParameters.size();
+    record.count = parameters.size();
+    mParameters.insert(mParameters.end(), parameters.begin(), parameters.end());
+}
+
+} // namespace interface
+} // namespace soyac
@@ -0,0 +1,108 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_INTERFACE_WRITER_H_
+#define SOYA_INTERFACE_WRITER_H_
+
+#include <ast/DeclaredEntity.h>
+#include <ast/Function.h>
+#include <ast/Module.h>
+#include <ast/Type.h>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+#include "InterfaceFormat.h"
+
+namespace soyac {
+namespace interface {
+
+/**
+ * Writes the declarations of an analyzed module to a binary interface file
+ * (see InterfaceFormat.h), from which InterfaceReader can restore them
+ * much faster than an interface file can be parsed and analyzed.
+ */
+class InterfaceWriter {
+public:
+    /**
+     * Creates an InterfaceWriter.
+     *
+     * @param module  The module whose declarations should be written. The
+     *                module must have been analyzed without errors.
+     */
+    InterfaceWriter(soyac::ast::Module* module);
+
+    /**
+     * Writes the binary interface file.
+     *
+     * @param destination  The path of the file to write.
+     * @param error        Set to the cause of the failure if the file
+     *                     cannot be written.
+     */
+    void write(
+        const std::filesystem::path& destination, std::error_code& error);
+
+private:
+    soyac::ast::Module* mModule;
+    std::vector<soyac::ast::DeclaredEntity*> mEntities;
+    std::unordered_map<soyac::ast::NamedEntity*, uint32_t> mEntityIndices;
+    std::map<std::string, uint32_t> mStringOffsets;
+    std::set<std::string> mImportedModules;
+    std::unordered_map<soyac::ast::Type*, uint32_t> mTypeIndices;
+    std::string mStrings;
+    std::vector<uint32_t> mIndices;
+    std::vector<TypeRecord> mTypes;
+    std::vector<EntityRecord> mEntityRecords;
+    std::vector<ParameterRecord> mParameters;
+    std::vector<ConstantRecord> mConstants;
+
+    /**
+     * Adds a string to the string section, unless it is already there,
+     * and returns its offset.
+     *
+     * @param str  The string to add.
+     * @return     The string's offset.
+     */
+    uint32_t addString(const std::string& str);
+
+    /**
+     * Adds a type (and the types it is composed of) to the type section,
+     * unless it is already there, and returns its index.
+     *
+     * @param type  The type to add.
+     * @return      The type's index.
+     */
+    uint32_t addType(soyac::ast::Type* type);
+
+    /**
+     * Adds a record for the entity with the passed index to the entity
+     * section. The entities' members must already have been assigned
+     * indices.
+     *
+     * @param index  The entity's index in mEntities.
+     */
+    void addEntity(uint32_t index);
+
+    /**
+     * Adds the parameters of a function to the parameter section and sets
+     * the range in the passed record accordingly.
+     *
+     * @param func    The function.
+     * @param record  The function's entity record.
+     */
+    void addParameters(soyac::ast::Function* func, EntityRecord& record);
+};
+
+} // namespace interface
+} // namespace soyac
+
+#endif
@@ -6,17 +6,27 @@
  * See LICENSE.txt for details.
  */
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cctype>
 #include <cerrno>
 #include <cstdlib>
-#include <regex>
+#include <cstring>
+#include <sstream>
 #include <stdint.h>
+#include <string_view>
 #include <vector>
 
 #include "utf8.h"
 #include <boost/format.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "Lexer.h"
 #include "ParserDriver.h"
 #include <ast/IntegerType.h>
@@ -27,153 +37,344 @@ using namespace yy;
 namespace soyac {
 namespace parser {
 
-bool Lexer::sInitRegexDone;
-std::regex Lexer::sLineTerminator;
-std::regex Lexer::sWhiteSpace;
-std::regex Lexer::sIdentifierStartChar;
-std::regex Lexer::sIdentifierChar;
-std::regex Lexer::sIntegerType;
-std::map<std::string, int> Lexer::sKeywords;
+/*
+ * Character class flags stored in sAsciiCharClasses.
+ */
+enum {
+    CHAR_LINE_TERMINATOR = 0x01,
+    CHAR_WHITE_SPACE = 0x02,
+    CHAR_IDENTIFIER_START = 0x04,
+    CHAR_IDENTIFIER = 0x08
+};
+
+static constexpr std::array<unsigned char, 128> makeAsciiCharClasses()
+{
+    std::array<unsigned char, 128> classes {};
+
+    classes['\r'] = CHAR_LINE_TERMINATOR;
+    classes['\n'] = CHAR_LINE_TERMINATOR;
+
+    classes[' '] = CHAR_WHITE_SPACE;
+    classes['\t'] = CHAR_WHITE_SPACE;
+    classes['\v'] = CHAR_WHITE_SPACE;
+    classes['\f'] = CHAR_WHITE_SPACE;
+
+    for (int c = 'A'; c <= 'Z'; c++) {
+        classes[c] = CHAR_IDENTIFIER_START | CHAR_IDENTIFIER;
+    }
+
+    for (int c = 'a'; c <= 'z'; c++) {
+        classes[c] = CHAR_IDENTIFIER_START | CHAR_IDENTIFIER;
+    }
+
+    for (int c = '0'; c <= '9'; c++) {
+        classes[c] = CHAR_IDENTIFIER;
+    }
+
+    classes['_'] = CHAR_IDENTIFIER_START | CHAR_IDENTIFIER;
+    return classes;
+}
+
+/*
+ * The character classes of all ASCII characters, indexed by character
+ * code. Characters outside of the ASCII range are decoded and classified
+ * separately (see decodeNonAsciiChar()).
+ */
+static constexpr std::array<unsigned char, 128> sAsciiCharClasses
+    = makeAsciiCharClasses();
+
+/*
+ * Returns the Unicode code point of a multi-byte UTF-8 character, or
+ * U+FFFD (the replacement character) if the byte sequence is malformed.
+ */
+static uint32_t decodeNonAsciiChar(const char* c, int length)
+{
+    try {
+        return utf8::peek_next(c, c + length);
+    } catch (const std::exception&) {
+        return 0xFFFD;
+    }
+}
+
+#if defined(__AVX2__)
+static const int sBlankBlockSize = 32;
+
+/*
+ * Computes bit masks of the blank bytes (see findNonBlank()) and of the
+ * line feed bytes in the sBlankBlockSize bytes starting at p.
+ */
+static void classifyBlankBlock(
+    const char* p, uint32_t& blankMask, uint32_t& lineFeedMask)
+{
+    __m256i block = _mm256_loadu_si256((const __m256i*)p);
+    __m256i isLineFeed = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+    __m256i isBlank = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')),
+            _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'))),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\v')),
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\f'))),
+            isLineFeed));
+
+    blankMask = (uint32_t)_mm256_movemask_epi8(isBlank);
+    lineFeedMask = (uint32_t)_mm256_movemask_epi8(isLineFeed);
+}
+#elif defined(__SSE2__)
+static const int sBlankBlockSize = 16;
+
+/*
+ * Computes bit masks of the blank bytes (see findNonBlank()) and of the
+ * line feed bytes in the sBlankBlockSize bytes starting at p. The upper
+ * 16 bits of blankMask are always set.
+ */
+static void classifyBlankBlock(
+    const char* p, uint32_t& blankMask, uint32_t& lineFeedMask)
+{
+    __m128i block = _mm_loadu_si128((const __m128i*)p);
+    __m128i isLineFeed = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+    __m128i isBlank = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+            _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\v')),
+                         _mm_cmpeq_epi8(block, _mm_set1_epi8('\f'))),
+            isLineFeed));
+
+    blankMask = (uint32_t)_mm_movemask_epi8(isBlank) | 0xFFFF0000;
+    lineFeedMask = (uint32_t)_mm_movemask_epi8(isLineFeed);
+}
+#endif
+
+/*
+ * Returns a pointer to the first byte in [begin, end) that is not a space,
+ * horizontal tab, vertical tab, form feed or line feed character, or end if
+ * there is no such byte. The number of skipped line feeds is added to
+ * numLineFeeds, and lastLineFeed is set to the last of them (if any).
+ *
+ * Where available, SSE2 or AVX2 instructions are used to classify 16 or
+ * 32 bytes at once; the remaining bytes are checked one by one.
+ */
+static const char* findNonBlank(const char* begin, const char* end,
+    int& numLineFeeds, const char*& lastLineFeed)
+{
+    const char* p = begin;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    while (end - p >= sBlankBlockSize) {
+        uint32_t blankMask;
+        uint32_t lineFeedMask;
+        classifyBlankBlock(p, blankMask, lineFeedMask);
+
+        /*
+         * Only count the line feeds before the first non-blank byte.
+         */
+        int numBlanks = (blankMask == 0xFFFFFFFF)
+            ? sBlankBlockSize
+            : __builtin_ctz(~blankMask);
+
+        if (numBlanks < 32) {
+            lineFeedMask &= (1u << numBlanks) - 1;
+        }
+
+        if (lineFeedMask != 0) {
+            numLineFeeds += __builtin_popcount(lineFeedMask);
+            lastLineFeed = p + 31 - __builtin_clz(lineFeedMask);
+        }
+
+        p += numBlanks;
+
+        if (numBlanks < sBlankBlockSize) {
+            return p;
+        }
+    }
+#endif
+
+    for (; p < end; p++) {
+        unsigned char c = (unsigned char)*p;
+
+        if (c == '\n') {
+            numLineFeeds++;
+            lastLineFeed = p;
+        } else if (c >= 0x80 || !(sAsciiCharClasses[c] & CHAR_WHITE_SPACE)) {
+            break;
+        }
+    }
+
+    return p;
+}
 
 Lexer::Lexer(std::istream* stream, const std::string& filename,
     PassResultBuilder* resultBuilder)
-    : mStream(stream)
-    , mFileName(filename)
+    : Lexer("", 0, filename, resultBuilder)
+{
+    assert(stream != nullptr);
+
+    std::ostringstream contents;
+    contents << stream->rdbuf();
+
+    mSource = contents.str();
+    mPosition = mSource.c_str();
+    mEnd = mPosition + mSource.size();
+    mLastChar = mEnd;
+}
+
+Lexer::Lexer(const char* source, std::size_t length,
+    const std::string& filename, PassResultBuilder* resultBuilder)
+    : mFileName(filename)
     , mResultBuilder(resultBuilder)
     , mCurrentLine(1)
     , mCurrentColumn(1)
-    , mLastChar(nullptr)
+    , mPosition(source)
+    , mEnd(source + length)
+    , mLastChar(mEnd)
 {
-    assert(stream != nullptr);
-
-    if (!sInitRegexDone) {
-        initRegex();
-        sInitRegexDone = true;
-    }
-}
-
-Lexer::~Lexer()
-{
-    if (mLastChar != nullptr) {
-        delete[] mLastChar;
-    }
-}
-
-void Lexer::initRegex()
-{
-
-    sWhiteSpace = std::regex("[ \\r\\n\\t]");
-
-    sIdentifierStartChar = std::regex("[A-Za-z_]");
-    sIdentifierChar = std::regex("[A-Za-z0-9_]");
-
-    sIntegerType = std::regex("(u)?int[1-9]?[0-9]*");
-
-    sKeywords = std::map<std::string, int>();
-    sKeywords["alias"] = SoyaParser::token::ALIAS;
-    sKeywords["as"] = SoyaParser::token::AS;
-    sKeywords["bool"] = SoyaParser::token::BOOL;
-    sKeywords["break"] = SoyaParser::token::BREAK;
-    sKeywords["case"] = SoyaParser::token::CASE;
-    sKeywords["char"] = SoyaParser::token::CHAR;
-    sKeywords["class"] = SoyaParser::token::CLASS;
-    sKeywords["const"] = SoyaParser::token::CONST;
-    sKeywords["constructor"] = SoyaParser::token::CONSTRUCTOR;
-    sKeywords["continue"] = SoyaParser::token::CONTINUE;
-    sKeywords["default"] = SoyaParser::token::DEFAULT;
-    sKeywords["do"] = SoyaParser::token::DO;
-    sKeywords["double"] = SoyaParser::token::DOUBLE;
-    sKeywords["else"] = SoyaParser::token::ELSE;
-    sKeywords["enum"] = SoyaParser::token::ENUM;
-    sKeywords["extends"] = SoyaParser::token::EXTENDS;
-    sKeywords["extern"] = SoyaParser::token::EXTERN;
-    sKeywords["false"] = SoyaParser::token::FALSE_;
-    sKeywords["float"] = SoyaParser::token::FLOAT;
-    sKeywords["for"] = SoyaParser::token::FOR;
-    sKeywords["from"] = SoyaParser::token::FROM;
-    sKeywords["function"] = SoyaParser::token::FUNCTION;
-    sKeywords["get"] = SoyaParser::token::GET;
-    sKeywords["if"] = SoyaParser::token::IF;
-    sKeywords["is"] = SoyaParser::token::IS;
-    sKeywords["implements"] = SoyaParser::token::IMPLEMENTS;
-    sKeywords["import"] = SoyaParser::token::IMPORT;
-    sKeywords["int"] = SoyaParser::token::INT;
-    sKeywords["long"] = SoyaParser::token::LONG;
-    sKeywords["module"] = SoyaParser::token::MODULE;
-    sKeywords["new"] = SoyaParser::token::NEW;
-    sKeywords["override"] = SoyaParser::token::OVERRIDE;
-    sKeywords["private"] = SoyaParser::token::PRIVATE;
-    sKeywords["property"] = SoyaParser::token::PROPERTY;
-    sKeywords["protected"] = SoyaParser::token::PROTECTED;
-    sKeywords["public"] = SoyaParser::token::PUBLIC;
-    sKeywords["readonly"] = SoyaParser::token::READONLY;
-    sKeywords["return"] = SoyaParser::token::RETURN;
-    sKeywords["set"] = SoyaParser::token::SET;
-    sKeywords["static"] = SoyaParser::token::STATIC;
-    sKeywords["struct"] = SoyaParser::token::STRUCT;
-    sKeywords["super"] = SoyaParser::token::SUPER;
-    sKeywords["switch"] = SoyaParser::token::SWITCH;
-    sKeywords["this"] = SoyaParser::token::THIS;
-    sKeywords["true"] = SoyaParser::token::TRUE_;
-    sKeywords["uint"] = SoyaParser::token::UINT;
-    sKeywords["ulong"] = SoyaParser::token::ULONG;
-    sKeywords["var"] = SoyaParser::token::VAR;
-    sKeywords["virtual"] = SoyaParser::token::VIRTUAL;
-    sKeywords["void"] = SoyaParser::token::VOID;
-    sKeywords["while"] = SoyaParser::token::WHILE;
-    sKeywords["xor"] = SoyaParser::token::XOR;
+    assert(source != nullptr && source[length] == '\0');
 }
 
 const std::string& Lexer::fileName() const { return mFileName; }
 
-int Lexer::nextToken(
-    SoyaParser::semantic_type* yylval, SoyaParser::location_type* yylloc)
+int Lexer::charLength(const char* c)
 {
-    const char* utf8_char = lookAhead();
-
     /*
-     * End of file
+     * If the first byte is a valid ASCII character (that is, the most
+     * significant bit is 0), the character is one byte long. Otherwise, the
+     * number of leading 1's in the first byte tell us how long the UTF-8
+     * character is.
+     *
+     * See http://en.wikipedia.org/wiki/UTF-8
      */
-    if (utf8_char[0] == '\0') {
-        return -1;
+    unsigned char firstByte = (unsigned char)c[0];
+
+    if (firstByte == '\0') {
+        return 0;
+    } else if (firstByte >> 7 == 0) {
+        return 1;
     }
 
-    /*
-     * Line Terminators
-     */
-    if (std::regex_match(utf8_char, sLineTerminator)) {
-        skipLineTerminator();
-        return nextToken(yylval, yylloc);
+    int length = 2;
+
+    for (int i = 2; i < 4; i++) {
+        if (firstByte & (0x80 >> i)) {
+            length++;
+        } else {
+            break;
+        }
     }
 
     /*
-     * White Space
+     * Never step over the end of the input, even if the last character is
+     * truncated.
      */
-    else if (std::regex_match(utf8_char, sWhiteSpace)) {
-        nextChar();
-        return nextToken(yylval, yylloc);
+    for (int i = 1; i < length; i++) {
+        if (c[i] == '\0') {
+            return i;
+        }
+    }
+
+    return length;
+}
+
+bool Lexer::isLineTerminator(const char* c)
+{
+    unsigned char firstByte = (unsigned char)c[0];
+
+    if (firstByte >> 7 == 0) {
+        return sAsciiCharClasses[firstByte] & CHAR_LINE_TERMINATOR;
     }
 
     /*
-     * Delimited Comments
+     * Line separator (U+2028) and paragraph separator (U+2029).
      */
-    else if (utf8_char[0] == '/' && lookAhead(2)[0] == '*') {
-        skipDelimitedComment();
-        return nextToken(yylval, yylloc);
+    uint32_t codepoint = decodeNonAsciiChar(c, charLength(c));
+    return codepoint == 0x2028 || codepoint == 0x2029;
+}
+
+bool Lexer::isWhiteSpace(const char* c)
+{
+    unsigned char firstByte = (unsigned char)c[0];
+
+    if (firstByte >> 7 == 0) {
+        return sAsciiCharClasses[firstByte] & CHAR_WHITE_SPACE;
     }
 
     /*
-     * Single-Line Comments
+     * Non-ASCII characters of Unicode category Zs.
      */
-    else if (utf8_char[0] == '/' && lookAhead(2)[0] == '/') {
-        skipSingleLineComment();
-        return nextToken(yylval, yylloc);
-    }
+    uint32_t codepoint = decodeNonAsciiChar(c, charLength(c));
+    return codepoint == 0x00A0 || codepoint == 0x1680
+        || (codepoint >= 0x2000 && codepoint <= 0x200A) || codepoint == 0x202F
+        || codepoint == 0x205F || codepoint == 0x3000;
+}
+
+bool Lexer::isIdentifierStartChar(const char* c)
+{
+    unsigned char firstByte = (unsigned char)c[0];
+    return firstByte >> 7 == 0
+        && (sAsciiCharClasses[firstByte] & CHAR_IDENTIFIER_START);
+}
 
+bool Lexer::isIdentifierChar(const char* c)
+{
+    unsigned char firstByte = (unsigned char)c[0];
+    return firstByte >> 7 == 0
+        && (sAsciiCharClasses[firstByte] & CHAR_IDENTIFIER);
+}
+
+int Lexer::nextToken(
+    SoyaParser::semantic_type* yylval, SoyaParser::location_type* yylloc)
+{
     /*
-     * Tokens
+     * Skip line terminators, white space and comments until we find the
+     * start of a token. (This is a loop rather than a recursive call per
+     * skipped element, so that long runs of blank lines or unexpected
+     * characters cannot exhaust the stack.)
      */
-    else {
+    while (true) {
+        skipBlanks();
+
+        const char* utf8_char = lookAhead();
+
+        /*
+         * End of file
+         */
+        if (utf8_char[0] == '\0') {
+            return -1;
+        }
+
+        /*
+         * Line Terminators
+         */
+        if (isLineTerminator(utf8_char)) {
+            skipLineTerminator();
+            continue;
+        }
+
+        /*
+         * White Space
+         */
+        else if (isWhiteSpace(utf8_char)) {
+            nextChar();
+            continue;
+        }
+
+        /*
+         * Delimited Comments
+         */
+        else if (utf8_char[0] == '/' && lookAhead(2)[0] == '*') {
+            skipDelimitedComment();
+            continue;
+        }
+
+        /*
+         * Single-Line Comments
+         */
+        else if (utf8_char[0] == '/' && lookAhead(2)[0] == '/') {
+            skipSingleLineComment();
+            continue;
+        }
+
+        /*
+         * Tokens
+         */
         yylloc->begin.line = mCurrentLine;
         yylloc->begin.column = mCurrentColumn;
 
@@ -182,7 +383,7 @@ int Lexer::nextToken(
         /*
          * Identifiers / Keywords
          */
-        if (std::regex_match(utf8_char, sIdentifierStartChar)) {
+        if (isIdentifierStartChar(utf8_char)) {
             ret = readIdentifierOrKeyword(yylval);
         }
 
@@ -214,10 +415,10 @@ int Lexer::nextToken(
             if (ret == -1) {
                 nextChar();
 
-                addError(str(
-                    boost::format("Unexpected character '%1%'.") % mLastChar));
+                addError(str(boost::format("Unexpected character '%1%'.")
+                    % std::string(mLastChar, charLength(mLastChar))));
 
-                ret = nextToken(yylval, yylloc);
+                continue;
             }
         }
 
@@ -239,31 +440,19 @@ void Lexer::addError(const std::string& description)
 const char* Lexer::nextChar()
 {
     /*
-     * If the buffer is empty, read the next character into it so that
-     * we can return it.
+     * The character we will return (the character at the current position)
+     * is considered the last consumed character after this method. Unless
+     * it is the end of the input, we then proceed to the next character.
      */
-    if (mCharBuffer.empty()) {
-        bufferChars(1);
-    }
+    mLastChar = mPosition;
 
-    /*
-     * Delete the previously last consumed character, if any.
-     */
-    if (mLastChar) {
-        delete[] mLastChar;
-    }
+    int length = charLength(mPosition);
 
-    /*
-     * The character we will return (the first character in the buffer) is
-     * considered the last consumed character after this method; thus, we
-     * adjust mLastChar to point to this character.
-     */
-    mLastChar = mCharBuffer.front();
+    if (length > 0) {
+        mPosition += length;
+        mCurrentColumn++;
+    }
 
-    /*
-     * Remove the consumed character from the buffer and return it.
-     */
-    mCharBuffer.pop_front();
     return mLastChar;
 }
 
@@ -271,56 +460,39 @@ const char* Lexer::lookAhead(unsigned int numChars)
 {
     assert(numChars > 0);
 
-    bufferChars(numChars);
-    return mCharBuffer[numChars - 1];
-}
+    const char* c = mPosition;
 
-void Lexer::bufferChars(int numChars)
-{
-    for (int i = mCharBuffer.size(); i < numChars; i++) {
-        /*
-         * First, we peek the next byte. If it is a valid ASCII character
-         * (that is, the most significant bit is 0), this byte is our next
-         * character. Otherwise, the number of 1's in the first byte tell us
-         * how long the UTF-8 character is.
-         *
-         * See http://en.wikipedia.org/wiki/UTF-8
-         */
-
-        unsigned char firstByte = (unsigned char)mStream->peek();
-
-        if (mStream->eof()) {
-            mCharBuffer.push_front("");
-            continue;
-        }
-
-        char* c;
-
-        if (firstByte >> 7 == 0) {
-            mStream->get();
-
-            c = new char[2];
-            c[0] = firstByte;
-            c[1] = '\0';
-        } else {
-            int charLength = 2;
+    for (unsigned int i = 1; i < numChars; i++) {
+        c += charLength(c);
+    }
 
-            for (int i = 2; i < 4; i++) {
-                if (firstByte & (0x80 >> i)) {
-                    charLength++;
-                } else {
-                    break;
-                }
-            }
+    return c;
+}
 
-            c = new char[charLength + 1];
+void Lexer::skipBlanks()
+{
+    int numLineFeeds = 0;
+    const char* lastLineFeed = nullptr;
+    const char* p = findNonBlank(mPosition, mEnd, numLineFeeds, lastLineFeed);
 
-            mStream->read(c, charLength);
-            c[charLength] = '\0';
-        }
+    if (p == mPosition) {
+        return;
+    }
 
-        mCharBuffer.push_back(c);
+    /*
+     * All skipped characters are one byte long, so the column of the
+     * character we stop at is its byte distance from the last line feed
+     * (or from the previous position if no line feed was skipped).
+     */
+    if (numLineFeeds > 0) {
+        mCurrentLine += numLineFeeds;
+        mCurrentColumn = 1 + (p - (lastLineFeed + 1));
+    } else {
+        mCurrentColumn += p - mPosition;
     }
+
+    mLastChar = p - 1;
+    mPosition = p;
 }
 
 void Lexer::skipLineTerminator()
@@ -357,7 +529,7 @@ void Lexer::skipDelimitedComment()
     while (true) {
         const char* lookahead = lookAhead();
 
-        if (std::regex_match(lookahead, sLineTerminator)) {
+        if (isLineTerminator(lookahead)) {
             skipLineTerminator();
         } else if (lookahead[0] == '*' && lookAhead(2)[0] == '/') {
             nextChar();
@@ -384,59 +556,346 @@ void Lexer::skipSingleLineComment()
      * Skip all characters until we encounter a line terminator
      * or end-of-file.
      */
-    while (!std::regex_match(lookAhead(), sLineTerminator)
-        && lookAhead()[0] != '\0') {
+    while (!isLineTerminator(lookAhead()) && lookAhead()[0] != '\0') {
         nextChar();
     }
 }
 
 int Lexer::readIdentifierOrKeyword(SoyaParser::semantic_type* yylval)
 {
-    std::string* identifier = new std::string;
+    const char* start = mPosition;
 
-    while (std::regex_match(lookAhead(), sIdentifierChar)) {
-        *identifier += nextChar();
+    while (isIdentifierChar(lookAhead())) {
+        nextChar();
     }
 
+    std::size_t length = mPosition - start;
+
     /*
-     * If the read string is an integer type keyword, determine the
+     * If the read string is an integer type keyword ("int", "uint" or
+     * "int"/"uint" followed by a bit size, like "int16"), determine the
      * matching IntegerType instance and return it as semantic value.
      */
-    if (std::regex_match(*identifier, sIntegerType)) {
+    bool isSigned = (start[0] != 'u');
+    std::size_t prefixLength = isSigned ? 3 : 4;
 
-        if (*identifier == "int") {
-            yylval->type = TYPE_INT;
-        } else if (*identifier == "uint") {
-            yylval->type = TYPE_UINT;
-        } else {
-            bool isSigned = ((*identifier)[0] != 'u');
-            int size = atoi(identifier->c_str() + (isSigned ? 3 : 4));
+    if (length >= prefixLength
+        && std::memcmp(start, isSigned ? "int" : "uint", prefixLength) == 0
+        && std::all_of(start + prefixLength, mPosition,
+            [](char c) { return c >= '0' && c <= '9'; })) {
 
+        if (length == prefixLength) {
+            yylval->type = isSigned ? TYPE_INT : TYPE_UINT;
+        } else {
+            int size = std::atoi(start + prefixLength);
             yylval->type = soyac::ast::IntegerType::get(size, isSigned);
         }
 
-        delete identifier;
         return SoyaParser::token::INT_TYPE;
     }
 
     /*
-     * Otherwise, look up in the keyword map if the identifier-like string
-     * we read is a keyword, and return the arppropiate token ID in this
-     * case. Otherwise, it is *really* an identifier, and we store it as
-     * semantic value in yylval.
+     * Otherwise, check whether the identifier-like string we read is a
+     * keyword, and return the appropriate token ID in this case. Otherwise,
+     * it is *really* an identifier, and we store it (interned) as semantic
+     * value in yylval.
      */
+    int token = keywordToken(start, length);
 
-    std::map<std::string, int>::iterator it = sKeywords.find(*identifier);
-
-    if (it != sKeywords.end()) {
-        delete identifier;
-        return it->second;
+    if (token != -1) {
+        return token;
     } else {
-        yylval->identifier = identifier;
+        yylval->identifier = Identifier(std::string_view(start, length));
         return SoyaParser::token::IDENTIFIER;
     }
 }
 
+int Lexer::keywordToken(const char* identifier, std::size_t length)
+{
+    /*
+     * Dispatch on the identifier's length and first character, which
+     * leaves at most three keywords to compare against.
+     */
+    switch (length) {
+    case 2:
+        switch (identifier[0]) {
+        case 'a':
+            if (std::memcmp(identifier + 1, "s", 1) == 0) {
+                return SoyaParser::token::AS;
+            }
+            break;
+        case 'd':
+            if (std::memcmp(identifier + 1, "o", 1) == 0) {
+                return SoyaParser::token::DO;
+            }
+            break;
+        case 'i':
+            if (std::memcmp(identifier + 1, "f", 1) == 0) {
+                return SoyaParser::token::IF;
+            }
+            if (std::memcmp(identifier + 1, "s", 1) == 0) {
+                return SoyaParser::token::IS;
+            }
+            break;
+        }
+        break;
+    case 3:
+        switch (identifier[0]) {
+        case 'f':
+            if (std::memcmp(identifier + 1, "or", 2) == 0) {
+                return SoyaParser::token::FOR;
+            }
+            break;
+        case 'g':
+            if (std::memcmp(identifier + 1, "et", 2) == 0) {
+                return SoyaParser::token::GET;
+            }
+            break;
+        case 'n':
+            if (std::memcmp(identifier + 1, "ew", 2) == 0) {
+                return SoyaParser::token::NEW;
+            }
+            break;
+        case 's':
+            if (std::memcmp(identifier + 1, "et", 2) == 0) {
+                return SoyaParser::token::SET;
+            }
+            break;
+        case 'v':
+            if (std::memcmp(identifier + 1, "ar", 2) == 0) {
+                return SoyaParser::token::VAR;
+            }
+            break;
+        case 'x':
+            if (std::memcmp(identifier + 1, "or", 2) == 0) {
+                return SoyaParser::token::XOR;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (identifier[0]) {
+        case 'b':
+            if (std::memcmp(identifier + 1, "ool", 3) == 0) {
+                return SoyaParser::token::BOOL;
+            }
+            break;
+        case 'c':
+            if (std::memcmp(identifier + 1, "ase", 3) == 0) {
+                return SoyaParser::token::CASE;
+            }
+            if (std::memcmp(identifier + 1, "har", 3) == 0) {
+                return SoyaParser::token::CHAR;
+            }
+            break;
+        case 'e':
+            if (std::memcmp(identifier + 1, "lse", 3) == 0) {
+                return SoyaParser::token::ELSE;
+            }
+            if (std::memcmp(identifier + 1, "num", 3) == 0) {
+                return SoyaParser::token::ENUM;
+            }
+            break;
+        case 'f':
+            if (std::memcmp(identifier + 1, "rom", 3) == 0) {
+                return SoyaParser::token::FROM;
+            }
+            break;
+        case 'l':
+            if (std::memcmp(identifier + 1, "ong", 3) == 0) {
+                return SoyaParser::token::LONG;
+            }
+            break;
+        case 't':
+            if (std::memcmp(identifier + 1, "his", 3) == 0) {
+                return SoyaParser::token::THIS;
+            }
+            if (std::memcmp(identifier + 1, "rue", 3) == 0) {
+                return SoyaParser::token::TRUE_;
+            }
+            break;
+        case 'v':
+            if (std::memcmp(identifier + 1, "oid", 3) == 0) {
+                return SoyaParser::token::VOID;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (identifier[0]) {
+        case 'a':
+            if (std::memcmp(identifier + 1, "lias", 4) == 0) {
+                return SoyaParser::token::ALIAS;
+            }
+            break;
+        case 'b':
+            if (std::memcmp(identifier + 1, "reak", 4) == 0) {
+                return SoyaParser::token::BREAK;
+            }
+            break;
+        case 'c':
+            if (std::memcmp(identifier + 1, "lass", 4) == 0) {
+                return SoyaParser::token::CLASS;
+            }
+            if (std::memcmp(identifier + 1, "onst", 4) == 0) {
+                return SoyaParser::token::CONST;
+            }
+            break;
+        case 'f':
+            if (std::memcmp(identifier + 1, "alse", 4) == 0) {
+                return SoyaParser::token::FALSE_;
+            }
+            if (std::memcmp(identifier + 1, "loat", 4) == 0) {
+                return SoyaParser::token::FLOAT;
+            }
+            break;
+        case 's':
+            if (std::memcmp(identifier + 1, "uper", 4) == 0) {
+                return SoyaParser::token::SUPER;
+            }
+            break;
+        case 'u':
+            if (std::memcmp(identifier + 1, "long", 4) == 0) {
+                return SoyaParser::token::ULONG;
+            }
+            break;
+        case 'w':
+            if (std::memcmp(identifier + 1, "hile", 4) == 0) {
+                return SoyaParser::token::WHILE;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (identifier[0]) {
+        case 'd':
+            if (std::memcmp(identifier + 1, "ouble", 5) == 0) {
+                return SoyaParser::token::DOUBLE;
+            }
+            break;
+        case 'e':
+            if (std::memcmp(identifier + 1, "xtern", 5) == 0) {
+                return SoyaParser::token::EXTERN;
+            }
+            break;
+        case 'i':
+            if (std::memcmp(identifier + 1, "mport", 5) == 0) {
+                return SoyaParser::token::IMPORT;
+            }
+            break;
+        case 'm':
+            if (std::memcmp(identifier + 1, "odule", 5) == 0) {
+                return SoyaParser::token::MODULE;
+            }
+            break;
+        case 'p':
+            if (std::memcmp(identifier + 1, "ublic", 5) == 0) {
+                return SoyaParser::token::PUBLIC;
+            }
+            break;
+        case 'r':
+            if (std::memcmp(identifier + 1, "eturn", 5) == 0) {
+                return SoyaParser::token::RETURN;
+            }
+            break;
+        case 's':
+            if (std::memcmp(identifier + 1, "tatic", 5) == 0) {
+                return SoyaParser::token::STATIC;
+            }
+            if (std::memcmp(identifier + 1, "truct", 5) == 0) {
+                return SoyaParser::token::STRUCT;
+            }
+            if (std::memcmp(identifier + 1, "witch", 5) == 0) {
+                return SoyaParser::token::SWITCH;
+            }
+            break;
+        }
+        break;
+    case 7:
+        switch (identifier[0]) {
+        case 'd':
+            if (std::memcmp(identifier + 1, "efault", 6) == 0) {
+                return SoyaParser::token::DEFAULT;
+            }
+            break;
+        case 'e':
+            if (std::memcmp(identifier + 1, "xtends", 6) == 0) {
+                return SoyaParser::token::EXTENDS;
+            }
+            break;
+        case 'p':
+            if (std::memcmp(identifier + 1, "rivate", 6) == 0) {
+                return SoyaParser::token::PRIVATE;
+            }
+            break;
+        case 'v':
+            if (std::memcmp(identifier + 1, "irtual", 6) == 0) {
+                return SoyaParser::token::VIRTUAL;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (identifier[0]) {
+        case 'c':
+            if (std::memcmp(identifier + 1, "ontinue", 7) == 0) {
+                return SoyaParser::token::CONTINUE;
+            }
+            break;
+        case 'f':
+            if (std::memcmp(identifier + 1, "unction", 7) == 0) {
+                return SoyaParser::token::FUNCTION;
+            }
+            break;
+        case 'o':
+            if (std::memcmp(identifier + 1, "verride", 7) == 0) {
+                return SoyaParser::token::OVERRIDE;
+            }
+            break;
+        case 'p':
+            if (std::memcmp(identifier + 1, "roperty", 7) == 0) {
+                return SoyaParser::token::PROPERTY;
+            }
+            break;
+        case 'r':
+            if (std::memcmp(identifier + 1, "eadonly", 7) == 0) {
+                return SoyaParser::token::READONLY;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (identifier[0]) {
+        case 'p':
+            if (std::memcmp(identifier + 1, "rotected", 8) == 0) {
+                return SoyaParser::token::PROTECTED;
+            }
+            break;
+        }
+        break;
+    case 10:
+        switch (identifier[0]) {
+        case 'i':
+            if (std::memcmp(identifier + 1, "mplements", 9) == 0) {
+                return SoyaParser::token::IMPLEMENTS;
+            }
+            break;
+        }
+        break;
+    case 11:
+        switch (identifier[0]) {
+        case 'c':
+            if (std::memcmp(identifier + 1, "onstructor", 10) == 0) {
+                return SoyaParser::token::CONSTRUCTOR;
+            }
+            break;
+        }
+        break;
+    }
+
+    return -1;
+}
+
 int Lexer::readIntegerOrFloatingPointLiteral(SoyaParser::semantic_type* yylval)
 {
     bool negative = false;
@@ -512,7 +971,7 @@ int Lexer::readDecimalIntegerLiteral(
         const char* c = lookAhead();
 
         if (isdigit(c[0])) {
-            literal << c;
+            literal << c[0];
             nextChar();
         } else {
             break;
@@ -536,7 +995,7 @@ int Lexer::readBinaryIntegerLiteral(
         const char* c = lookAhead();
 
         if (c[0] == '0' || c[0] == '1') {
-            literal << c;
+            literal << c[0];
             nextChar();
         } else {
             break;
@@ -560,7 +1019,7 @@ int Lexer::readOctalIntegerLiteral(
         const char* c = lookAhead();
 
         if (c[0] >= '0' && c[0] <= '7') {
-            literal << c;
+            literal << c[0];
             nextChar();
         } else {
             break;
@@ -584,7 +1043,7 @@ int Lexer::readHexadecimalIntegerLiteral(
         const char* c = lookAhead();
 
         if (isxdigit(c[0])) {
-            literal << c;
+            literal << c[0];
             nextChar();
         } else {
             break;
@@ -642,7 +1101,7 @@ int Lexer::readFloatingPointLiteral(
             || (c[0] == '.' && (!dotRead ? (dotRead = true) : false))
             || ((c[0] == 'E' || c[0] == 'e')
                 && (!eRead ? (eRead = true) : false))) {
-            literal << c;
+            literal << c[0];
             nextChar();
 
             if ((c[0] == 'E' || c[0] == 'e') && lookAhead()[0] == '-') {
@@ -702,7 +1161,7 @@ int Lexer::readCharacterLiteral(SoyaParser::semantic_type* yylval)
      * http://utfcpp.sourceforge.net/
      */
     std::vector<uint32_t> codepoints;
-    utf8::utf8to16(utf8_char, utf8_char + std::strlen(utf8_char),
+    utf8::utf8to16(utf8_char, utf8_char + charLength(utf8_char),
         std::back_inserter(codepoints));
 
     if (codepoints.size() == 0) {
@@ -781,7 +1240,8 @@ const char* Lexer::readEscapeChar()
 
     default:
         ret[0] = '\0';
-        addError(str(boost::format("Invalid escape sequence '\\%1%'.") % c));
+        addError(str(boost::format("Invalid escape sequence '\\%1%'.")
+            % std::string(c, charLength(c))));
     }
 
     nextChar();
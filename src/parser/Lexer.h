@@ -9,9 +9,8 @@
 #ifndef SOYA_LEXER_H_
 #define SOYA_LEXER_H_
 
-#include <deque>
+#include <cstddef>
 #include <iostream>
-#include <regex>
 #include <sstream>
 #include <string>
 
@@ -34,7 +33,8 @@ namespace parser {
 class Lexer {
 public:
     /**
-     * Creates a Lexer.
+     * Creates a Lexer. The stream's contents are read into a single
+     * contiguous buffer, which the Lexer scans without further copying.
      *
      * @param stream         The stream to read tokens from.
      * @param filename       The read source file's name (used as location
@@ -46,9 +46,21 @@ public:
         PassResultBuilder* resultBuilder);
 
     /**
-     * Lexer destructor.
+     * Creates a Lexer that reads tokens directly from a buffer in memory
+     * (e.g. a SourceFile's contents). The buffer is not copied and must
+     * stay valid for the Lexer's lifetime.
+     *
+     * @param source         The source text. Must be terminated by a null
+     *                       character (that is, @c source[length] must
+     *                       be @c '\0').
+     * @param length         The source text's length in bytes.
+     * @param filename       The read source file's name (used as location
+     *                       information).
+     * @param resultBuilder  A PassResultBuilder to which the Lexer adds
+     *                       found syntax errors.
      */
-    ~Lexer();
+    Lexer(const char* source, std::size_t length, const std::string& fileName,
+        PassResultBuilder* resultBuilder);
 
     /**
      * Returns the name of the read source file.
@@ -73,47 +85,68 @@ private:
     /*
      * NOTE
      * ====
-     * The Lexer class is fully UTF-8 aware. To represent UTF-8 characters,
-     * it uses null-terminated byte strings. Thus, all functions that return
-     * characters are declared with "const char*" as return type. Likewise,
-     * variables that hold characters are also declared as "const char*"
-     * (e.g. mLastChar).
+     * The Lexer class is fully UTF-8 aware. The source text is kept in a
+     * single null-terminated buffer (either mSource or a buffer passed to
+     * the constructor), and a UTF-8 character is
+     * represented by a pointer to its first byte within that buffer; its
+     * length follows from that byte (see charLength()). Thus, all functions
+     * that return characters are declared with "const char*" as return
+     * type, and variables that hold characters are also declared as
+     * "const char*" (e.g. mLastChar). The end of the input is represented
+     * by a pointer to the buffer's terminating null character (mEnd).
      */
 
-    std::istream* mStream;
+    std::string mSource;
     std::string mFileName;
     PassResultBuilder* mResultBuilder;
     int mCurrentLine;
     int mCurrentColumn;
-    std::deque<const char*> mCharBuffer;
+    const char* mPosition;
+    const char* mEnd;
     const char* mLastChar;
 
-    /*
-     * This variable determines whether the static regular expression
-     * objects have already been initialized.
+    /**
+     * Returns the length of a character in bytes, or 0 if the character is
+     * the null character (that is, the end of the input).
+     *
+     * @param c  The character whose length should be returned.
+     * @return   The character's length in bytes.
      */
-    static bool sInitRegexDone;
+    static int charLength(const char* c);
 
-    /*
-     * Regular expressions.
+    /**
+     * Returns whether a character is a line terminator.
+     *
+     * @param c  The character to classify.
+     * @return   @c true if @c c is a line terminator; @c false otherwise.
      */
-    static std::regex sLineTerminator;
-    static std::regex sWhiteSpace;
-    static std::regex sIdentifierStartChar;
-    static std::regex sIdentifierChar;
-    static std::regex sIntegerType;
+    static bool isLineTerminator(const char* c);
 
-    /*
-     * Maps Soya's keywords as strings to the IDs of their respective
-     * tokens.
+    /**
+     * Returns whether a character is a white space character.
+     *
+     * @param c  The character to classify.
+     * @return   @c true if @c c is white space; @c false otherwise.
      */
-    static std::map<std::string, int> sKeywords;
+    static bool isWhiteSpace(const char* c);
 
     /**
-     * Initializes all regular expression objects. Called when the first
-     * Lexer is created.
+     * Returns whether a character may start an identifier.
+     *
+     * @param c  The character to classify.
+     * @return   @c true if @c c may start an identifier; @c false otherwise.
+     */
+    static bool isIdentifierStartChar(const char* c);
+
+    /**
+     * Returns whether a character may appear in an identifier after its
+     * first character.
+     *
+     * @param c  The character to classify.
+     * @return   @c true if @c c may be part of an identifier; @c false
+     *           otherwise.
      */
-    static void initRegex();
+    static bool isIdentifierChar(const char* c);
 
     /**
      * Calls the PassResultBuilder::addError() method of the
@@ -149,8 +182,6 @@ private:
      * the same argument always return the same character as long as
      * nextChar() is not called.
      *
-     * The read characters are buffered using bufferChars().
-     *
      * @param numChars  The number of characters to look ahead from the
      *                  current position in the stream.
      * @return          The requested character, or the null character if
@@ -159,15 +190,10 @@ private:
     const char* lookAhead(unsigned int numChars = 1);
 
     /**
-     * Reads the next @c n UTF-8 characters (relative to the current
-     * position in the input stream) from the input stream and stores them
-     * in the Lexer's character buffer as null-terminated byte strings. If
-     * the end of the input stream is reached, the null character (@c '\0')
-     * is put into the buffer.
-     *
-     * @param n  The number of characters to buffer.
+     * Skips a run of ASCII white space and line feed characters (which are
+     * by far the most common blank characters) in one go.
      */
-    void bufferChars(int n);
+    void skipBlanks();
 
     /**
      * Skips a line terminator.
@@ -192,6 +218,18 @@ private:
      */
     int readIdentifierOrKeyword(SoyaParser::semantic_type* yylval);
 
+    /**
+     * Returns the ID of the keyword token matching the passed
+     * identifier-like string, or -1 if the string is not a keyword.
+     * (Integer type keywords like "int16" are handled separately by
+     * readIdentifierOrKeyword().)
+     *
+     * @param identifier  The identifier-like string (not null-terminated).
+     * @param length      The string's length.
+     * @return            The keyword's token ID, or -1.
+     */
+    static int keywordToken(const char* identifier, std::size_t length);
+
     /**
      * Reads an integer or floating-point literal and returns the read
      * token's ID.
@@ -7,6 +7,7 @@
  */
 
 #include "ParserDriver.h"
+#include "SourceFile.h"
 #include <cerrno>
 #include <cstring>
 #include <iostream>
@@ -14,50 +15,167 @@
 namespace soyac {
 namespace parser {
 
+std::atomic<unsigned> ParserDriver::sParseCount(0);
+
+/**
+ * Reads a module name ("foo" or "foo::bar") starting with the passed
+ * token and returns it. Afterwards, @c token is the first token following
+ * the name. If @c token is not an identifier, an empty string is returned.
+ *
+ * @param lexer     The lexer to read tokens from.
+ * @param token     The current token.
+ * @param value     Storage for the tokens' semantic values.
+ * @param location  Storage for the tokens' locations.
+ * @return          The module name, or an empty string.
+ */
+static std::string scan_module_name(Lexer& lexer, int& token,
+    yy::SoyaParser::semantic_type& value,
+    yy::SoyaParser::location_type& location)
+{
+    std::string name;
+
+    while (token == yy::SoyaParser::token::IDENTIFIER) {
+        name.append(value.identifier.str());
+        token = lexer.nextToken(&value, &location);
+
+        if (token != yy::SoyaParser::token::DCOLON) {
+            break;
+        }
+
+        name.append("::");
+        token = lexer.nextToken(&value, &location);
+    }
+
+    return name;
+}
+
 ParserDriver::ParserDriver(const std::string& fileName)
     : mFileName(fileName)
     , mLexer(nullptr)
+    , mArena(nullptr)
+    , mSyntaxTree(nullptr)
 {
 }
 
 soyac::ast::Module* ParserDriver::parse(PassResult*& result)
 {
-    std::ifstream stream;
-    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
-    stream.open(mFileName.c_str(), std::ios_base::binary);
+    /*
+     * The whole file is made available (memory-mapped, if possible) before
+     * parsing starts, so that the Lexer never needs to do any I/O.
+     */
+    SourceFile source(mFileName);
 
+    sParseCount++;
     mResultBuilder = new PassResultBuilder;
-    mLexer = new Lexer(&stream, mFileName, mResultBuilder);
+    mArena = new soyac::ast::NodeArena;
+    mLexer = new Lexer(
+        source.data(), source.size(), mFileName, mResultBuilder);
 
     yy::SoyaParser parser(this);
 
     /*
      * A return value of 1 indicates failure.
      */
-    try {
-        if (parser.parse() == 1) {
-            mSyntaxTree = nullptr;
-        }
-    } catch (const std::ifstream::failure& exc) {
-        delete mLexer;
-        mLexer = nullptr;
-        delete mResultBuilder;
-
-        throw exc;
+    if (parser.parse() == 1) {
+        mSyntaxTree = nullptr;
     }
 
     delete mLexer;
     mLexer = nullptr;
 
+    /*
+     * The parsed nodes now belong to the resulting module. If parsing
+     * failed, the partially built tree is abandoned; its arena is not
+     * released, as some of its nodes may already be referenced from
+     * elsewhere (e.g. as element types of ArrayType instances).
+     */
+    if (mSyntaxTree != nullptr) {
+        mSyntaxTree->adoptArena(mArena);
+    }
+
+    mArena = nullptr;
+
     result = mResultBuilder->result();
     delete mResultBuilder;
 
     return mSyntaxTree;
 }
 
+ModuleHeader ParserDriver::scanHeader()
+{
+    typedef yy::SoyaParser::token token_type;
+
+    SourceFile source(mFileName);
+    PassResultBuilder resultBuilder;
+    Lexer lexer(source.data(), source.size(), mFileName, &resultBuilder);
+    yy::SoyaParser::semantic_type value;
+    yy::SoyaParser::location_type location;
+    ModuleHeader header;
+
+    int token = lexer.nextToken(&value, &location);
+
+    /*
+     * module_declaration_opt: "module" module_name ";"
+     */
+    if (token == token_type::MODULE) {
+        token = lexer.nextToken(&value, &location);
+        header.moduleName = scan_module_name(lexer, token, value, location);
+
+        if (token != token_type::SCOLON) {
+            return header;
+        }
+
+        token = lexer.nextToken(&value, &location);
+    }
+
+    /*
+     * import_statement: static_opt "import" name ";", where the name
+     * consists of the module name, optionally followed by "." and the
+     * imported entity's name.
+     */
+    for (;;) {
+        if (token == token_type::STATIC) {
+            token = lexer.nextToken(&value, &location);
+        }
+
+        if (token != token_type::IMPORT) {
+            break;
+        }
+
+        token = lexer.nextToken(&value, &location);
+        std::string moduleName
+            = scan_module_name(lexer, token, value, location);
+
+        if (moduleName.empty()) {
+            break;
+        }
+
+        header.importedModules.insert(moduleName);
+
+        while (token == token_type::DOT) {
+            token = lexer.nextToken(&value, &location);
+
+            if (token == token_type::IDENTIFIER) {
+                token = lexer.nextToken(&value, &location);
+            }
+        }
+
+        if (token != token_type::SCOLON) {
+            break;
+        }
+
+        token = lexer.nextToken(&value, &location);
+    }
+
+    return header;
+}
+
+unsigned ParserDriver::parseCount() { return sParseCount; }
+
 Lexer* ParserDriver::lexer() const { return mLexer; }
 
+soyac::ast::NodeArena* ParserDriver::arena() const { return mArena; }
+
 PassResultBuilder* ParserDriver::resultBuilder() const
 {
     return mResultBuilder;
@@ -12,8 +12,11 @@
 #include "Lexer.h"
 #include "parser.hpp"
 #include <ast/Module.h>
+#include <atomic>
 #include <common/PassResultBuilder.h>
 #include <fstream>
+#include <set>
+#include <string>
 
 namespace soyac {
 namespace parser {
@@ -24,6 +27,26 @@ namespace parser {
  */
 class ParserDriver;
 
+/**
+ * The module and import declarations at the beginning of a source file,
+ * as read by ParserDriver::scanHeader().
+ */
+struct ModuleHeader {
+    /**
+     * The name of the declared module, or an empty string if the file
+     * does not declare a module (that is, if it is part of the program
+     * module).
+     */
+    std::string moduleName;
+
+    /**
+     * The names of the modules imported by the file. For entity imports
+     * (such as "import foo::bar.func;"), this is the name of the module
+     * the entity is imported from.
+     */
+    std::set<std::string> importedModules;
+};
+
 /**
  * Encapsulates the process of parsing a Soya source file.
  */
@@ -55,6 +78,30 @@ public:
      */
     soyac::ast::Module* parse(PassResult*& result);
 
+    /**
+     * Reads only the module and import declarations at the beginning of
+     * the source file, without building an abstract syntax tree. This is
+     * much cheaper than parse() and allows all modules a program consists
+     * of to be found before any of them is parsed. Syntax errors are
+     * ignored; scanning simply stops at the first token which does not
+     * belong to a module or import declaration, and parse() reports the
+     * errors later.
+     *
+     * @throw std::ifstream::failure  If an I/O error occurs.
+     *
+     * @return  The source file's module and import declarations.
+     */
+    ModuleHeader scanHeader();
+
+    /**
+     * Returns the number of times parse() has been called by any
+     * ParserDriver, which allows to verify that no source file is parsed
+     * more than once.
+     *
+     * @return  The number of parse() calls.
+     */
+    static unsigned parseCount();
+
     /**
      * Returns the lexical analyzer.
      *
@@ -62,9 +109,22 @@ public:
      */
     Lexer* lexer() const;
 
+    /**
+     * Returns the NodeArena in which the parser allocates the nodes and
+     * temporary data of the module being parsed. When parsing succeeds, the
+     * arena is handed over to the resulting Module (see
+     * Module::adoptArena()).
+     *
+     * @return  The current parse's arena.
+     */
+    soyac::ast::NodeArena* arena() const;
+
 private:
+    static std::atomic<unsigned> sParseCount;
+
     std::string mFileName;
     Lexer* mLexer;
+    soyac::ast::NodeArena* mArena;
     PassResultBuilder* mResultBuilder;
     soyac::ast::Module* mSyntaxTree;
 
@@ -0,0 +1,129 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#include <cerrno>
+#include <fcntl.h>
+#include <fstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "SourceFile.h"
+
+namespace soyac {
+namespace parser {
+
+SourceFile::SourceFile(const std::string& fileName)
+    : mMapping(nullptr)
+    , mSize(0)
+{
+    int fd = open(fileName.c_str(), O_RDONLY);
+
+    if (fd == -1) {
+        throw std::ifstream::failure("cannot open " + fileName);
+    }
+
+    struct stat info;
+
+    if (fstat(fd, &info) == -1) {
+        int error = errno;
+        close(fd);
+        errno = error;
+        throw std::ifstream::failure("cannot stat " + fileName);
+    }
+
+    /*
+     * The bytes between the end of a regular file and the end of the last
+     * mapped page are zero-filled, which gives us the terminating null
+     * character for free - unless the file ends exactly at a page boundary.
+     */
+    std::size_t pageSize = sysconf(_SC_PAGESIZE);
+
+    if (S_ISREG(info.st_mode) && info.st_size > 0
+        && info.st_size % pageSize != 0) {
+        void* mapping
+            = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping != MAP_FAILED) {
+            madvise(mapping, info.st_size, MADV_SEQUENTIAL);
+            mMapping = mapping;
+            mSize = info.st_size;
+        }
+    }
+
+    if (mMapping == nullptr) {
+        try {
+            readContents(fd, S_ISREG(info.st_mode) ? info.st_size : 0);
+        } catch (const std::ifstream::failure&) {
+            int error = errno;
+            close(fd);
+            errno = error;
+            throw;
+        }
+    }
+
+    close(fd);
+}
+
+SourceFile::~SourceFile()
+{
+    if (mMapping != nullptr) {
+        munmap(mMapping, mSize);
+    }
+}
+
+const char* SourceFile::data() const
+{
+    if (mMapping != nullptr) {
+        return static_cast<const char*>(mMapping);
+    } else {
+        return mContents.c_str();
+    }
+}
+
+std::size_t SourceFile::size() const { return mSize; }
+
+bool SourceFile::isMapped() const { return mMapping != nullptr; }
+
+void SourceFile::readContents(int fd, std::size_t sizeHint)
+{
+    /*
+     * For regular files, we know the size in advance and can usually read
+     * the whole file with a single read() call (the extra byte lets the
+     * following call detect the end of the file without growing the
+     * buffer). For pipes and the like, we read chunk by chunk until we
+     * reach the end of the input.
+     */
+    mContents.resize(sizeHint > 0 ? sizeHint + 1 : 4096);
+
+    while (true) {
+        if (mSize == mContents.size()) {
+            mContents.resize(mContents.size() * 2);
+        }
+
+        ssize_t numRead
+            = read(fd, &mContents[mSize], mContents.size() - mSize);
+
+        if (numRead == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            throw std::ifstream::failure("read error");
+        } else if (numRead == 0) {
+            break;
+        }
+
+        mSize += numRead;
+    }
+
+    mContents.resize(mSize);
+}
+
+} // namespace parser
+} // namespace soyac
@@ -0,0 +1,89 @@
+/*
+ * soyac - Soya Programming Language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_SOURCE_FILE_H_
+#define SOYA_SOURCE_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace soyac {
+namespace parser {
+
+/**
+ * Provides the contents of a source file as a read-only, null-terminated
+ * byte buffer that can be passed to the Lexer.
+ *
+ * Regular files are memory-mapped if possible; otherwise (e.g. for pipes
+ * or if the file's size is a multiple of the page size, in which case the
+ * mapping would have no room for the terminating null character), the
+ * file is read into memory.
+ */
+class SourceFile {
+public:
+    /**
+     * Opens a source file and makes its contents available.
+     *
+     * If the file cannot be opened or read, a std::ifstream::failure
+     * exception is thrown; errno describes the cause of the failure.
+     *
+     * @throw std::ifstream::failure  If an I/O error occurs.
+     *
+     * @param fileName  The path to the source file.
+     */
+    SourceFile(const std::string& fileName);
+
+    /**
+     * SourceFile destructor.
+     */
+    ~SourceFile();
+
+    SourceFile(const SourceFile&) = delete;
+    SourceFile& operator=(const SourceFile&) = delete;
+
+    /**
+     * Returns the file's contents. The returned buffer is terminated by
+     * a null character (which is not counted by size()).
+     *
+     * @return  The file's contents.
+     */
+    const char* data() const;
+
+    /**
+     * Returns the size of the file's contents in bytes.
+     *
+     * @return  The file's size.
+     */
+    std::size_t size() const;
+
+    /**
+     * Returns whether the file's contents are memory-mapped (as opposed to
+     * being read into memory).
+     *
+     * @return  @c true if the file is memory-mapped, @c false otherwise.
+     */
+    bool isMapped() const;
+
+private:
+    std::string mContents;
+    void* mMapping;
+    std::size_t mSize;
+
+    /**
+     * Reads the whole file referred to by a file descriptor into mContents.
+     *
+     * @param fd        The file descriptor to read from.
+     * @param sizeHint  The expected file size, or 0 if it is unknown.
+     */
+    void readContents(int fd, std::size_t sizeHint);
+};
+
+} // namespace parser
+} // namespace soyac
+
+#endif
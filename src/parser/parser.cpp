@@ -0,0 +1,3078 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton implementation for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
+
+
+
+#include "parser.hpp"
+
+// Second part of user prologue.
+#line 86 "/root/repo/src/parser/soya.yy"
+
+#include <cassert>
+#include <list>
+#include <boost/format.hpp>
+#include <parser/ParserDriver.h>
+
+using namespace soyac::parser;
+
+std::string modifier_to_string(DeclaredEntity::Modifier mod);
+
+template <class T>
+ParserList<T>* new_list(ParserDriver* driver)
+{
+    NodeArena* arena = driver->arena();
+    return arena->create<ParserList<T> >(ArenaAllocator<T>(arena));
+}
+
+void set_location(Node* node,
+                  const yy::SoyaParser::location_type& begin,
+                  const yy::SoyaParser::location_type& end);
+
+#line 67 "/root/repo/src/parser/parser.cpp"
+
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
+#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(msgid) msgid
+# endif
+#endif
+
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
+# endif
+
+
+// Enable debugging if requested.
+#if YYDEBUG
+
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
+
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
+
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
+
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
+
+#else // !YYDEBUG
+
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
+
+#endif // !YYDEBUG
+
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
+
+namespace yy {
+#line 160 "/root/repo/src/parser/parser.cpp"
+
+  /// Build a parser object.
+  SoyaParser::SoyaParser (soyac::parser::ParserDriver* driver_yyarg)
+#if YYDEBUG
+    : yydebug_ (false),
+      yycdebug_ (&std::cerr),
+#else
+    :
+#endif
+      driver (driver_yyarg)
+  {}
+
+  SoyaParser::~SoyaParser ()
+  {}
+
+  SoyaParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+  // basic_symbol.
+  template <typename Base>
+  SoyaParser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value (that.value)
+    , location (that.location)
+  {}
+
+
+  /// Constructor for valueless symbols.
+  template <typename Base>
+  SoyaParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_MOVE_REF (location_type) l)
+    : Base (t)
+    , value ()
+    , location (l)
+  {}
+
+  template <typename Base>
+  SoyaParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (value_type) v, YY_RVREF (location_type) l)
+    : Base (t)
+    , value (YY_MOVE (v))
+    , location (YY_MOVE (l))
+  {}
+
+
+  template <typename Base>
+  SoyaParser::symbol_kind_type
+  SoyaParser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+  template <typename Base>
+  bool
+  SoyaParser::basic_symbol<Base>::empty () const YY_NOEXCEPT
+  {
+    return this->kind () == symbol_kind::S_YYEMPTY;
+  }
+
+  template <typename Base>
+  void
+  SoyaParser::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    value = YY_MOVE (s.value);
+    location = YY_MOVE (s.location);
+  }
+
+  // by_kind.
+  SoyaParser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
+
+#if 201103L <= YY_CPLUSPLUS
+  SoyaParser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
+  SoyaParser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
+
+  SoyaParser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
+
+
+  void
+  SoyaParser::by_kind::clear () YY_NOEXCEPT
+  {
+    kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+  void
+  SoyaParser::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
+
+  SoyaParser::symbol_kind_type
+  SoyaParser::by_kind::kind () const YY_NOEXCEPT
+  {
+    return kind_;
+  }
+
+
+  SoyaParser::symbol_kind_type
+  SoyaParser::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+
+  // by_state.
+  SoyaParser::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
+
+  SoyaParser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
+
+  void
+  SoyaParser::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
+
+  void
+  SoyaParser::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
+
+  SoyaParser::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
+
+  SoyaParser::symbol_kind_type
+  SoyaParser::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
+
+  SoyaParser::stack_symbol_type::stack_symbol_type ()
+  {}
+
+  SoyaParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.value), YY_MOVE (that.location))
+  {
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  SoyaParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.value), YY_MOVE (that.location))
+  {
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  SoyaParser::stack_symbol_type&
+  SoyaParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    value = that.value;
+    location = that.location;
+    return *this;
+  }
+
+  SoyaParser::stack_symbol_type&
+  SoyaParser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    value = that.value;
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
+
+  template <typename Base>
+  void
+  SoyaParser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+
+    // User destructor.
+    YY_USE (yysym.kind ());
+  }
+
+#if YYDEBUG
+  template <typename Base>
+  void
+  SoyaParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
+  }
+#endif
+
+  void
+  SoyaParser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
+
+  void
+  SoyaParser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
+
+  void
+  SoyaParser::yypop_ (int n) YY_NOEXCEPT
+  {
+    yystack_.pop (n);
+  }
+
+#if YYDEBUG
+  std::ostream&
+  SoyaParser::debug_stream () const
+  {
+    return *yycdebug_;
+  }
+
+  void
+  SoyaParser::set_debug_stream (std::ostream& o)
+  {
+    yycdebug_ = &o;
+  }
+
+
+  SoyaParser::debug_level_type
+  SoyaParser::debug_level () const
+  {
+    return yydebug_;
+  }
+
+  void
+  SoyaParser::set_debug_level (debug_level_type l)
+  {
+    yydebug_ = l;
+  }
+#endif // YYDEBUG
+
+  SoyaParser::state_type
+  SoyaParser::yy_lr_goto_state_ (state_type yystate, int yysym)
+  {
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
+    else
+      return yydefgoto_[yysym - YYNTOKENS];
+  }
+
+  bool
+  SoyaParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yypact_ninf_;
+  }
+
+  bool
+  SoyaParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
+
+  int
+  SoyaParser::operator() ()
+  {
+    return parse ();
+  }
+
+  int
+  SoyaParser::parse ()
+  {
+    int yyn;
+    /// Length of the RHS of the rule being reduced.
+    int yylen = 0;
+
+    // Error handling.
+    int yynerrs_ = 0;
+    int yyerrstatus_ = 0;
+
+    /// The lookahead symbol.
+    symbol_type yyla;
+
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
+
+    /// The return value of parse ().
+    int yyresult;
+
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
+
+
+    // User initialization code.
+#line 109 "/root/repo/src/parser/soya.yy"
+{
+  yyla.location.begin.filename = yyla.location.end.filename =
+    const_cast<std::string*>(&driver->lexer()->fileName());
+}
+
+#line 505 "/root/repo/src/parser/parser.cpp"
+
+
+    /* Initialize the stack.  The initial state will be set in
+       yynewstate, since the latter expects the semantical and the
+       location values to have been already stored, initialize these
+       stacks with a primary value.  */
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
+
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
+  yynewstate:
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
+
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
+
+    goto yybackup;
+
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
+      goto yydefault;
+
+    // Read a lookahead token.
+    if (yyla.empty ())
+      {
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            yyla.kind_ = yytranslate_ (yylex (&yyla.value, &yyla.location, driver));
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
+      }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
+
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
+
+    // Reduce or error.
+    yyn = yytable_[yyn];
+    if (yyn <= 0)
+      {
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        yyn = -yyn;
+        goto yyreduce;
+      }
+
+    // Count tokens shifted since error; after three, turn off error status.
+    if (yyerrstatus_)
+      --yyerrstatus_;
+
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
+    goto yynewstate;
+
+
+  /*-----------------------------------------------------------.
+  | yydefault -- do the default action for the current state.  |
+  `-----------------------------------------------------------*/
+  yydefault:
+    yyn = yydefact_[+yystack_[0].state];
+    if (yyn == 0)
+      goto yyerrlab;
+    goto yyreduce;
+
+
+  /*-----------------------------.
+  | yyreduce -- do a reduction.  |
+  `-----------------------------*/
+  yyreduce:
+    yylen = yyr2_[yyn];
+    {
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* If YYLEN is nonzero, implement the default value of the
+         action: '$$ = $1'.  Otherwise, use the top of the stack.
+
+         Otherwise, the following line sets YYLHS.VALUE to garbage.
+         This behavior is undocumented and Bison users should not rely
+         upon it.  */
+      if (yylen)
+        yylhs.value = yystack_[yylen - 1].value;
+      else
+        yylhs.value = yystack_[0].value;
+
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // name: simple_name
+#line 414 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = (yystack_[0].value.name);
+    }
+#line 645 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 3: // name: package_module_name
+#line 418 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = new Name(*(yystack_[0].value.modulename));
+        delete (yystack_[0].value.modulename);
+    }
+#line 654 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 4: // name: qualified_name
+#line 423 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = (yystack_[0].value.name);
+    }
+#line 662 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 5: // simple_name: IDENTIFIER
+#line 430 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = new Name((yystack_[0].value.identifier));
+        yylhs.location = yystack_[0].location;
+    }
+#line 671 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 6: // qualified_name: qualified_name_identifiers
+#line 438 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = new Name((yystack_[0].value.identifierlist)->begin(), (yystack_[0].value.identifierlist)->end());
+    }
+#line 679 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 7: // qualified_name_identifiers: module_name "." IDENTIFIER
+#line 445 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.identifierlist) = new_list<Identifier>(driver);
+        (yylhs.value.identifierlist)->push_back((yystack_[2].value.name)->first());
+        (yylhs.value.identifierlist)->push_back((yystack_[0].value.identifier));
+        delete (yystack_[2].value.name);
+    }
+#line 690 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 8: // qualified_name_identifiers: qualified_name_identifiers "." IDENTIFIER
+#line 452 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[2].value.identifierlist)->push_back((yystack_[0].value.identifier));
+        (yylhs.value.identifierlist) = (yystack_[2].value.identifierlist);
+    }
+#line 699 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 9: // module_name: simple_name
+#line 460 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = (yystack_[0].value.name);
+    }
+#line 707 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 10: // module_name: package_module_name
+#line 464 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.name) = new Name(*(yystack_[0].value.modulename));
+        delete (yystack_[0].value.modulename);
+    }
+#line 716 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 11: // package_module_name: IDENTIFIER "::" IDENTIFIER
+#line 472 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.modulename) = new std::string((yystack_[2].value.identifier).str());
+        (yylhs.value.modulename)->append("::").append((yystack_[0].value.identifier).str());
+    }
+#line 725 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 12: // package_module_name: package_module_name "::" IDENTIFIER
+#line 477 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[2].value.modulename)->append("::").append((yystack_[0].value.identifier).str());
+        (yylhs.value.modulename) = (yystack_[2].value.modulename);
+    }
+#line 734 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 13: // type: simple_type
+#line 486 "/root/repo/src/parser/soya.yy"
+                     { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 740 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 14: // type: array_type
+#line 487 "/root/repo/src/parser/soya.yy"
+                     { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 746 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 15: // type: function_type
+#line 488 "/root/repo/src/parser/soya.yy"
+                     { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 752 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 16: // type: "(" type ")"
+#line 489 "/root/repo/src/parser/soya.yy"
+                     { (yylhs.value.type) = (yystack_[1].value.type); }
+#line 758 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 17: // type: name
+#line 491 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.type) = new (driver->arena()) UnknownType(*(yystack_[0].value.name));
+        set_location((yylhs.value.type), yystack_[0].location, yystack_[0].location);
+        delete (yystack_[0].value.name);
+    }
+#line 768 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 18: // array_type: type "[" "]"
+#line 500 "/root/repo/src/parser/soya.yy"
+    {
+        if (dynamic_cast<UnknownType*>((yystack_[2].value.type)) != nullptr)
+            (yylhs.value.type) = new (driver->arena()) UnknownArrayType((UnknownType*) (yystack_[2].value.type));
+        else
+            (yylhs.value.type) = ArrayType::get((yystack_[2].value.type));
+
+        set_location((yylhs.value.type), yystack_[2].location, yystack_[0].location);
+    }
+#line 781 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 19: // function_type: "function" "(" parameter_types_opt ")" function_type_return_type_opt
+#line 512 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.type) = new (driver->arena()) UnknownFunctionType((yystack_[0].value.type), (yystack_[2].value.typelist)->begin(), (yystack_[2].value.typelist)->end());
+        set_location((yylhs.value.type), yystack_[4].location, yystack_[0].location);
+    }
+#line 790 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 20: // parameter_types_opt: %empty
+#line 519 "/root/repo/src/parser/soya.yy"
+                       { (yylhs.value.typelist) = new_list<Type*>(driver); }
+#line 796 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 21: // parameter_types_opt: parameter_types
+#line 520 "/root/repo/src/parser/soya.yy"
+                       { (yylhs.value.typelist) = (yystack_[0].value.typelist); }
+#line 802 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 22: // parameter_types: type
+#line 525 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.typelist) = new_list<Type*>(driver);
+        (yylhs.value.typelist)->push_back((yystack_[0].value.type));
+    }
+#line 811 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 23: // parameter_types: parameter_types "," type
+#line 530 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[2].value.typelist)->push_back((yystack_[0].value.type));
+        (yylhs.value.typelist) = (yystack_[2].value.typelist);
+    }
+#line 820 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 24: // function_type_return_type_opt: %empty
+#line 537 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.type) = nullptr; }
+#line 826 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 25: // function_type_return_type_opt: "=>" type
+#line 538 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 832 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 26: // simple_type: INT_TYPE
+#line 542 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 838 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 27: // simple_type: "bool"
+#line 543 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_BOOL; }
+#line 844 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 28: // simple_type: "char"
+#line 544 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_CHAR; }
+#line 850 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 29: // simple_type: "double"
+#line 545 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_DOUBLE; }
+#line 856 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 30: // simple_type: "float"
+#line 546 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_FLOAT; }
+#line 862 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 31: // simple_type: "long"
+#line 547 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_LONG; }
+#line 868 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 32: // simple_type: "ulong"
+#line 548 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_ULONG; }
+#line 874 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 33: // simple_type: "void"
+#line 549 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_VOID; }
+#line 880 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 34: // module: module_declaration_opt import_statements_opt statements_opt
+#line 556 "/root/repo/src/parser/soya.yy"
+    {
+        Module* m;
+
+        if ((yystack_[2].value.name) != nullptr)
+        {
+            m = Module::get(*(yystack_[2].value.name));
+
+            /*
+             * If the Module to parse already exists, set the returned Module
+             * to that module.
+             */
+            if (m != nullptr)
+            {
+                driver->setSyntaxTree(m);
+                m = nullptr;
+            }
+            else
+                m = Module::get(*(yystack_[2].value.name), true);
+
+            delete (yystack_[2].value.name);
+        }
+        else
+        {
+            m = Module::getProgram();
+
+            if (m != nullptr)
+            {
+                driver->setSyntaxTree(m);
+                m = nullptr;
+            }
+            else
+                m = Module::getProgram(true);
+        }
+
+        if (m != nullptr)
+        {
+            if ((yystack_[1].value.implist) != nullptr)
+            {
+                for (ParserList<Import*>::iterator it = (yystack_[1].value.implist)->begin();
+                     it != (yystack_[1].value.implist)->end(); it++)
+                {
+                    m->addImport(*it);
+                }
+
+            }
+
+            if ((yystack_[0].value.stmtlist) != nullptr)
+            {
+                for (ParserList<Statement*>::iterator it = (yystack_[0].value.stmtlist)->begin();
+                     it != (yystack_[0].value.stmtlist)->end(); it++)
+                {
+                    m->body()->addStatement(*it);
+                }
+
+            }
+
+            driver->setSyntaxTree(m);
+        }
+    }
+#line 944 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 35: // module_declaration_opt: %empty
+#line 618 "/root/repo/src/parser/soya.yy"
+                                { (yylhs.value.name) = nullptr; }
+#line 950 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 36: // module_declaration_opt: "module" module_name ";"
+#line 619 "/root/repo/src/parser/soya.yy"
+                                { (yylhs.value.name) = (yystack_[1].value.name); }
+#line 956 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 37: // import_statements_opt: %empty
+#line 625 "/root/repo/src/parser/soya.yy"
+                         { (yylhs.value.implist) = nullptr; }
+#line 962 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 38: // import_statements_opt: import_statements
+#line 626 "/root/repo/src/parser/soya.yy"
+                         { (yylhs.value.implist) = (yystack_[0].value.implist); }
+#line 968 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 39: // import_statements: import_statement
+#line 631 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.implist) = new_list<Import*>(driver);
+        (yylhs.value.implist)->push_back((yystack_[0].value.imp));
+    }
+#line 977 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 40: // import_statements: import_statements import_statement
+#line 636 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[1].value.implist)->push_back((yystack_[0].value.imp));
+        (yylhs.value.implist) = (yystack_[1].value.implist);
+    }
+#line 986 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 41: // import_statement: static_opt "import" name ";"
+#line 644 "/root/repo/src/parser/soya.yy"
+    {
+        if ((yystack_[1].value.name)->isSimple())
+            (yylhs.value.imp) = new (driver->arena()) UnresolvedModuleImport(*(yystack_[1].value.name), (yystack_[3].value.boolVal));
+        else
+            (yylhs.value.imp) = new (driver->arena()) UnresolvedEntityImport(*(yystack_[1].value.name));
+
+        set_location((yylhs.value.imp), yystack_[3].location, yystack_[0].location);
+        delete (yystack_[1].value.name);
+    }
+#line 1000 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 42: // static_opt: %empty
+#line 656 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.boolVal) = true; }
+#line 1006 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 43: // static_opt: "static"
+#line 657 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.boolVal) = false; }
+#line 1012 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 44: // statement: block
+#line 663 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.block); }
+#line 1018 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 45: // statement: declaration_statement
+#line 664 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.dstmt); }
+#line 1024 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 46: // statement: do_statement
+#line 665 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1030 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 47: // statement: expression_statement
+#line 666 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1036 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 48: // statement: for_statement
+#line 667 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1042 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 49: // statement: if_statement
+#line 668 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1048 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 50: // statement: return_statement
+#line 669 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1054 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 51: // statement: while_statement
+#line 670 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1060 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 52: // block: "{" statements_opt "}"
+#line 675 "/root/repo/src/parser/soya.yy"
+    {
+        if ((yystack_[1].value.stmtlist) != nullptr)
+            (yylhs.value.block) = new (driver->arena()) Block((yystack_[1].value.stmtlist)->begin(), (yystack_[1].value.stmtlist)->end());
+        else
+            (yylhs.value.block) = new (driver->arena()) Block;
+
+        set_location((yylhs.value.block), yystack_[2].location, yystack_[0].location);
+    }
+#line 1073 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 53: // statements_opt: statements
+#line 686 "/root/repo/src/parser/soya.yy"
+                  { (yylhs.value.stmtlist) = (yystack_[0].value.stmtlist); }
+#line 1079 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 54: // statements_opt: %empty
+#line 687 "/root/repo/src/parser/soya.yy"
+                  { (yylhs.value.stmtlist) = nullptr; }
+#line 1085 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 55: // statements: statement
+#line 692 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmtlist) = new_list<Statement*>(driver);
+        (yylhs.value.stmtlist)->push_back((yystack_[0].value.stmt));
+    }
+#line 1094 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 56: // statements: statements statement
+#line 697 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[1].value.stmtlist)->push_back((yystack_[0].value.stmt));
+        (yylhs.value.stmtlist) = (yystack_[1].value.stmtlist);
+    }
+#line 1103 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 57: // declaration_statement: modifiers_opt declaration
+#line 705 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.dstmt) = new (driver->arena()) DeclarationStatement((yystack_[0].value.decl));
+        set_location((yylhs.value.dstmt), yystack_[1].location, yystack_[0].location);
+
+        if ((yystack_[1].value.modlist) != nullptr)
+        {
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = (yystack_[1].value.modlist)->begin();
+                 it != (yystack_[1].value.modlist)->end(); it++)
+            {
+                if ((yystack_[0].value.decl)->addModifier(*it) == false)
+                {
+                    driver->resultBuilder()->addError(
+                      (yylhs.value.dstmt),
+                      boost::format(
+                        "'%1%' has more than one \"%2%\" modifier.")
+                         % (yystack_[0].value.decl)
+                         % modifier_to_string(*it));
+                }
+            }
+
+        }
+    }
+#line 1130 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 58: // modifiers_opt: modifiers
+#line 730 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.modlist) = (yystack_[0].value.modlist); }
+#line 1136 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 59: // modifiers_opt: %empty
+#line 731 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.modlist) = nullptr; }
+#line 1142 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 60: // modifiers: modifier
+#line 736 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.modlist) = new_list<DeclaredEntity::Modifier>(driver);
+        (yylhs.value.modlist)->push_back((yystack_[0].value.mod));
+    }
+#line 1151 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 61: // modifiers: modifiers modifier
+#line 741 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[1].value.modlist)->push_back((yystack_[0].value.mod));
+        (yylhs.value.modlist) = (yystack_[1].value.modlist);
+    }
+#line 1160 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 62: // modifier: "extern"
+#line 748 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.mod) = DeclaredEntity::EXTERN; }
+#line 1166 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 63: // modifier: "private"
+#line 749 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.mod) = DeclaredEntity::PRIVATE; }
+#line 1172 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 64: // modifier: "public"
+#line 750 "/root/repo/src/parser/soya.yy"
+                 { (yylhs.value.mod) = DeclaredEntity::PUBLIC; }
+#line 1178 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 65: // do_statement: "do" statement "while" "(" expression ")" ";"
+#line 755 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) DoStatement((yystack_[2].value.expr), (yystack_[5].value.stmt));
+        set_location((yylhs.value.stmt), yystack_[6].location, yystack_[1].location);
+    }
+#line 1187 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 66: // expression_statement: expression ";"
+#line 763 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) ExpressionStatement((yystack_[1].value.expr));
+        set_location((yylhs.value.stmt), yystack_[1].location, yystack_[0].location);
+    }
+#line 1196 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 67: // if_statement: "if" "(" expression ")" statement else_statement_opt
+#line 771 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) IfStatement((yystack_[3].value.expr), (yystack_[1].value.stmt), (yystack_[0].value.stmt));
+        set_location((yylhs.value.stmt), yystack_[5].location, yystack_[0].location);
+    }
+#line 1205 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 68: // else_statement_opt: %empty
+#line 778 "/root/repo/src/parser/soya.yy"
+                        { (yylhs.value.stmt) = nullptr; }
+#line 1211 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 69: // else_statement_opt: "else" statement
+#line 779 "/root/repo/src/parser/soya.yy"
+                        { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1217 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 70: // for_statement: "for" "(" for_initializer_opt for_condition_opt for_iterator_opt ")" statement
+#line 785 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) ForStatement(
+          (yystack_[3].value.expr),
+          (yystack_[4].value.stmtlist)->begin(), (yystack_[4].value.stmtlist)->end(),
+          (yystack_[2].value.stmtlist)->begin(), (yystack_[2].value.stmtlist)->end(),
+          (yystack_[0].value.stmt));
+
+        set_location((yylhs.value.stmt), yystack_[6].location, yystack_[0].location);
+    }
+#line 1231 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 71: // for_initializer_opt: ";"
+#line 797 "/root/repo/src/parser/soya.yy"
+                                           { (yylhs.value.stmtlist) = new_list<Statement*>(driver);}
+#line 1237 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 72: // for_initializer_opt: "var" variable_declaration_list ";"
+#line 798 "/root/repo/src/parser/soya.yy"
+                                           { (yylhs.value.stmtlist) = (yystack_[1].value.stmtlist); }
+#line 1243 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 73: // for_initializer_opt: expression_statement_list ";"
+#line 799 "/root/repo/src/parser/soya.yy"
+                                           { (yylhs.value.stmtlist) = (yystack_[1].value.stmtlist); }
+#line 1249 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 74: // variable_declaration_list: variable_or_constant_declarator
+#line 804 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmtlist) = new_list<Statement*>(driver);
+
+        Statement* stmt = new (driver->arena()) DeclarationStatement((yystack_[0].value.decl));
+        set_location(stmt, yystack_[0].location, yystack_[0].location);
+        (yylhs.value.stmtlist)->push_back(stmt);
+    }
+#line 1261 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 75: // variable_declaration_list: variable_declaration_list "," variable_or_constant_declarator
+#line 812 "/root/repo/src/parser/soya.yy"
+    {
+        Statement* stmt = new (driver->arena()) DeclarationStatement((yystack_[0].value.decl));
+        set_location(stmt, yystack_[1].location, yystack_[1].location);
+        (yylhs.value.stmtlist)->push_back(stmt);
+    }
+#line 1271 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 76: // expression_statement_list: expression
+#line 821 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmtlist) = new_list<Statement*>(driver);
+
+        Statement* stmt = new (driver->arena()) ExpressionStatement((yystack_[0].value.expr));
+        set_location(stmt, yystack_[0].location, yystack_[0].location);
+        (yylhs.value.stmtlist)->push_back(stmt);
+    }
+#line 1283 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 77: // expression_statement_list: expression_statement_list "," expression
+#line 829 "/root/repo/src/parser/soya.yy"
+    {
+        Statement* stmt = new (driver->arena()) ExpressionStatement((yystack_[0].value.expr));
+        set_location(stmt, yystack_[1].location, yystack_[1].location);
+        (yylhs.value.stmtlist)->push_back(stmt);
+    }
+#line 1293 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 78: // for_condition_opt: ";"
+#line 837 "/root/repo/src/parser/soya.yy"
+                      { (yylhs.value.expr) = nullptr; }
+#line 1299 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 79: // for_condition_opt: expression ";"
+#line 838 "/root/repo/src/parser/soya.yy"
+                      { (yylhs.value.expr) = (yystack_[1].value.expr); }
+#line 1305 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 80: // for_iterator_opt: %empty
+#line 842 "/root/repo/src/parser/soya.yy"
+                                 { (yylhs.value.stmtlist) = new_list<Statement*>(driver); }
+#line 1311 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 81: // for_iterator_opt: expression_statement_list
+#line 843 "/root/repo/src/parser/soya.yy"
+                                 { (yylhs.value.stmtlist) = (yystack_[0].value.stmtlist); }
+#line 1317 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 82: // return_statement: "return" return_value_opt ";"
+#line 848 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) ReturnStatement((yystack_[1].value.expr));
+        set_location((yylhs.value.stmt), yystack_[2].location, yystack_[0].location);
+    }
+#line 1326 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 83: // return_value_opt: %empty
+#line 855 "/root/repo/src/parser/soya.yy"
+                  { (yylhs.value.expr) = nullptr; }
+#line 1332 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 84: // return_value_opt: expression
+#line 856 "/root/repo/src/parser/soya.yy"
+                  { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1338 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 85: // while_statement: "while" "(" expression ")" statement
+#line 861 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.stmt) = new (driver->arena()) WhileStatement((yystack_[2].value.expr), (yystack_[0].value.stmt));
+        set_location((yylhs.value.stmt), yystack_[4].location, yystack_[0].location);
+    }
+#line 1347 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 86: // declaration: variable_declaration
+#line 870 "/root/repo/src/parser/soya.yy"
+                            { (yylhs.value.decl) = (yystack_[0].value.decl); }
+#line 1353 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 87: // declaration: function_declaration
+#line 871 "/root/repo/src/parser/soya.yy"
+                            { (yylhs.value.decl) = (yystack_[0].value.decl); }
+#line 1359 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 88: // declaration: struct_declaration
+#line 872 "/root/repo/src/parser/soya.yy"
+                            { (yylhs.value.decl) = (yystack_[0].value.type); }
+#line 1365 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 89: // declaration: class_declaration
+#line 873 "/root/repo/src/parser/soya.yy"
+                           { (yylhs.value.decl) = (yystack_[0].value.decl); }
+#line 1371 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 90: // declaration: enum_declaration
+#line 874 "/root/repo/src/parser/soya.yy"
+                            { (yylhs.value.decl) = (yystack_[0].value.decl); }
+#line 1377 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 91: // variable_declaration: "var" variable_or_constant_declarator ";"
+#line 879 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = (yystack_[1].value.decl);
+        set_location((yylhs.value.decl), yystack_[2].location, yystack_[0].location);
+    }
+#line 1386 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 92: // variable_or_constant_declarator: simple_name variable_type_opt initializer_opt
+#line 887 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) Variable(*(yystack_[2].value.name), (yystack_[1].value.type), (yystack_[0].value.expr));
+        set_location((yylhs.value.decl), yystack_[2].location, yystack_[0].location);
+        delete (yystack_[2].value.name);
+    }
+#line 1396 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 93: // variable_type_opt: ":" type
+#line 895 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 1402 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 94: // variable_type_opt: %empty
+#line 896 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.type) = TYPE_UNKNOWN; }
+#line 1408 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 95: // initializer_opt: "=" expression
+#line 900 "/root/repo/src/parser/soya.yy"
+                      { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1414 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 96: // initializer_opt: %empty
+#line 901 "/root/repo/src/parser/soya.yy"
+                      { (yylhs.value.expr) = nullptr; }
+#line 1420 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 97: // function_declaration: "function" simple_name "(" function_parameters_opt ")" return_type_opt function_body_opt
+#line 907 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) Function(*(yystack_[5].value.name), (yystack_[1].value.type), (yystack_[3].value.paramlist)->begin(), (yystack_[3].value.paramlist)->end(), (yystack_[0].value.block));
+        set_location((yylhs.value.decl), yystack_[6].location, yystack_[0].location);
+
+        delete (yystack_[5].value.name);
+    }
+#line 1431 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 98: // function_parameters_opt: function_parameters
+#line 916 "/root/repo/src/parser/soya.yy"
+                           { (yylhs.value.paramlist) = (yystack_[0].value.paramlist); }
+#line 1437 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 99: // function_parameters_opt: %empty
+#line 917 "/root/repo/src/parser/soya.yy"
+                           { (yylhs.value.paramlist) = new_list<FunctionParameter*>(driver); }
+#line 1443 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 100: // function_parameters: function_parameter
+#line 922 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.paramlist) = new_list<FunctionParameter*>(driver);
+        (yylhs.value.paramlist)->push_back((yystack_[0].value.param));
+    }
+#line 1452 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 101: // function_parameters: function_parameters "," function_parameter
+#line 927 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[2].value.paramlist)->push_back((yystack_[0].value.param));
+        (yylhs.value.paramlist) = (yystack_[2].value.paramlist);
+    }
+#line 1461 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 102: // function_parameter: simple_name ":" type
+#line 935 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.param) = new (driver->arena()) FunctionParameter(*(yystack_[2].value.name), (yystack_[0].value.type));
+        set_location((yylhs.value.param), yystack_[2].location, yystack_[0].location);
+        delete (yystack_[2].value.name);
+    }
+#line 1471 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 103: // return_type_opt: ":" type
+#line 943 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 1477 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 104: // return_type_opt: %empty
+#line 944 "/root/repo/src/parser/soya.yy"
+                { (yylhs.value.type) = TYPE_VOID; }
+#line 1483 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 105: // function_body_opt: block
+#line 948 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.block) = (yystack_[0].value.block); }
+#line 1489 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 106: // function_body_opt: ";"
+#line 949 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.block) = nullptr; }
+#line 1495 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 107: // struct_declaration: "struct" simple_name declaration_block
+#line 954 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.type) = new (driver->arena()) StructType(*(yystack_[1].value.name), (yystack_[0].value.dblock));
+        set_location((yylhs.value.type), yystack_[2].location, yystack_[0].location);
+        delete (yystack_[1].value.name);
+    }
+#line 1505 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 108: // declaration_block: "{" declaration_block_statements_opt "}"
+#line 963 "/root/repo/src/parser/soya.yy"
+    {
+        if ((yystack_[1].value.dstmtlist) != nullptr)
+            (yylhs.value.dblock) = new (driver->arena()) DeclarationBlock((yystack_[1].value.dstmtlist)->begin(), (yystack_[1].value.dstmtlist)->end());
+        else
+            (yylhs.value.dblock) = new (driver->arena()) DeclarationBlock;
+
+        set_location((yylhs.value.dblock), yystack_[2].location, yystack_[0].location);
+    }
+#line 1518 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 109: // declaration_block_statements_opt: declaration_block_statements
+#line 974 "/root/repo/src/parser/soya.yy"
+                                    { (yylhs.value.dstmtlist) = (yystack_[0].value.dstmtlist); }
+#line 1524 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 110: // declaration_block_statements_opt: %empty
+#line 975 "/root/repo/src/parser/soya.yy"
+                                    { (yylhs.value.dstmtlist) = nullptr; }
+#line 1530 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 111: // declaration_block_statements: declaration_block_statement
+#line 980 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.dstmtlist) = new_list<DeclarationStatement*>(driver);
+        (yylhs.value.dstmtlist)->push_back((yystack_[0].value.dstmt));
+    }
+#line 1539 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 112: // declaration_block_statements: declaration_block_statements declaration_block_statement
+#line 985 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[1].value.dstmtlist)->push_back((yystack_[0].value.dstmt));
+        (yylhs.value.dstmtlist) = (yystack_[1].value.dstmtlist);
+    }
+#line 1548 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 113: // declaration_block_statement: declaration_statement
+#line 992 "/root/repo/src/parser/soya.yy"
+                             { (yylhs.value.dstmt) = (yystack_[0].value.dstmt); }
+#line 1554 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 114: // declaration_block_statement: modifiers_opt constructor_declaration
+#line 1000 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.dstmt) = new (driver->arena()) DeclarationStatement((yystack_[0].value.decl));
+        set_location((yylhs.value.dstmt), yystack_[1].location, yystack_[0].location);
+
+        if ((yystack_[1].value.modlist) != nullptr)
+        {
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = (yystack_[1].value.modlist)->begin();
+                it != (yystack_[1].value.modlist)->end();
+                it++)
+            {
+                (yystack_[0].value.decl)->addModifier(*it);
+            }
+
+        }
+    }
+#line 1574 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 115: // declaration_block_statement: modifiers_opt property_declaration
+#line 1019 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.dstmt) = new (driver->arena()) DeclarationStatement((yystack_[0].value.decl));
+        set_location((yylhs.value.dstmt), yystack_[1].location, yystack_[0].location);
+
+        if ((yystack_[1].value.modlist) != nullptr)
+        {
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = (yystack_[1].value.modlist)->begin();
+                it != (yystack_[1].value.modlist)->end();
+                it++)
+            {
+                (yystack_[0].value.decl)->addModifier(*it);
+            }
+
+        }
+    }
+#line 1594 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 116: // constructor_declaration: "constructor" "(" function_parameters_opt ")" constructor_initializer_opt constructor_body_opt
+#line 1039 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) Constructor((yystack_[1].value.cinit), (yystack_[3].value.paramlist)->begin(), (yystack_[3].value.paramlist)->end(), (yystack_[0].value.block));
+    }
+#line 1602 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 117: // constructor_initializer_opt: %empty
+#line 1046 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.cinit) = new (driver->arena()) UnresolvedDefaultConstructorInitializer;
+    }
+#line 1610 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 118: // constructor_initializer_opt: ":" "this" "(" function_arguments_opt ")"
+#line 1050 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.cinit) = new (driver->arena()) UnresolvedConstructorInitializer(
+          (yystack_[1].value.exprlist)->begin(), (yystack_[1].value.exprlist)->end());
+        set_location((yylhs.value.cinit), yystack_[4].location, yystack_[0].location);
+    }
+#line 1620 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 119: // constructor_initializer_opt: ":" "super" "(" function_arguments_opt ")"
+#line 1056 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.cinit) = new (driver->arena()) UnresolvedBaseConstructorInitializer(
+          (yystack_[1].value.exprlist)->begin(), (yystack_[1].value.exprlist)->end());
+        set_location((yylhs.value.cinit), yystack_[4].location, yystack_[0].location);
+    }
+#line 1630 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 120: // constructor_body_opt: ";"
+#line 1064 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.block) = new (driver->arena()) Block; }
+#line 1636 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 121: // constructor_body_opt: block
+#line 1065 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.block) = (yystack_[0].value.block); }
+#line 1642 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 122: // property_declaration: "property" name ":" type "{" property_accessors "}"
+#line 1070 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) Property(*(yystack_[5].value.name), (yystack_[3].value.type),
+                          (PropertyGetAccessor*) (yystack_[1].value.accs)[0],
+                          (PropertySetAccessor*) (yystack_[1].value.accs)[1]);
+        set_location((yylhs.value.decl), yystack_[6].location, yystack_[0].location);
+        delete (yystack_[5].value.name);
+        delete[] (yystack_[1].value.accs);
+    }
+#line 1655 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 123: // property_accessors: get_accessor set_accessor_opt
+#line 1082 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.accs) = new Function*[2];
+        (yylhs.value.accs)[0] = (yystack_[1].value.acc);
+        (yylhs.value.accs)[1] = (yystack_[0].value.acc);
+    }
+#line 1665 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 124: // property_accessors: set_accessor get_accessor_opt
+#line 1088 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.accs) = new Function*[2];
+        (yylhs.value.accs)[0] = (yystack_[0].value.acc);
+        (yylhs.value.accs)[1] = (yystack_[1].value.acc);
+    }
+#line 1675 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 125: // get_accessor_opt: %empty
+#line 1096 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.acc) = nullptr; }
+#line 1681 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 126: // get_accessor_opt: get_accessor
+#line 1097 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.acc) = (yystack_[0].value.acc); }
+#line 1687 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 127: // get_accessor: "get" function_body_opt
+#line 1102 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.acc) = new (driver->arena()) PropertyGetAccessor((yystack_[0].value.block));
+        set_location((yylhs.value.acc), yystack_[1].location, yystack_[0].location);
+    }
+#line 1696 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 128: // set_accessor_opt: %empty
+#line 1109 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.acc) = nullptr; }
+#line 1702 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 129: // set_accessor_opt: set_accessor
+#line 1110 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.acc) = (yystack_[0].value.acc); }
+#line 1708 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 130: // set_accessor: "set" function_body_opt
+#line 1115 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.acc) = new (driver->arena()) PropertySetAccessor((yystack_[0].value.block));
+        set_location((yylhs.value.acc), yystack_[1].location, yystack_[0].location);
+    }
+#line 1717 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 131: // class_declaration: "class" simple_name extends_clause_opt declaration_block
+#line 1123 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) ClassType(*(yystack_[2].value.name), (yystack_[1].value.type), (yystack_[0].value.dblock));
+        set_location((yylhs.value.decl), yystack_[3].location, yystack_[1].location);
+        delete (yystack_[2].value.name);
+    }
+#line 1727 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 132: // extends_clause_opt: %empty
+#line 1132 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.type) = new (driver->arena()) UnknownType(Name("__core__") + Name("Object"));
+        set_location((yylhs.value.type), yylhs.location, yylhs.location);
+    }
+#line 1736 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 133: // extends_clause_opt: "extends" name
+#line 1137 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.type) = new (driver->arena()) UnknownType(*(yystack_[0].value.name));
+        set_location((yylhs.value.type), yystack_[1].location, yystack_[0].location);
+        delete (yystack_[0].value.name);
+    }
+#line 1746 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 134: // enum_declaration: "enum" simple_name underlying_type_opt "{" enum_constants "}"
+#line 1146 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.decl) = new (driver->arena()) EnumType(
+          *(yystack_[4].value.name), (IntegerType*) (yystack_[3].value.type), (yystack_[1].value.econstlist)->begin(), (yystack_[1].value.econstlist)->end());
+        set_location((yylhs.value.decl), yystack_[5].location, yystack_[0].location);
+        delete (yystack_[4].value.name);
+    }
+#line 1757 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 135: // underlying_type_opt: %empty
+#line 1155 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_INT; }
+#line 1763 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 136: // underlying_type_opt: ":" INT_TYPE
+#line 1156 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = (yystack_[0].value.type); }
+#line 1769 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 137: // underlying_type_opt: ":" "long"
+#line 1157 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_LONG; }
+#line 1775 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 138: // underlying_type_opt: ":" "ulong"
+#line 1158 "/root/repo/src/parser/soya.yy"
+                    { (yylhs.value.type) = TYPE_ULONG; }
+#line 1781 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 139: // enum_constants: simple_name enum_value_opt
+#line 1163 "/root/repo/src/parser/soya.yy"
+    {
+        EnumConstant* c;
+
+        if ((yystack_[0].value.intLiteral) != nullptr)
+        {
+            c = new (driver->arena()) EnumConstant(*(yystack_[1].value.name), *(yystack_[0].value.intLiteral));
+            delete (yystack_[0].value.intLiteral);
+        }
+        else
+            c = new (driver->arena()) EnumConstant(*(yystack_[1].value.name), IntegerValue(0, false));
+
+        set_location(c, yystack_[1].location, yystack_[0].location);
+        delete (yystack_[1].value.name);
+
+        (yylhs.value.econstlist) = new_list<EnumConstant*>(driver);
+        (yylhs.value.econstlist)->push_back(c);
+    }
+#line 1803 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 140: // enum_constants: enum_constants "," simple_name enum_value_opt
+#line 1181 "/root/repo/src/parser/soya.yy"
+    {
+        EnumConstant* c;
+
+        if ((yystack_[0].value.intLiteral) != nullptr)
+        {
+            c = new (driver->arena()) EnumConstant(*(yystack_[1].value.name), *(yystack_[0].value.intLiteral));
+            delete (yystack_[0].value.intLiteral);
+        }
+        else
+        {
+            const IntegerValue& lastVal = (yystack_[3].value.econstlist)->back()->value();
+            c = new (driver->arena()) EnumConstant(
+              *(yystack_[1].value.name), IntegerValue(lastVal.data() + 1, lastVal.isSigned()));
+        }
+
+        set_location(c, yystack_[3].location, yystack_[0].location);
+        delete (yystack_[1].value.name);
+
+        (yystack_[3].value.econstlist)->push_back(c);
+        (yylhs.value.econstlist) = (yystack_[3].value.econstlist);
+    }
+#line 1829 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 141: // enum_value_opt: %empty
+#line 1205 "/root/repo/src/parser/soya.yy"
+                       { (yylhs.value.intLiteral) = nullptr; }
+#line 1835 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 142: // enum_value_opt: "=" INT_LITERAL
+#line 1206 "/root/repo/src/parser/soya.yy"
+                       { (yylhs.value.intLiteral) = (yystack_[0].value.intLiteral); }
+#line 1841 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 143: // expression: assignment_expression
+#line 1213 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1849 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 144: // assignment_expression: logical_or_expression
+#line 1220 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1857 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 145: // assignment_expression: logical_or_expression "=" assignment_expression
+#line 1224 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) AssignmentExpression((yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1866 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 146: // assignment_expression: logical_or_expression compound_assignment_operator assignment_expression
+#line 1229 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1875 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 147: // compound_assignment_operator: "+="
+#line 1236 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::PLUS_ASSIGN; }
+#line 1881 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 148: // compound_assignment_operator: "-="
+#line 1237 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::MINUS_ASSIGN; }
+#line 1887 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 149: // compound_assignment_operator: "*="
+#line 1238 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::MUL_ASSIGN; }
+#line 1893 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 150: // compound_assignment_operator: "/="
+#line 1239 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::DIV_ASSIGN; }
+#line 1899 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 151: // compound_assignment_operator: "%="
+#line 1240 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::MOD_ASSIGN; }
+#line 1905 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 152: // compound_assignment_operator: "<<="
+#line 1241 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::LSHIFT_ASSIGN; }
+#line 1911 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 153: // compound_assignment_operator: ">>="
+#line 1242 "/root/repo/src/parser/soya.yy"
+             { (yylhs.value.binop) = UnresolvedBinaryExpression::RSHIFT_ASSIGN; }
+#line 1917 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 154: // logical_or_expression: logical_and_expression
+#line 1247 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1925 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 155: // logical_or_expression: logical_or_expression "||" logical_and_expression
+#line 1251 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) LogicalExpression(LogicalExpression::OR, (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1934 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 156: // logical_and_expression: equality_expression
+#line 1259 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1942 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 157: // logical_and_expression: logical_and_expression "&&" equality_expression
+#line 1263 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) LogicalExpression(LogicalExpression::AND, (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1951 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 158: // equality_expression: relational_expression
+#line 1271 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1959 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 159: // equality_expression: relational_expression equality_operator equality_expression
+#line 1275 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1968 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 160: // equality_operator: "=="
+#line 1282 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::EQ; }
+#line 1974 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 161: // equality_operator: "!="
+#line 1283 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::NE; }
+#line 1980 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 162: // relational_expression: cast_expression
+#line 1288 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 1988 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 163: // relational_expression: cast_expression relational_operator bit_shift_expression
+#line 1292 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 1997 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 164: // relational_operator: "<"
+#line 1299 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::LT; }
+#line 2003 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 165: // relational_operator: ">"
+#line 1300 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::GT; }
+#line 2009 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 166: // relational_operator: "<="
+#line 1301 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::LE; }
+#line 2015 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 167: // relational_operator: ">="
+#line 1302 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::GE; }
+#line 2021 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 168: // cast_expression: bit_shift_expression
+#line 1307 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 2029 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 169: // cast_expression: bit_shift_expression "as" type
+#line 1311 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) CastExpression((yystack_[2].value.expr), (yystack_[0].value.type));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 2038 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 170: // bit_shift_expression: additive_expression
+#line 1319 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 2046 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 171: // bit_shift_expression: bit_shift_expression bit_shift_operator additive_expression
+#line 1323 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 2055 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 172: // bit_shift_operator: "<<"
+#line 1330 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::LSHIFT; }
+#line 2061 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 173: // bit_shift_operator: ">>"
+#line 1331 "/root/repo/src/parser/soya.yy"
+            { (yylhs.value.binop) = UnresolvedBinaryExpression::RSHIFT; }
+#line 2067 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 174: // additive_expression: multiplicative_expression
+#line 1336 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 2075 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 175: // additive_expression: additive_expression additive_operator multiplicative_expression
+#line 1340 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 2084 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 176: // additive_operator: "+"
+#line 1347 "/root/repo/src/parser/soya.yy"
+           { (yylhs.value.binop) = UnresolvedBinaryExpression::PLUS; }
+#line 2090 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 177: // additive_operator: "-"
+#line 1348 "/root/repo/src/parser/soya.yy"
+           { (yylhs.value.binop) = UnresolvedBinaryExpression::MINUS; }
+#line 2096 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 178: // multiplicative_expression: unary_expression
+#line 1353 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 2104 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 179: // multiplicative_expression: multiplicative_expression multiplicative_operator unary_expression
+#line 1357 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedBinaryExpression((yystack_[1].value.binop), (yystack_[2].value.expr), (yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+    }
+#line 2113 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 180: // multiplicative_operator: "*"
+#line 1364 "/root/repo/src/parser/soya.yy"
+           { (yylhs.value.binop) = UnresolvedBinaryExpression::MUL; }
+#line 2119 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 181: // multiplicative_operator: "/"
+#line 1365 "/root/repo/src/parser/soya.yy"
+           { (yylhs.value.binop) = UnresolvedBinaryExpression::DIV; }
+#line 2125 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 182: // multiplicative_operator: "%"
+#line 1366 "/root/repo/src/parser/soya.yy"
+           { (yylhs.value.binop) = UnresolvedBinaryExpression::MOD; }
+#line 2131 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 183: // unary_expression: primary_expression
+#line 1371 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[0].value.expr);
+    }
+#line 2139 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 184: // unary_expression: "!" unary_expression
+#line 1375 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) LogicalNotExpression((yystack_[0].value.expr));
+        set_location((yylhs.value.expr), yystack_[1].location, yystack_[0].location);
+    }
+#line 2148 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 185: // primary_expression: simple_name
+#line 1383 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedSimpleNameExpression(*(yystack_[0].value.name));
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+        delete (yystack_[0].value.name);
+    }
+#line 2158 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 186: // primary_expression: "true"
+#line 1389 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) BooleanLiteral(true);
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+    }
+#line 2167 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 187: // primary_expression: "false"
+#line 1394 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) BooleanLiteral(false);
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+    }
+#line 2176 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 188: // primary_expression: "this"
+#line 1399 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedThisExpression;
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+    }
+#line 2185 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 189: // primary_expression: INT_LITERAL
+#line 1404 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) IntegerLiteral(*(yystack_[0].value.intLiteral));
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+        delete (yystack_[0].value.intLiteral);
+    }
+#line 2195 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 190: // primary_expression: FP_LITERAL
+#line 1410 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) FloatingPointLiteral(*(yystack_[0].value.fpLiteral));
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+        delete (yystack_[0].value.fpLiteral);
+    }
+#line 2205 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 191: // primary_expression: CHAR_LITERAL
+#line 1416 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) CharacterLiteral((yystack_[0].value.charLiteral));
+        set_location((yylhs.value.expr), yystack_[0].location, yystack_[0].location);
+    }
+#line 2214 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 192: // primary_expression: primary_expression "." simple_name
+#line 1421 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedMemberAccessExpression((yystack_[2].value.expr), *(yystack_[0].value.name));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+        delete (yystack_[0].value.name);
+    }
+#line 2224 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 193: // primary_expression: package_module_name "." simple_name
+#line 1427 "/root/repo/src/parser/soya.yy"
+    {
+        Name n(*(yystack_[2].value.modulename));
+        delete (yystack_[2].value.modulename);
+
+        Expression* instance = new (driver->arena()) UnresolvedSimpleNameExpression(n);
+
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedMemberAccessExpression(instance, *(yystack_[0].value.name));
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[0].location);
+        delete (yystack_[0].value.name);
+    }
+#line 2239 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 194: // primary_expression: primary_expression "(" function_arguments_opt ")"
+#line 1438 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) CallExpression((yystack_[3].value.expr), (yystack_[1].value.exprlist)->begin(), (yystack_[1].value.exprlist)->end());
+        set_location((yylhs.value.expr), yystack_[3].location, yystack_[0].location);
+    }
+#line 2248 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 195: // primary_expression: primary_expression "[" expression "]"
+#line 1443 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = new (driver->arena()) UnresolvedElementAccessExpression((yystack_[3].value.expr), (yystack_[1].value.expr));
+        set_location((yylhs.value.expr), yystack_[3].location, yystack_[0].location);
+    }
+#line 2257 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 196: // primary_expression: "new" type "(" function_arguments_opt ")"
+#line 1448 "/root/repo/src/parser/soya.yy"
+    {
+        if (dynamic_cast<ArrayType*>((yystack_[3].value.type)) != nullptr ||
+            dynamic_cast<UnknownArrayType*>((yystack_[3].value.type)) != nullptr)
+        {
+            (yylhs.value.expr) = new (driver->arena()) ArrayCreationExpression(
+              (yystack_[3].value.type), nullptr, (yystack_[1].value.exprlist)->begin(), (yystack_[1].value.exprlist)->end());
+        }
+        else
+        {
+            (yylhs.value.expr) = new (driver->arena()) UnresolvedObjectCreationExpression(
+              (UnknownType*) (yystack_[3].value.type), (yystack_[1].value.exprlist)->begin(), (yystack_[1].value.exprlist)->end());
+        }
+
+        set_location((yylhs.value.expr), yystack_[4].location, yystack_[0].location);
+    }
+#line 2277 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 197: // primary_expression: "new" type "[" expression "]" array_elements_opt
+#line 1464 "/root/repo/src/parser/soya.yy"
+    {
+        Type* t;
+
+        if (dynamic_cast<UnknownType*>((yystack_[4].value.type)) != nullptr)
+            t = new (driver->arena()) UnknownArrayType((UnknownType*) (yystack_[4].value.type));
+        else
+            t = ArrayType::get((yystack_[4].value.type));
+
+        (yylhs.value.expr) = new (driver->arena()) ArrayCreationExpression(
+          t, (yystack_[2].value.expr), (yystack_[0].value.exprlist)->begin(), (yystack_[0].value.exprlist)->end());
+        set_location((yylhs.value.expr), yystack_[5].location, yystack_[0].location);
+    }
+#line 2294 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 198: // primary_expression: "(" expression ")"
+#line 1477 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.expr) = (yystack_[1].value.expr);
+        set_location((yylhs.value.expr), yystack_[2].location, yystack_[1].location);
+    }
+#line 2303 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 199: // function_arguments_opt: function_arguments
+#line 1484 "/root/repo/src/parser/soya.yy"
+                          { (yylhs.value.exprlist) = (yystack_[0].value.exprlist); }
+#line 2309 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 200: // function_arguments_opt: %empty
+#line 1485 "/root/repo/src/parser/soya.yy"
+                          { (yylhs.value.exprlist) = new_list<Expression*>(driver); }
+#line 2315 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 201: // function_arguments: expression
+#line 1490 "/root/repo/src/parser/soya.yy"
+    {
+        (yylhs.value.exprlist) = new_list<Expression*>(driver);
+        (yylhs.value.exprlist)->push_back((yystack_[0].value.expr));
+    }
+#line 2324 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 202: // function_arguments: function_arguments "," expression
+#line 1495 "/root/repo/src/parser/soya.yy"
+    {
+        (yystack_[2].value.exprlist)->push_back((yystack_[0].value.expr));
+        (yylhs.value.exprlist) = (yystack_[2].value.exprlist);
+    }
+#line 2333 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 203: // array_elements_opt: %empty
+#line 1502 "/root/repo/src/parser/soya.yy"
+                                  { (yylhs.value.exprlist) = new_list<Expression*>(driver); }
+#line 2339 "/root/repo/src/parser/parser.cpp"
+    break;
+
+  case 204: // array_elements_opt: "(" function_arguments ")"
+#line 1503 "/root/repo/src/parser/soya.yy"
+                                  { (yylhs.value.exprlist) = (yystack_[1].value.exprlist); }
+#line 2345 "/root/repo/src/parser/parser.cpp"
+    break;
+
+
+#line 2349 "/root/repo/src/parser/parser.cpp"
+
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
+
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
+    }
+    goto yynewstate;
+
+
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
+  yyerrlab:
+    // If not already recovering from an error, report this error.
+    if (!yyerrstatus_)
+      {
+        ++yynerrs_;
+        std::string msg = YY_("syntax error");
+        error (yyla.location, YY_MOVE (msg));
+      }
+
+
+    yyerror_range[1].location = yyla.location;
+    if (yyerrstatus_ == 3)
+      {
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
+      }
+
+    // Else will try to reuse lookahead token after shifting the error token.
+    goto yyerrlab1;
+
+
+  /*---------------------------------------------------.
+  | yyerrorlab -- error raised explicitly by YYERROR.  |
+  `---------------------------------------------------*/
+  yyerrorlab:
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
+    if (false)
+      YYERROR;
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYERROR.  */
+    yypop_ (yylen);
+    yylen = 0;
+    YY_STACK_PRINT ();
+    goto yyerrlab1;
+
+
+  /*-------------------------------------------------------------.
+  | yyerrlab1 -- common code for both syntax error and YYERROR.  |
+  `-------------------------------------------------------------*/
+  yyerrlab1:
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
+
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
+
+      // Shift the error token.
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
+    }
+    goto yynewstate;
+
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
+  yyacceptlab:
+    yyresult = 0;
+    goto yyreturn;
+
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
+  yyabortlab:
+    yyresult = 1;
+    goto yyreturn;
+
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
+  yyreturn:
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYABORT or YYACCEPT.  */
+    yypop_ (yylen);
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
+      {
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
+      }
+
+    return yyresult;
+  }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+  SoyaParser::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+#if YYDEBUG || 0
+  const char *
+  SoyaParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytname_[yysymbol];
+  }
+#endif // #if YYDEBUG || 0
+
+
+
+
+
+
+
+
+
+  const short SoyaParser::yypact_ninf_ = -206;
+
+  const signed char SoyaParser::yytable_ninf_ = -111;
+
+  const short
+  SoyaParser::yypact_[] =
+  {
+     -25,    27,    90,     9,    32,  -206,    44,    48,  -206,  -206,
+     329,     9,  -206,    98,   141,  -206,   146,   427,  -206,  -206,
+      94,   106,    11,  -206,  -206,   140,  -206,  -206,   109,  -206,
+    -206,  -206,   140,   379,   140,  -206,    -9,  -206,  -206,  -206,
+     278,  -206,    24,     4,  -206,  -206,  -206,  -206,  -206,  -206,
+    -206,   102,  -206,   408,    72,  -206,    35,    23,     6,    36,
+      62,  -206,    46,  -206,    27,  -206,  -206,   125,    34,   140,
+    -206,  -206,  -206,  -206,   121,  -206,  -206,  -206,    11,  -206,
+    -206,   116,  -206,   117,   119,    41,    88,  -206,  -206,  -206,
+     123,  -206,   140,   126,   131,  -206,   183,  -206,   183,   183,
+     183,   183,   183,  -206,  -206,  -206,  -206,  -206,  -206,  -206,
+    -206,   140,  -206,  -206,  -206,  -206,  -206,  -206,  -206,   140,
+     140,   140,  -206,  -206,   140,  -206,  -206,  -206,  -206,   140,
+      11,  -206,  -206,   140,  -206,  -206,   140,  -206,  -206,  -206,
+     140,   140,   140,   183,   137,   150,   183,  -206,   144,   -12,
+    -206,   155,    11,    97,   214,   215,   140,   211,  -206,   159,
+    -206,  -206,  -206,  -206,   202,   153,   163,   161,   160,   162,
+    -206,    72,  -206,  -206,  -206,    89,   168,    36,    62,  -206,
+    -206,   170,   166,   172,  -206,  -206,   140,    13,  -206,  -206,
+     140,   169,   140,  -206,   427,   168,   180,   175,  -206,   181,
+    -206,  -206,   186,  -206,   185,   427,    27,   161,   -20,   187,
+     183,   -11,  -206,    11,   165,  -206,  -206,   140,  -206,   189,
+     183,  -206,   184,   192,  -206,  -206,   237,   193,    11,  -206,
+     197,  -206,  -206,  -206,  -206,  -206,  -206,   183,   203,   200,
+     190,  -206,  -206,   115,   208,    -5,  -206,   168,   140,  -206,
+    -206,   204,  -206,   427,   427,  -206,    11,  -206,   168,   140,
+    -206,   195,   -17,    11,   207,   183,   217,    27,  -206,  -206,
+    -206,  -206,  -206,  -206,  -206,  -206,   168,   -23,   227,  -206,
+    -206,   183,   168,    11,     2,  -206,   183,   218,  -206,  -206,
+     195,   168,  -206,  -206,  -206,   225,    11,  -206,   219,    93,
+      26,     3,    -3,   229,   230,  -206,  -206,  -206,     2,     2,
+     232,   251,   274,   140,   140,  -206,  -206,  -206,  -206,  -206,
+    -206,  -206,   241,   242,  -206,  -206
+  };
+
+  const unsigned char
+  SoyaParser::yydefact_[] =
+  {
+      35,     0,     0,    37,     5,     9,     0,    10,     1,    43,
+      59,    38,    39,     0,     0,    36,     0,    59,    62,   187,
+       0,     0,     0,    63,    64,    83,   186,   188,     0,   189,
+     190,   191,     0,    59,     0,   185,     0,    55,    44,    34,
+      59,    45,     0,    58,    60,    46,    47,    49,    48,    50,
+      51,     0,   143,   144,   154,   156,   158,   162,   168,   170,
+     174,   178,   183,    40,     0,    11,    12,     0,     0,     0,
+      27,    28,    29,    30,     0,    31,    32,    33,     0,    26,
+      17,     2,     4,     6,     0,     3,     0,    14,    15,    13,
+       0,    84,     0,     0,     0,   184,     0,    56,     0,     0,
+       0,     0,     0,    57,    86,    87,    88,    89,    90,    61,
+      66,     0,   147,   148,   149,   150,   151,   152,   153,     0,
+       0,     0,   160,   161,     0,   164,   165,   166,   167,     0,
+       0,   172,   173,     0,   176,   177,     0,   180,   181,   182,
+       0,   200,     0,     0,     0,     0,     0,    71,     0,     0,
+      76,     0,    20,     0,     0,     0,   200,     0,    82,     0,
+     198,    52,     5,   193,   132,   135,     0,     0,    94,     0,
+     145,   155,   146,   157,   159,   163,   169,   171,   175,   179,
+     201,     0,   199,     0,   192,    41,     0,     0,    74,    78,
+      80,     0,     0,    73,    59,    22,     0,    21,    16,     0,
+       8,     7,     0,    18,     0,    59,     0,     0,     0,     0,
+      99,    59,   107,     0,    96,    91,   194,     0,   195,     0,
+       0,    72,    81,     0,    79,    77,    68,    24,     0,   196,
+     203,    85,   133,   131,   137,   138,   136,     0,     0,     0,
+      98,   100,   113,     0,     0,    59,   111,    93,     0,    92,
+     202,     0,    75,    59,    59,    67,     0,    19,    23,     0,
+     197,   141,     0,     0,   104,     0,     0,     0,   114,   115,
+     108,   112,    95,    65,    70,    69,    25,     0,     0,   139,
+     134,     0,   102,     0,     0,   101,    99,     0,   204,   142,
+     141,   103,   106,   105,    97,     0,     0,   140,   117,     0,
+       0,     0,     0,     0,     0,   120,   121,   116,     0,     0,
+       0,   128,   125,   200,   200,   127,   130,   122,   123,   129,
+     124,   126,     0,     0,   119,   118
+  };
+
+  const short
+  SoyaParser::yypgoto_[] =
+  {
+    -206,   -60,    -1,  -206,  -206,   303,     0,   -72,  -206,  -206,
+    -206,  -206,  -206,  -206,  -206,  -206,  -206,  -206,   295,  -206,
+     -15,  -205,   275,  -206,  -195,  -193,  -206,   264,  -206,  -206,
+    -206,  -206,  -206,  -206,  -206,   120,  -206,  -206,  -206,  -206,
+    -206,  -206,  -206,  -133,  -206,  -206,  -206,    25,  -206,    49,
+    -206,  -132,  -206,   110,  -206,  -206,    64,  -206,  -206,  -206,
+    -206,  -206,  -206,     7,  -206,     5,  -206,  -206,  -206,  -206,
+    -206,    31,   -22,   -92,  -206,  -206,   205,    -7,  -206,  -206,
+    -206,  -206,   194,  -206,   198,  -206,   209,  -206,   -27,  -206,
+    -151,    63,  -206
+  };
+
+  const short
+  SoyaParser::yydefgoto_[] =
+  {
+       0,    80,    35,    82,    83,    84,    36,    86,    87,    88,
+     196,   197,   257,    89,     2,     3,    10,    11,    12,    13,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,   255,    48,   148,   187,   149,   190,   223,    49,    90,
+      50,   103,   104,   169,   214,   249,   105,   239,   240,   241,
+     284,   294,   106,   212,   244,   245,   246,   268,   301,   307,
+     269,   310,   320,   311,   318,   312,   107,   207,   108,   209,
+     262,   279,    51,    52,   120,    53,    54,    55,   124,    56,
+     129,    57,    58,   133,    59,   136,    60,   140,    61,    62,
+     181,   182,   260
+  };
+
+  const short
+  SoyaParser::yytable_[] =
+  {
+       5,     7,    67,    91,   144,   202,   153,    95,     1,    18,
+      93,   130,   234,   188,     4,    18,   242,    70,   243,   170,
+      71,    81,    85,   308,    18,    97,    23,    72,   172,    24,
+       4,   235,    23,    73,    98,    24,    74,     4,   288,   -42,
+     309,    23,    99,    75,    24,   217,   150,   151,   280,   100,
+     242,   281,   243,     9,  -110,    19,   192,    96,   176,   193,
+    -109,    16,    76,    81,    85,    77,    33,    33,    22,   101,
+     159,    78,   303,   292,   305,   304,   102,    81,    85,   293,
+     195,   220,    26,    27,   221,   236,   146,   252,   131,   132,
+       8,    29,    30,    31,    32,   163,   306,   164,   165,   166,
+     167,   168,    14,   293,   293,   147,   141,   -10,   142,   134,
+     135,    16,   143,   179,   173,    15,    79,   174,    16,   180,
+     183,   125,   126,   127,   128,    98,   191,   266,    64,    81,
+      85,   122,   123,    99,   180,   204,    34,   137,   138,   139,
+     100,   247,   184,     4,    65,   168,   232,     4,   156,    66,
+     157,    81,    85,   267,    68,   199,   258,   302,   198,   199,
+     101,    19,   322,   323,   219,    19,    69,   102,   150,    92,
+     225,   131,   132,   110,    22,   121,   315,   316,    22,   226,
+     145,   152,    -9,   154,   276,   155,   162,   160,    26,    27,
+     231,   282,    26,    27,   158,   250,   161,    29,    30,    31,
+      32,    29,    30,    31,    32,    81,    85,   287,   185,   238,
+     186,   291,    81,    85,     4,   189,   194,   200,   201,   168,
+     205,   206,   208,   210,   299,   211,   272,    81,    85,   213,
+     199,   216,    19,   215,   217,   218,   261,   180,   274,   275,
+     224,   227,    34,   228,   203,    22,    34,   229,   230,   248,
+     251,   237,   192,   253,   254,    81,    85,   259,   265,    26,
+      27,   264,    81,    85,   238,   256,    81,    85,    29,    30,
+      31,    32,   263,   270,   203,   273,   283,   286,   -53,   278,
+     290,     4,    81,    85,   289,   238,   298,   296,   300,   313,
+     314,   180,   180,    17,   309,    81,    85,   317,    18,    19,
+     308,    20,   324,   325,     6,    21,    63,   109,    94,   271,
+     222,   295,    22,    34,   285,    23,   319,   233,    24,   321,
+      25,   297,   277,   175,   171,     0,    26,    27,     0,   -54,
+       0,   177,     4,    28,     0,    29,    30,    31,    32,     0,
+       0,     0,    33,   -53,    17,   178,     0,     0,     0,    18,
+      19,     0,    20,     0,     0,     0,    21,     0,     0,     0,
+       0,     0,     0,    22,     0,     0,    23,     0,     0,    24,
+       0,    25,     0,     0,     0,     0,     0,    26,    27,     0,
+      34,     0,     4,     0,    28,     0,    29,    30,    31,    32,
+       0,     0,     0,    33,    17,     0,     0,     0,     0,    18,
+      19,     0,    20,     0,     0,     0,    21,     0,     0,     0,
+       0,     0,     0,    22,     0,     0,    23,     0,     0,    24,
+       0,    25,     0,     0,     0,     0,     0,    26,    27,     0,
+       4,    34,     0,     0,    28,     0,    29,    30,    31,    32,
+       0,     0,    17,    33,   -54,     0,     0,    18,    19,     0,
+      20,     0,     0,     0,    21,     0,     0,     0,     0,     0,
+       0,    22,     0,     0,    23,     0,     0,    24,     0,    25,
+       0,     0,     0,     0,     0,    26,    27,     0,     0,     0,
+       0,    34,    28,     0,    29,    30,    31,    32,     0,     0,
+       0,    33,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,   117,   118,     0,     0,     0,     0,     0,     0,
+       0,     0,   119,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    34
+  };
+
+  const short
+  SoyaParser::yycheck_[] =
+  {
+       1,     1,    17,    25,    64,   156,    78,    34,    33,    20,
+      32,     5,    32,   146,     3,    20,   211,     6,   211,   111,
+       9,    22,    22,    26,    20,    40,    37,    16,   120,    40,
+       3,    51,    37,    22,    10,    40,    25,     3,    61,    30,
+      43,    37,    18,    32,    40,    68,    68,    69,    65,    25,
+     245,    68,   245,    44,    65,    21,    68,    66,   130,    71,
+      65,    70,    51,    64,    64,    54,    64,    64,    34,    45,
+      92,    60,    46,    71,    71,    49,    52,    78,    78,   284,
+     152,    68,    48,    49,    71,   105,    52,   220,    82,    83,
+       0,    57,    58,    59,    60,    96,   301,    98,    99,   100,
+     101,   102,    70,   308,   309,    71,    60,    66,    62,    73,
+      74,    70,    66,   140,   121,    71,   105,   124,    70,   141,
+     142,    98,    99,   100,   101,    10,   148,    12,    30,   130,
+     130,    96,    97,    18,   156,   157,   102,    75,    76,    77,
+      25,   213,   143,     3,     3,   146,   206,     3,    60,     3,
+      62,   152,   152,    38,    60,    62,   228,    64,    61,    62,
+      45,    21,   313,   314,   186,    21,    60,    52,   190,    60,
+     192,    82,    83,    71,    34,   103,   308,   309,    34,   194,
+      55,    60,    66,    66,   256,    66,     3,    61,    48,    49,
+     205,   263,    48,    49,    71,   217,    65,    57,    58,    59,
+      60,    57,    58,    59,    60,   206,   206,   267,    71,   210,
+      60,   283,   213,   213,     3,    71,    61,     3,     3,   220,
+      61,    19,    69,    60,   296,    64,   248,   228,   228,    69,
+      62,    61,    21,    71,    68,    63,   237,   259,   253,   254,
+      71,    61,   102,    68,    63,    34,   102,    61,    63,    84,
+      61,    64,    68,    61,    17,   256,   256,    60,    68,    48,
+      49,    61,   263,   263,   265,    72,   267,   267,    57,    58,
+      59,    60,    69,    65,    63,    71,    69,    60,     0,    84,
+     281,     3,   283,   283,    57,   286,    61,    69,    69,    60,
+      60,   313,   314,    15,    43,   296,   296,    65,    20,    21,
+      26,    23,    61,    61,     1,    27,    11,    43,    33,   245,
+     190,   286,    34,   102,   265,    37,   311,   207,    40,   312,
+      42,   290,   259,   129,   119,    -1,    48,    49,    -1,     0,
+      -1,   133,     3,    55,    -1,    57,    58,    59,    60,    -1,
+      -1,    -1,    64,    65,    15,   136,    -1,    -1,    -1,    20,
+      21,    -1,    23,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    34,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+     102,    -1,     3,    -1,    55,    -1,    57,    58,    59,    60,
+      -1,    -1,    -1,    64,    15,    -1,    -1,    -1,    -1,    20,
+      21,    -1,    23,    -1,    -1,    -1,    27,    -1,    -1,    -1,
+      -1,    -1,    -1,    34,    -1,    -1,    37,    -1,    -1,    40,
+      -1,    42,    -1,    -1,    -1,    -1,    -1,    48,    49,    -1,
+       3,   102,    -1,    -1,    55,    -1,    57,    58,    59,    60,
+      -1,    -1,    15,    64,    65,    -1,    -1,    20,    21,    -1,
+      23,    -1,    -1,    -1,    27,    -1,    -1,    -1,    -1,    -1,
+      -1,    34,    -1,    -1,    37,    -1,    -1,    40,    -1,    42,
+      -1,    -1,    -1,    -1,    -1,    48,    49,    -1,    -1,    -1,
+      -1,   102,    55,    -1,    57,    58,    59,    60,    -1,    -1,
+      -1,    64,    84,    85,    86,    87,    88,    89,    -1,    -1,
+      -1,    -1,    94,    95,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   104,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   102
+  };
+
+  const unsigned char
+  SoyaParser::yystos_[] =
+  {
+       0,    33,   120,   121,     3,   108,   111,   112,     0,    44,
+     122,   123,   124,   125,    70,    71,    70,    15,    20,    21,
+      23,    27,    34,    37,    40,    42,    48,    49,    55,    57,
+      58,    59,    60,    64,   102,   108,   112,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   138,   144,
+     146,   178,   179,   181,   182,   183,   185,   187,   188,   190,
+     192,   194,   195,   124,    30,     3,     3,   126,    60,    60,
+       6,     9,    16,    22,    25,    32,    51,    54,    60,   105,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   119,
+     145,   178,    60,   178,   128,   194,    66,   126,    10,    18,
+      25,    45,    52,   147,   148,   152,   158,   172,   174,   133,
+      71,    84,    85,    86,    87,    88,    89,    94,    95,   104,
+     180,   103,    96,    97,   184,    98,    99,   100,   101,   186,
+       5,    82,    83,   189,    73,    74,   191,    75,    76,    77,
+     193,    60,    62,    66,   107,    55,    52,    71,   139,   141,
+     178,   178,    60,   113,    66,    66,    60,    62,    71,   178,
+      61,    65,     3,   108,   108,   108,   108,   108,   108,   149,
+     179,   182,   179,   183,   183,   188,   113,   190,   192,   194,
+     178,   196,   197,   178,   108,    71,    60,   140,   149,    71,
+     142,   178,    68,    71,    61,   113,   116,   117,    61,    62,
+       3,     3,   196,    63,   178,    61,    19,   173,    69,   175,
+      60,    64,   159,    69,   150,    71,    61,    68,    63,   178,
+      68,    71,   141,   143,    71,   178,   126,    61,    68,    61,
+      63,   126,   107,   159,    32,    51,   105,    64,   108,   153,
+     154,   155,   130,   131,   160,   161,   162,   113,    84,   151,
+     178,    61,   149,    61,    17,   137,    72,   118,   113,    60,
+     198,   108,   176,    69,    61,    68,    12,    38,   163,   166,
+      65,   162,   178,    71,   126,   126,   113,   197,    84,   177,
+      65,    68,   113,    69,   156,   155,    60,   107,    61,    57,
+     108,   113,    71,   127,   157,   153,    69,   177,    61,   113,
+      69,   164,    64,    46,    49,    71,   127,   165,    26,    43,
+     167,   169,   171,    60,    60,   157,   157,    65,   170,   171,
+     168,   169,   196,   196,    61,    61
+  };
+
+  const unsigned char
+  SoyaParser::yyr1_[] =
+  {
+       0,   106,   107,   107,   107,   108,   109,   110,   110,   111,
+     111,   112,   112,   113,   113,   113,   113,   113,   114,   115,
+     116,   116,   117,   117,   118,   118,   119,   119,   119,   119,
+     119,   119,   119,   119,   120,   121,   121,   122,   122,   123,
+     123,   124,   125,   125,   126,   126,   126,   126,   126,   126,
+     126,   126,   127,   128,   128,   129,   129,   130,   131,   131,
+     132,   132,   133,   133,   133,   134,   135,   136,   137,   137,
+     138,   139,   139,   139,   140,   140,   141,   141,   142,   142,
+     143,   143,   144,   145,   145,   146,   147,   147,   147,   147,
+     147,   148,   149,   150,   150,   151,   151,   152,   153,   153,
+     154,   154,   155,   156,   156,   157,   157,   158,   159,   160,
+     160,   161,   161,   162,   162,   162,   163,   164,   164,   164,
+     165,   165,   166,   167,   167,   168,   168,   169,   170,   170,
+     171,   172,   173,   173,   174,   175,   175,   175,   175,   176,
+     176,   177,   177,   178,   179,   179,   179,   180,   180,   180,
+     180,   180,   180,   180,   181,   181,   182,   182,   183,   183,
+     184,   184,   185,   185,   186,   186,   186,   186,   187,   187,
+     188,   188,   189,   189,   190,   190,   191,   191,   192,   192,
+     193,   193,   193,   194,   194,   195,   195,   195,   195,   195,
+     195,   195,   195,   195,   195,   195,   195,   195,   195,   196,
+     196,   197,   197,   198,   198
+  };
+
+  const signed char
+  SoyaParser::yyr2_[] =
+  {
+       0,     2,     1,     1,     1,     1,     1,     3,     3,     1,
+       1,     3,     3,     1,     1,     1,     3,     1,     3,     5,
+       0,     1,     1,     3,     0,     2,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     0,     3,     0,     1,     1,
+       2,     4,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     1,     0,     1,     2,     2,     1,     0,
+       1,     2,     1,     1,     1,     7,     2,     6,     0,     2,
+       7,     1,     3,     2,     1,     3,     1,     3,     1,     2,
+       0,     1,     3,     0,     1,     5,     1,     1,     1,     1,
+       1,     3,     3,     2,     0,     2,     0,     7,     1,     0,
+       1,     3,     3,     2,     0,     1,     1,     3,     3,     1,
+       0,     1,     2,     1,     2,     2,     6,     0,     5,     5,
+       1,     1,     7,     2,     2,     0,     1,     2,     0,     1,
+       2,     4,     0,     2,     6,     0,     2,     2,     2,     2,
+       4,     0,     2,     1,     1,     3,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     1,     3,     1,     3,
+       1,     1,     1,     3,     1,     1,     1,     1,     1,     3,
+       1,     3,     1,     1,     1,     3,     1,     1,     1,     3,
+       1,     1,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     4,     4,     5,     6,     3,     1,
+       0,     1,     3,     0,     3
+  };
+
+
+#if YYDEBUG
+  // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
+  const char*
+  const SoyaParser::yytname_[] =
+  {
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER",
+  "\"alias\"", "\"as\"", "\"bool\"", "\"break\"", "\"case\"", "\"char\"",
+  "\"class\"", "\"const\"", "\"constructor\"", "\"continue\"",
+  "\"default\"", "\"do\"", "\"double\"", "\"else\"", "\"enum\"",
+  "\"extends\"", "\"extern\"", "\"false\"", "\"float\"", "\"for\"",
+  "\"from\"", "\"function\"", "\"get\"", "\"if\"", "\"is\"",
+  "\"implements\"", "\"import\"", "\"int\"", "\"long\"", "\"module\"",
+  "\"new\"", "\"null\"", "\"override\"", "\"private\"", "\"property\"",
+  "\"protected\"", "\"public\"", "\"readonly\"", "\"return\"", "\"set\"",
+  "\"static\"", "\"struct\"", "\"super\"", "\"switch\"", "\"true\"",
+  "\"this\"", "\"uint\"", "\"ulong\"", "\"var\"", "\"virtual\"",
+  "\"void\"", "\"while\"", "\"xor\"", "INT_LITERAL", "FP_LITERAL",
+  "CHAR_LITERAL", "\"(\"", "\")\"", "\"[\"", "\"]\"", "\"{\"", "\"}\"",
+  "\".\"", "\"..\"", "\",\"", "\":\"", "\"::\"", "\";\"", "\"=>\"",
+  "\"+\"", "\"-\"", "\"*\"", "\"/\"", "\"%\"", "\"&\"", "\"|\"", "\"^\"",
+  "\"~\"", "\"<<\"", "\">>\"", "\"=\"", "\"+=\"", "\"-=\"", "\"*=\"",
+  "\"/=\"", "\"%=\"", "\"&=\"", "\"|=\"", "\"^=\"", "\"~=\"", "\"<<=\"",
+  "\">>=\"", "\"==\"", "\"!=\"", "\"<\"", "\">\"", "\"<=\"", "\">=\"",
+  "\"!\"", "\"&&\"", "\"||\"", "INT_TYPE", "$accept", "name",
+  "simple_name", "qualified_name", "qualified_name_identifiers",
+  "module_name", "package_module_name", "type", "array_type",
+  "function_type", "parameter_types_opt", "parameter_types",
+  "function_type_return_type_opt", "simple_type", "module",
+  "module_declaration_opt", "import_statements_opt", "import_statements",
+  "import_statement", "static_opt", "statement", "block", "statements_opt",
+  "statements", "declaration_statement", "modifiers_opt", "modifiers",
+  "modifier", "do_statement", "expression_statement", "if_statement",
+  "else_statement_opt", "for_statement", "for_initializer_opt",
+  "variable_declaration_list", "expression_statement_list",
+  "for_condition_opt", "for_iterator_opt", "return_statement",
+  "return_value_opt", "while_statement", "declaration",
+  "variable_declaration", "variable_or_constant_declarator",
+  "variable_type_opt", "initializer_opt", "function_declaration",
+  "function_parameters_opt", "function_parameters", "function_parameter",
+  "return_type_opt", "function_body_opt", "struct_declaration",
+  "declaration_block", "declaration_block_statements_opt",
+  "declaration_block_statements", "declaration_block_statement",
+  "constructor_declaration", "constructor_initializer_opt",
+  "constructor_body_opt", "property_declaration", "property_accessors",
+  "get_accessor_opt", "get_accessor", "set_accessor_opt", "set_accessor",
+  "class_declaration", "extends_clause_opt", "enum_declaration",
+  "underlying_type_opt", "enum_constants", "enum_value_opt", "expression",
+  "assignment_expression", "compound_assignment_operator",
+  "logical_or_expression", "logical_and_expression", "equality_expression",
+  "equality_operator", "relational_expression", "relational_operator",
+  "cast_expression", "bit_shift_expression", "bit_shift_operator",
+  "additive_expression", "additive_operator", "multiplicative_expression",
+  "multiplicative_operator", "unary_expression", "primary_expression",
+  "function_arguments_opt", "function_arguments", "array_elements_opt", YY_NULLPTR
+  };
+#endif
+
+
+#if YYDEBUG
+  const short
+  SoyaParser::yyrline_[] =
+  {
+       0,   413,   413,   417,   422,   429,   437,   444,   451,   459,
+     463,   471,   476,   486,   487,   488,   489,   490,   499,   511,
+     519,   520,   524,   529,   537,   538,   542,   543,   544,   545,
+     546,   547,   548,   549,   555,   618,   619,   625,   626,   630,
+     635,   643,   656,   657,   663,   664,   665,   666,   667,   668,
+     669,   670,   674,   686,   687,   691,   696,   704,   730,   731,
+     735,   740,   748,   749,   750,   754,   762,   770,   778,   779,
+     783,   797,   798,   799,   803,   811,   820,   828,   837,   838,
+     842,   843,   847,   855,   856,   860,   870,   871,   872,   873,
+     874,   878,   886,   895,   896,   900,   901,   905,   916,   917,
+     921,   926,   934,   943,   944,   948,   949,   953,   962,   974,
+     975,   979,   984,   992,   999,  1018,  1037,  1046,  1049,  1055,
+    1064,  1065,  1069,  1081,  1087,  1096,  1097,  1101,  1109,  1110,
+    1114,  1122,  1132,  1136,  1145,  1155,  1156,  1157,  1158,  1162,
+    1180,  1205,  1206,  1212,  1219,  1223,  1228,  1236,  1237,  1238,
+    1239,  1240,  1241,  1242,  1246,  1250,  1258,  1262,  1270,  1274,
+    1282,  1283,  1287,  1291,  1299,  1300,  1301,  1302,  1306,  1310,
+    1318,  1322,  1330,  1331,  1335,  1339,  1347,  1348,  1352,  1356,
+    1364,  1365,  1366,  1370,  1374,  1382,  1388,  1393,  1398,  1403,
+    1409,  1415,  1420,  1426,  1437,  1442,  1447,  1463,  1476,  1484,
+    1485,  1489,  1494,  1502,  1503
+  };
+
+  void
+  SoyaParser::yy_stack_print_ () const
+  {
+    *yycdebug_ << "Stack now";
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
+  }
+
+  void
+  SoyaParser::yy_reduce_print_ (int yyrule) const
+  {
+    int yylno = yyrline_[yyrule];
+    int yynrhs = yyr2_[yyrule];
+    // Print the symbols being reduced, and their result.
+    *yycdebug_ << "Reducing stack by rule " << yyrule - 1
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
+    for (int yyi = 0; yyi < yynrhs; yyi++)
+      YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
+                       yystack_[(yynrhs) - (yyi + 1)]);
+  }
+#endif // YYDEBUG
+
+  SoyaParser::symbol_kind_type
+  SoyaParser::yytranslate_ (int t) YY_NOEXCEPT
+  {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105
+    };
+    // Last valid token kind.
+    const int code_max = 360;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
+  }
+
+} // yy
+#line 3031 "/root/repo/src/parser/parser.cpp"
+
+#line 1506 "/root/repo/src/parser/soya.yy"
+
+//// Error Reporting ///////////////////////////////////////////////////////////
+
+
+void
+yy::SoyaParser::error(const yy::SoyaParser::location_type& l,
+                      const std::string& m)
+{
+    Location source(*l.begin.filename,
+                    l.begin.line, l.begin.column,
+                    l.end.line, l.end.column);
+
+    driver->resultBuilder()->addError(source, "Syntax error.");
+}
+
+
+void
+set_location(Node* node,
+             const yy::SoyaParser::location_type& begin,
+             const yy::SoyaParser::location_type& end)
+{
+    Location l(*begin.begin.filename,
+               begin.begin.line, begin.begin.column,
+               end.end.line, end.end.column);
+
+    node->setLocation(l);
+}
+
+
+std::string
+modifier_to_string(DeclaredEntity::Modifier mod)
+{
+    switch (mod)
+    {
+        case DeclaredEntity::EXTERN:
+            return "extern";
+        case DeclaredEntity::PRIVATE:
+            return "private";
+        case DeclaredEntity::PUBLIC:
+            return "public";
+        case DeclaredEntity::STATIC:
+            return "static";
+        default:
+            assert (false);
+    }
+}
@@ -0,0 +1,1130 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton interface for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+
+/**
+ ** \file /root/repo/src/parser/parser.hpp
+ ** Define the yy::parser class.
+ */
+
+// C++ LALR(1) parser skeleton written by Akim Demaille.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_ROOT_REPO_SRC_PARSER_PARSER_HPP_INCLUDED
+# define YY_YY_ROOT_REPO_SRC_PARSER_PARSER_HPP_INCLUDED
+// "%code requires" blocks.
+#line 19 "/root/repo/src/parser/soya.yy"
+
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <stdint.h>
+
+#include <ast/ast.h>
+
+using namespace soyac::ast;
+
+/*
+ * The lists built up while parsing are allocated in the parsed module's
+ * arena, just like the nodes themselves, and are never freed explicitly.
+ */
+template <class T>
+using ParserList = std::list<T, ArenaAllocator<T> >;
+
+namespace soyac {
+namespace parser
+{
+class ParserDriver;
+}}
+
+#line 73 "/root/repo/src/parser/parser.hpp"
+
+
+# include <cstdlib> // std::abort
+# include <iostream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
+# include "location.hh"
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+
+namespace yy {
+#line 208 "/root/repo/src/parser/parser.hpp"
+
+
+
+
+  /// A Bison parser.
+  class SoyaParser
+  {
+  public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
+    /// Symbol semantic values.
+    union value_type
+    {
+#line 47 "/root/repo/src/parser/soya.yy"
+
+    Node* node;
+
+    Name* name;
+    Identifier identifier;
+    std::string* modulename;
+    ParserList<Identifier>* identifierlist;
+
+    Block* block;
+    DeclarationBlock* dblock;
+    DeclarationStatement* dstmt;
+    DeclaredEntity* decl;
+    DeclaredEntity::Modifier mod;
+    ConstructorInitializer* cinit;
+    Expression* expr;
+    Function* acc;
+    Function** accs;
+    FunctionParameter* param;
+    Import* imp;
+    Statement* stmt;
+    UnresolvedBinaryExpression::Kind binop;
+    Type* type;
+
+    ParserList<DeclarationStatement*>* dstmtlist;
+    ParserList<DeclaredEntity::Modifier>* modlist;
+    ParserList<EnumConstant*>* econstlist;
+    ParserList<Expression*>* exprlist;
+    ParserList<FunctionParameter*>* paramlist;
+    ParserList<Import*>* implist;
+    ParserList<Statement*>* stmtlist;
+    ParserList<Type*>* typelist;
+
+    IntegerValue* intLiteral;
+    FloatingPointValue* fpLiteral;
+    uint32_t charLiteral;
+
+    bool boolVal;
+
+#line 265 "/root/repo/src/parser/parser.hpp"
+
+    };
+#endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
+    /// Symbol locations.
+    typedef location location_type;
+
+    /// Syntax errors thrown from user actions.
+    struct syntax_error : std::runtime_error
+    {
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
+      location_type location;
+    };
+
+    /// Token kinds.
+    struct token
+    {
+      enum token_kind_type
+      {
+        YYEMPTY = -2,
+    YYEOF = 0,                     // "end of file"
+    YYerror = 256,                 // error
+    YYUNDEF = 257,                 // "invalid token"
+    IDENTIFIER = 258,              // IDENTIFIER
+    ALIAS = 259,                   // "alias"
+    AS = 260,                      // "as"
+    BOOL = 261,                    // "bool"
+    BREAK = 262,                   // "break"
+    CASE = 263,                    // "case"
+    CHAR = 264,                    // "char"
+    CLASS = 265,                   // "class"
+    CONST = 266,                   // "const"
+    CONSTRUCTOR = 267,             // "constructor"
+    CONTINUE = 268,                // "continue"
+    DEFAULT = 269,                 // "default"
+    DO = 270,                      // "do"
+    DOUBLE = 271,                  // "double"
+    ELSE = 272,                    // "else"
+    ENUM = 273,                    // "enum"
+    EXTENDS = 274,                 // "extends"
+    EXTERN = 275,                  // "extern"
+    FALSE_ = 276,                  // "false"
+    FLOAT = 277,                   // "float"
+    FOR = 278,                     // "for"
+    FROM = 279,                    // "from"
+    FUNCTION = 280,                // "function"
+    GET = 281,                     // "get"
+    IF = 282,                      // "if"
+    IS = 283,                      // "is"
+    IMPLEMENTS = 284,              // "implements"
+    IMPORT = 285,                  // "import"
+    INT = 286,                     // "int"
+    LONG = 287,                    // "long"
+    MODULE = 288,                  // "module"
+    NEW = 289,                     // "new"
+    nullptr_ = 290,                // "null"
+    OVERRIDE = 291,                // "override"
+    PRIVATE = 292,                 // "private"
+    PROPERTY = 293,                // "property"
+    PROTECTED = 294,               // "protected"
+    PUBLIC = 295,                  // "public"
+    READONLY = 296,                // "readonly"
+    RETURN = 297,                  // "return"
+    SET = 298,                     // "set"
+    STATIC = 299,                  // "static"
+    STRUCT = 300,                  // "struct"
+    SUPER = 301,                   // "super"
+    SWITCH = 302,                  // "switch"
+    TRUE_ = 303,                   // "true"
+    THIS = 304,                    // "this"
+    UINT = 305,                    // "uint"
+    ULONG = 306,                   // "ulong"
+    VAR = 307,                     // "var"
+    VIRTUAL = 308,                 // "virtual"
+    VOID = 309,                    // "void"
+    WHILE = 310,                   // "while"
+    XOR = 311,                     // "xor"
+    INT_LITERAL = 312,             // INT_LITERAL
+    FP_LITERAL = 313,              // FP_LITERAL
+    CHAR_LITERAL = 314,            // CHAR_LITERAL
+    LPAREN = 315,                  // "("
+    RPAREN = 316,                  // ")"
+    LBRACK = 317,                  // "["
+    RBRACK = 318,                  // "]"
+    LCURL = 319,                   // "{"
+    RCURL = 320,                   // "}"
+    DOT = 321,                     // "."
+    DOTDOT = 322,                  // ".."
+    COMMA = 323,                   // ","
+    COLON = 324,                   // ":"
+    DCOLON = 325,                  // "::"
+    SCOLON = 326,                  // ";"
+    ARROW = 327,                   // "=>"
+    PLUS = 328,                    // "+"
+    MINUS = 329,                   // "-"
+    MUL = 330,                     // "*"
+    DIV = 331,                     // "/"
+    MOD = 332,                     // "%"
+    BAND = 333,                    // "&"
+    BOR = 334,                     // "|"
+    BXOR = 335,                    // "^"
+    BNOT = 336,                    // "~"
+    LSHIFT = 337,                  // "<<"
+    RSHIFT = 338,                  // ">>"
+    ASSIGN = 339,                  // "="
+    PLUS_ASSIGN = 340,             // "+="
+    MINUS_ASSIGN = 341,            // "-="
+    MUL_ASSIGN = 342,              // "*="
+    DIV_ASSIGN = 343,              // "/="
+    MOD_ASSIGN = 344,              // "%="
+    BAND_ASSIGN = 345,             // "&="
+    BOR_ASSIGN = 346,              // "|="
+    BXOR_ASSIGN = 347,             // "^="
+    BNOT_ASSIGN = 348,             // "~="
+    LSHIFT_ASSIGN = 349,           // "<<="
+    RSHIFT_ASSIGN = 350,           // ">>="
+    EQ = 351,                      // "=="
+    NE = 352,                      // "!="
+    LT = 353,                      // "<"
+    GT = 354,                      // ">"
+    LE = 355,                      // "<="
+    GE = 356,                      // ">="
+    NOT = 357,                     // "!"
+    AND = 358,                     // "&&"
+    OR = 359,                      // "||"
+    INT_TYPE = 360                 // INT_TYPE
+      };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
+    };
+
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 106, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_IDENTIFIER = 3,                        // IDENTIFIER
+        S_ALIAS = 4,                             // "alias"
+        S_AS = 5,                                // "as"
+        S_BOOL = 6,                              // "bool"
+        S_BREAK = 7,                             // "break"
+        S_CASE = 8,                              // "case"
+        S_CHAR = 9,                              // "char"
+        S_CLASS = 10,                            // "class"
+        S_CONST = 11,                            // "const"
+        S_CONSTRUCTOR = 12,                      // "constructor"
+        S_CONTINUE = 13,                         // "continue"
+        S_DEFAULT = 14,                          // "default"
+        S_DO = 15,                               // "do"
+        S_DOUBLE = 16,                           // "double"
+        S_ELSE = 17,                             // "else"
+        S_ENUM = 18,                             // "enum"
+        S_EXTENDS = 19,                          // "extends"
+        S_EXTERN = 20,                           // "extern"
+        S_FALSE_ = 21,                           // "false"
+        S_FLOAT = 22,                            // "float"
+        S_FOR = 23,                              // "for"
+        S_FROM = 24,                             // "from"
+        S_FUNCTION = 25,                         // "function"
+        S_GET = 26,                              // "get"
+        S_IF = 27,                               // "if"
+        S_IS = 28,                               // "is"
+        S_IMPLEMENTS = 29,                       // "implements"
+        S_IMPORT = 30,                           // "import"
+        S_INT = 31,                              // "int"
+        S_LONG = 32,                             // "long"
+        S_MODULE = 33,                           // "module"
+        S_NEW = 34,                              // "new"
+        S_nullptr_ = 35,                         // "null"
+        S_OVERRIDE = 36,                         // "override"
+        S_PRIVATE = 37,                          // "private"
+        S_PROPERTY = 38,                         // "property"
+        S_PROTECTED = 39,                        // "protected"
+        S_PUBLIC = 40,                           // "public"
+        S_READONLY = 41,                         // "readonly"
+        S_RETURN = 42,                           // "return"
+        S_SET = 43,                              // "set"
+        S_STATIC = 44,                           // "static"
+        S_STRUCT = 45,                           // "struct"
+        S_SUPER = 46,                            // "super"
+        S_SWITCH = 47,                           // "switch"
+        S_TRUE_ = 48,                            // "true"
+        S_THIS = 49,                             // "this"
+        S_UINT = 50,                             // "uint"
+        S_ULONG = 51,                            // "ulong"
+        S_VAR = 52,                              // "var"
+        S_VIRTUAL = 53,                          // "virtual"
+        S_VOID = 54,                             // "void"
+        S_WHILE = 55,                            // "while"
+        S_XOR = 56,                              // "xor"
+        S_INT_LITERAL = 57,                      // INT_LITERAL
+        S_FP_LITERAL = 58,                       // FP_LITERAL
+        S_CHAR_LITERAL = 59,                     // CHAR_LITERAL
+        S_LPAREN = 60,                           // "("
+        S_RPAREN = 61,                           // ")"
+        S_LBRACK = 62,                           // "["
+        S_RBRACK = 63,                           // "]"
+        S_LCURL = 64,                            // "{"
+        S_RCURL = 65,                            // "}"
+        S_DOT = 66,                              // "."
+        S_DOTDOT = 67,                           // ".."
+        S_COMMA = 68,                            // ","
+        S_COLON = 69,                            // ":"
+        S_DCOLON = 70,                           // "::"
+        S_SCOLON = 71,                           // ";"
+        S_ARROW = 72,                            // "=>"
+        S_PLUS = 73,                             // "+"
+        S_MINUS = 74,                            // "-"
+        S_MUL = 75,                              // "*"
+        S_DIV = 76,                              // "/"
+        S_MOD = 77,                              // "%"
+        S_BAND = 78,                             // "&"
+        S_BOR = 79,                              // "|"
+        S_BXOR = 80,                             // "^"
+        S_BNOT = 81,                             // "~"
+        S_LSHIFT = 82,                           // "<<"
+        S_RSHIFT = 83,                           // ">>"
+        S_ASSIGN = 84,                           // "="
+        S_PLUS_ASSIGN = 85,                      // "+="
+        S_MINUS_ASSIGN = 86,                     // "-="
+        S_MUL_ASSIGN = 87,                       // "*="
+        S_DIV_ASSIGN = 88,                       // "/="
+        S_MOD_ASSIGN = 89,                       // "%="
+        S_BAND_ASSIGN = 90,                      // "&="
+        S_BOR_ASSIGN = 91,                       // "|="
+        S_BXOR_ASSIGN = 92,                      // "^="
+        S_BNOT_ASSIGN = 93,                      // "~="
+        S_LSHIFT_ASSIGN = 94,                    // "<<="
+        S_RSHIFT_ASSIGN = 95,                    // ">>="
+        S_EQ = 96,                               // "=="
+        S_NE = 97,                               // "!="
+        S_LT = 98,                               // "<"
+        S_GT = 99,                               // ">"
+        S_LE = 100,                              // "<="
+        S_GE = 101,                              // ">="
+        S_NOT = 102,                             // "!"
+        S_AND = 103,                             // "&&"
+        S_OR = 104,                              // "||"
+        S_INT_TYPE = 105,                        // INT_TYPE
+        S_YYACCEPT = 106,                        // $accept
+        S_name = 107,                            // name
+        S_simple_name = 108,                     // simple_name
+        S_qualified_name = 109,                  // qualified_name
+        S_qualified_name_identifiers = 110,      // qualified_name_identifiers
+        S_module_name = 111,                     // module_name
+        S_package_module_name = 112,             // package_module_name
+        S_type = 113,                            // type
+        S_array_type = 114,                      // array_type
+        S_function_type = 115,                   // function_type
+        S_parameter_types_opt = 116,             // parameter_types_opt
+        S_parameter_types = 117,                 // parameter_types
+        S_function_type_return_type_opt = 118,   // function_type_return_type_opt
+        S_simple_type = 119,                     // simple_type
+        S_module = 120,                          // module
+        S_module_declaration_opt = 121,          // module_declaration_opt
+        S_import_statements_opt = 122,           // import_statements_opt
+        S_import_statements = 123,               // import_statements
+        S_import_statement = 124,                // import_statement
+        S_static_opt = 125,                      // static_opt
+        S_statement = 126,                       // statement
+        S_block = 127,                           // block
+        S_statements_opt = 128,                  // statements_opt
+        S_statements = 129,                      // statements
+        S_declaration_statement = 130,           // declaration_statement
+        S_modifiers_opt = 131,                   // modifiers_opt
+        S_modifiers = 132,                       // modifiers
+        S_modifier = 133,                        // modifier
+        S_do_statement = 134,                    // do_statement
+        S_expression_statement = 135,            // expression_statement
+        S_if_statement = 136,                    // if_statement
+        S_else_statement_opt = 137,              // else_statement_opt
+        S_for_statement = 138,                   // for_statement
+        S_for_initializer_opt = 139,             // for_initializer_opt
+        S_variable_declaration_list = 140,       // variable_declaration_list
+        S_expression_statement_list = 141,       // expression_statement_list
+        S_for_condition_opt = 142,               // for_condition_opt
+        S_for_iterator_opt = 143,                // for_iterator_opt
+        S_return_statement = 144,                // return_statement
+        S_return_value_opt = 145,                // return_value_opt
+        S_while_statement = 146,                 // while_statement
+        S_declaration = 147,                     // declaration
+        S_variable_declaration = 148,            // variable_declaration
+        S_variable_or_constant_declarator = 149, // variable_or_constant_declarator
+        S_variable_type_opt = 150,               // variable_type_opt
+        S_initializer_opt = 151,                 // initializer_opt
+        S_function_declaration = 152,            // function_declaration
+        S_function_parameters_opt = 153,         // function_parameters_opt
+        S_function_parameters = 154,             // function_parameters
+        S_function_parameter = 155,              // function_parameter
+        S_return_type_opt = 156,                 // return_type_opt
+        S_function_body_opt = 157,               // function_body_opt
+        S_struct_declaration = 158,              // struct_declaration
+        S_declaration_block = 159,               // declaration_block
+        S_declaration_block_statements_opt = 160, // declaration_block_statements_opt
+        S_declaration_block_statements = 161,    // declaration_block_statements
+        S_declaration_block_statement = 162,     // declaration_block_statement
+        S_constructor_declaration = 163,         // constructor_declaration
+        S_constructor_initializer_opt = 164,     // constructor_initializer_opt
+        S_constructor_body_opt = 165,            // constructor_body_opt
+        S_property_declaration = 166,            // property_declaration
+        S_property_accessors = 167,              // property_accessors
+        S_get_accessor_opt = 168,                // get_accessor_opt
+        S_get_accessor = 169,                    // get_accessor
+        S_set_accessor_opt = 170,                // set_accessor_opt
+        S_set_accessor = 171,                    // set_accessor
+        S_class_declaration = 172,               // class_declaration
+        S_extends_clause_opt = 173,              // extends_clause_opt
+        S_enum_declaration = 174,                // enum_declaration
+        S_underlying_type_opt = 175,             // underlying_type_opt
+        S_enum_constants = 176,                  // enum_constants
+        S_enum_value_opt = 177,                  // enum_value_opt
+        S_expression = 178,                      // expression
+        S_assignment_expression = 179,           // assignment_expression
+        S_compound_assignment_operator = 180,    // compound_assignment_operator
+        S_logical_or_expression = 181,           // logical_or_expression
+        S_logical_and_expression = 182,          // logical_and_expression
+        S_equality_expression = 183,             // equality_expression
+        S_equality_operator = 184,               // equality_operator
+        S_relational_expression = 185,           // relational_expression
+        S_relational_operator = 186,             // relational_operator
+        S_cast_expression = 187,                 // cast_expression
+        S_bit_shift_expression = 188,            // bit_shift_expression
+        S_bit_shift_operator = 189,              // bit_shift_operator
+        S_additive_expression = 190,             // additive_expression
+        S_additive_operator = 191,               // additive_operator
+        S_multiplicative_expression = 192,       // multiplicative_expression
+        S_multiplicative_operator = 193,         // multiplicative_operator
+        S_unary_expression = 194,                // unary_expression
+        S_primary_expression = 195,              // primary_expression
+        S_function_arguments_opt = 196,          // function_arguments_opt
+        S_function_arguments = 197,              // function_arguments
+        S_array_elements_opt = 198               // array_elements_opt
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
+
+    /// A complete symbol.
+    ///
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
+    ///
+    /// Provide access to semantic value and location.
+    template <typename Base>
+    struct basic_symbol : Base
+    {
+      /// Alias to Base.
+      typedef Base super_type;
+
+      /// Default constructor.
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value (std::move (that.value))
+        , location (std::move (that.location))
+      {}
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+      /// Constructor for valueless symbols.
+      basic_symbol (typename Base::kind_type t,
+                    YY_MOVE_REF (location_type) l);
+
+      /// Constructor for symbols with semantic value.
+      basic_symbol (typename Base::kind_type t,
+                    YY_RVREF (value_type) v,
+                    YY_RVREF (location_type) l);
+
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
+
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        Base::clear ();
+      }
+
+#if YYDEBUG || 0
+      /// The user-facing name of this symbol.
+      const char *name () const YY_NOEXCEPT
+      {
+        return SoyaParser::symbol_name (this->kind ());
+      }
+#endif // #if YYDEBUG || 0
+
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
+
+      /// The semantic value.
+      value_type value;
+
+      /// The location.
+      location_type location;
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
+    };
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {};
+
+    /// Build a parser object.
+    SoyaParser (soyac::parser::ParserDriver* driver_yyarg);
+    virtual ~SoyaParser ();
+
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    SoyaParser (const SoyaParser&) = delete;
+    /// Non copyable.
+    SoyaParser& operator= (const SoyaParser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
+    /// Parse.
+    /// \returns  0 iff parsing succeeded.
+    virtual int parse ();
+
+#if YYDEBUG
+    /// The current debugging stream.
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging stream.
+    void set_debug_stream (std::ostream &);
+
+    /// Type for debugging levels.
+    typedef int debug_level_type;
+    /// The current debugging level.
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
+    /// Set the current debugging level.
+    void set_debug_level (debug_level_type l);
+#endif
+
+    /// Report a syntax error.
+    /// \param loc    where the syntax error is found.
+    /// \param msg    a description of the syntax error.
+    virtual void error (const location_type& loc, const std::string& msg);
+
+    /// Report a syntax error.
+    void error (const syntax_error& err);
+
+#if YYDEBUG || 0
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static const char *symbol_name (symbol_kind_type yysymbol);
+#endif // #if YYDEBUG || 0
+
+
+
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    SoyaParser (const SoyaParser&);
+    /// Non copyable.
+    SoyaParser& operator= (const SoyaParser&);
+#endif
+
+
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
+
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
+
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
+
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
+
+#if YYDEBUG || 0
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
+#endif // #if YYDEBUG || 0
+
+
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
+
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const unsigned char yydefact_[];
+
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
+
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
+
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
+
+    static const short yycheck_[];
+
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const unsigned char yystos_[];
+
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const unsigned char yyr1_[];
+
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
+
+
+#if YYDEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
+
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
+
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
+
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
+
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
+
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
+
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
+
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
+
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
+
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
+
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
+
+    /// The stack.
+    stack_type yystack_;
+
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
+
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
+
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
+
+    /// Constants.
+    enum
+    {
+      yylast_ = 529,     ///< Last index in yytable_.
+      yynnts_ = 93,  ///< Number of nonterminal symbols.
+      yyfinal_ = 8 ///< Termination state number.
+    };
+
+
+    // User arguments.
+    soyac::parser::ParserDriver* driver;
+
+  };
+
+
+} // yy
+#line 1126 "/root/repo/src/parser/parser.hpp"
+
+
+
+
+#endif // !YY_YY_ROOT_REPO_SRC_PARSER_PARSER_HPP_INCLUDED
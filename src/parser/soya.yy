@@ -18,6 +18,7 @@
 
 %code requires {
 #include <iostream>
+#include <list>
 #include <sstream>
 #include <stdint.h>
 
@@ -25,6 +26,13 @@
 
 using namespace soyac::ast;
 
+/*
+ * The lists built up while parsing are allocated in the parsed module's
+ * arena, just like the nodes themselves, and are never freed explicitly.
+ */
+template <class T>
+using ParserList = std::list<T, ArenaAllocator<T> >;
+
 namespace soyac {
 namespace parser
 {
@@ -40,9 +48,9 @@ class ParserDriver;
     Node* node;
 
     Name* name;
-    std::string* identifier;
-    std::stringstream* modulename;
-    std::list<std::string>* identifierlist;
+    Identifier identifier;
+    std::string* modulename;
+    ParserList<Identifier>* identifierlist;
 
     Block* block;
     DeclarationBlock* dblock;
@@ -59,14 +67,14 @@ class ParserDriver;
     UnresolvedBinaryExpression::Kind binop;
     Type* type;
 
-    std::list<DeclarationStatement*>* dstmtlist;
-    std::list<DeclaredEntity::Modifier>* modlist;
-    std::list<EnumConstant*>* econstlist;
-    std::list<Expression*>* exprlist;
-    std::list<FunctionParameter*>* paramlist;
-    std::list<Import*>* implist;
-    std::list<Statement*>* stmtlist;
-    std::list<Type*>* typelist;
+    ParserList<DeclarationStatement*>* dstmtlist;
+    ParserList<DeclaredEntity::Modifier>* modlist;
+    ParserList<EnumConstant*>* econstlist;
+    ParserList<Expression*>* exprlist;
+    ParserList<FunctionParameter*>* paramlist;
+    ParserList<Import*>* implist;
+    ParserList<Statement*>* stmtlist;
+    ParserList<Type*>* typelist;
 
     IntegerValue* intLiteral;
     FloatingPointValue* fpLiteral;
@@ -85,6 +93,13 @@ using namespace soyac::parser;
 
 std::string modifier_to_string(DeclaredEntity::Modifier mod);
 
+template <class T>
+ParserList<T>* new_list(ParserDriver* driver)
+{
+    NodeArena* arena = driver->arena();
+    return arena->create<ParserList<T> >(ArenaAllocator<T>(arena));
+}
+
 void set_location(Node* node,
                   const yy::SoyaParser::location_type& begin,
                   const yy::SoyaParser::location_type& end);
@@ -100,7 +115,6 @@ void set_location(Node* node,
 
 // Identifiers
 %token <identifier> IDENTIFIER
-%destructor { delete $$; } IDENTIFIER
 
 // Keywords
 %token ALIAS        "alias"
@@ -402,7 +416,7 @@ name
     }
     | package_module_name
     {
-        $$ = new Name($1->str());
+        $$ = new Name(*$1);
         delete $1;
     }
     | qualified_name
@@ -414,9 +428,8 @@ name
 simple_name
     : IDENTIFIER
     {
-        $$ = new Name(*$1);
+        $$ = new Name($1);
         @$ = @1;
-        delete $1;
     }
     ;
 
@@ -424,23 +437,20 @@ qualified_name
     : qualified_name_identifiers
     {
         $$ = new Name($1->begin(), $1->end());
-        delete $1;
     }
     ;
 
 qualified_name_identifiers
     : module_name "." IDENTIFIER
     {
-        $$ = new std::list<std::string>;
-        $$->push_back($1->str());
-        $$->push_back(*$3);
+        $$ = new_list<Identifier>(driver);
+        $$->push_back($1->first());
+        $$->push_back($3);
         delete $1;
-        delete $3;
     }
     | qualified_name_identifiers "." IDENTIFIER
     {
-        $1->push_back(*$3);
-        delete $3;
+        $1->push_back($3);
         $$ = $1;
     }
     ;
@@ -452,7 +462,7 @@ module_name
     }
     | package_module_name
     {
-        $$ = new Name($1->str());
+        $$ = new Name(*$1);
         delete $1;
     }
     ;
@@ -460,15 +470,12 @@ module_name
 package_module_name
     : IDENTIFIER "::" IDENTIFIER
     {
-        $$ = new std::stringstream;
-        *$$ << *$1 << "::" << *$3;
-        delete $1;
-        delete $3;
+        $$ = new std::string($1.str());
+        $$->append("::").append($3.str());
     }
     | package_module_name "::" IDENTIFIER
     {
-        *$1 << "::" << *$3;
-        delete $1;
+        $1->append("::").append($3.str());
         $$ = $1;
     }
     ;
@@ -482,7 +489,7 @@ type
     | "(" type ")"   { $$ = $2; }
     | name
     {
-        $$ = new UnknownType(*$1);
+        $$ = new (driver->arena()) UnknownType(*$1);
         set_location($$, @1, @1);
         delete $1;
     }
@@ -492,7 +499,7 @@ array_type
     : type "[" "]"
     {
         if (dynamic_cast<UnknownType*>($1) != nullptr)
-            $$ = new UnknownArrayType((UnknownType*) $1);
+            $$ = new (driver->arena()) UnknownArrayType((UnknownType*) $1);
         else
             $$ = ArrayType::get($1);
 
@@ -503,21 +510,20 @@ array_type
 function_type
     : "function" "(" parameter_types_opt ")" function_type_return_type_opt
     {
-        $$ = new UnknownFunctionType($5, $3->begin(), $3->end());
+        $$ = new (driver->arena()) UnknownFunctionType($5, $3->begin(), $3->end());
         set_location($$, @1, @5);
-        delete $3;
     }
     ;
 
 parameter_types_opt
-    :                  { $$ = new std::list<Type*>; }
+    :                  { $$ = new_list<Type*>(driver); }
     | parameter_types  { $$ = $1; }
     ;
 
 parameter_types
     : type
     {
-        $$ = new std::list<Type*>;
+        $$ = new_list<Type*>(driver);
         $$->push_back($1);
     }
     | parameter_types "," type
@@ -585,24 +591,22 @@ module
         {
             if ($2 != nullptr)
             {
-                for (std::list<Import*>::iterator it = $2->begin();
+                for (ParserList<Import*>::iterator it = $2->begin();
                      it != $2->end(); it++)
                 {
                     m->addImport(*it);
                 }
 
-                delete $2;
             }
 
             if ($3 != nullptr)
             {
-                for (std::list<Statement*>::iterator it = $3->begin();
+                for (ParserList<Statement*>::iterator it = $3->begin();
                      it != $3->end(); it++)
                 {
                     m->body()->addStatement(*it);
                 }
 
-                delete $3;
             }
 
             driver->setSyntaxTree(m);
@@ -625,7 +629,7 @@ import_statements_opt
 import_statements
     : import_statement
     {
-        $$ = new std::list<Import*>;
+        $$ = new_list<Import*>(driver);
         $$->push_back($1);
     }
     | import_statements import_statement
@@ -639,9 +643,9 @@ import_statement
     : static_opt "import" name ";"
     {
         if ($3->isSimple())
-            $$ = new UnresolvedModuleImport(*$3, $1);
+            $$ = new (driver->arena()) UnresolvedModuleImport(*$3, $1);
         else
-            $$ = new UnresolvedEntityImport(*$3);
+            $$ = new (driver->arena()) UnresolvedEntityImport(*$3);
 
         set_location($$, @1, @4);
         delete $3;
@@ -670,12 +674,9 @@ block
     : "{" statements_opt "}"
     {
         if ($2 != nullptr)
-        {
-            $$ = new Block($2->begin(), $2->end());
-            delete $2;
-        }
+            $$ = new (driver->arena()) Block($2->begin(), $2->end());
         else
-            $$ = new Block;
+            $$ = new (driver->arena()) Block;
 
         set_location($$, @1, @3);
     }
@@ -689,7 +690,7 @@ statements_opt
 statements
     : statement
     {
-        $$ = new std::list<Statement*>;
+        $$ = new_list<Statement*>(driver);
         $$->push_back($1);
     }
     | statements statement
@@ -702,12 +703,12 @@ statements
 declaration_statement
     : modifiers_opt declaration
     {
-        $$ = new DeclarationStatement($2);
+        $$ = new (driver->arena()) DeclarationStatement($2);
         set_location($$, @1, @2);
 
         if ($1 != nullptr)
         {
-            for (std::list<DeclaredEntity::Modifier>::iterator it = $1->begin();
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = $1->begin();
                  it != $1->end(); it++)
             {
                 if ($2->addModifier(*it) == false)
@@ -721,7 +722,6 @@ declaration_statement
                 }
             }
 
-            delete $1;
         }
     }
     ;
@@ -734,7 +734,7 @@ modifiers_opt
 modifiers
     : modifier
     {
-        $$ = new std::list<DeclaredEntity::Modifier>;
+        $$ = new_list<DeclaredEntity::Modifier>(driver);
         $$->push_back($1);
     }
     | modifiers modifier
@@ -753,7 +753,7 @@ modifier
 do_statement
     : "do" statement "while" "(" expression ")" ";"
     {
-        $$ = new DoStatement($5, $2);
+        $$ = new (driver->arena()) DoStatement($5, $2);
         set_location($$, @1, @6);
     }
     ;
@@ -761,7 +761,7 @@ do_statement
 expression_statement
     : expression ";"
     {
-        $$ = new ExpressionStatement($1);
+        $$ = new (driver->arena()) ExpressionStatement($1);
         set_location($$, @1, @2);
     }
     ;
@@ -769,7 +769,7 @@ expression_statement
 if_statement
     : "if" "(" expression ")" statement else_statement_opt
     {
-        $$ = new IfStatement($3, $5, $6);
+        $$ = new (driver->arena()) IfStatement($3, $5, $6);
         set_location($$, @1, @6);
     }
     ;
@@ -783,20 +783,18 @@ for_statement
     : "for" "(" for_initializer_opt for_condition_opt for_iterator_opt ")"
       statement
     {
-        $$ = new ForStatement(
+        $$ = new (driver->arena()) ForStatement(
           $4,
           $3->begin(), $3->end(),
           $5->begin(), $5->end(),
           $7);
 
         set_location($$, @1, @7);
-        delete $3;
-        delete $5;
     }
     ;
 
 for_initializer_opt
-    : ";"                                  { $$ = new std::list<Statement*>;}
+    : ";"                                  { $$ = new_list<Statement*>(driver);}
     | "var" variable_declaration_list ";"  { $$ = $2; }
     | expression_statement_list ";"        { $$ = $1; }
     ;
@@ -804,15 +802,15 @@ for_initializer_opt
 variable_declaration_list
     : variable_or_constant_declarator
     {
-        $$ = new std::list<Statement*>;
+        $$ = new_list<Statement*>(driver);
 
-        Statement* stmt = new DeclarationStatement($1);
+        Statement* stmt = new (driver->arena()) DeclarationStatement($1);
         set_location(stmt, @1, @1);
         $$->push_back(stmt);
     }
     | variable_declaration_list "," variable_or_constant_declarator
     {
-        Statement* stmt = new DeclarationStatement($3);
+        Statement* stmt = new (driver->arena()) DeclarationStatement($3);
         set_location(stmt, @2, @2);
         $$->push_back(stmt);
     }
@@ -821,15 +819,15 @@ variable_declaration_list
 expression_statement_list
     : expression
     {
-        $$ = new std::list<Statement*>;
+        $$ = new_list<Statement*>(driver);
 
-        Statement* stmt = new ExpressionStatement($1);
+        Statement* stmt = new (driver->arena()) ExpressionStatement($1);
         set_location(stmt, @1, @1);
         $$->push_back(stmt);
     }
     | expression_statement_list "," expression
     {
-        Statement* stmt = new ExpressionStatement($3);
+        Statement* stmt = new (driver->arena()) ExpressionStatement($3);
         set_location(stmt, @2, @2);
         $$->push_back(stmt);
     }
@@ -841,14 +839,14 @@ for_condition_opt
     ;
 
 for_iterator_opt
-    :                            { $$ = new std::list<Statement*>; }
+    :                            { $$ = new_list<Statement*>(driver); }
     | expression_statement_list  { $$ = $1; }
     ;
 
 return_statement
     : "return" return_value_opt ";"
     {
-        $$ = new ReturnStatement($2);
+        $$ = new (driver->arena()) ReturnStatement($2);
         set_location($$, @1, @3);
     }
     ;
@@ -861,7 +859,7 @@ return_value_opt
 while_statement
     : "while" "(" expression ")" statement
     {
-        $$ = new WhileStatement($3, $5);
+        $$ = new (driver->arena()) WhileStatement($3, $5);
         set_location($$, @1, @5);
     }
     ;
@@ -887,7 +885,7 @@ variable_declaration
 variable_or_constant_declarator
     : simple_name variable_type_opt initializer_opt
     {
-        $$ = new Variable(*$1, $2, $3);
+        $$ = new (driver->arena()) Variable(*$1, $2, $3);
         set_location($$, @1, @3);
         delete $1;
     }
@@ -907,23 +905,22 @@ function_declaration
     : "function" simple_name "(" function_parameters_opt ")" return_type_opt
       function_body_opt
     {
-        $$ = new Function(*$2, $6, $4->begin(), $4->end(), $7);
+        $$ = new (driver->arena()) Function(*$2, $6, $4->begin(), $4->end(), $7);
         set_location($$, @1, @7);
 
         delete $2;
-        delete $4;
     }
     ;
 
 function_parameters_opt
     : function_parameters  { $$ = $1; }
-    |                      { $$ = new std::list<FunctionParameter*>; }
+    |                      { $$ = new_list<FunctionParameter*>(driver); }
     ;
 
 function_parameters
     : function_parameter
     {
-        $$ = new std::list<FunctionParameter*>;
+        $$ = new_list<FunctionParameter*>(driver);
         $$->push_back($1);
     }
     | function_parameters "," function_parameter
@@ -936,7 +933,7 @@ function_parameters
 function_parameter
     : simple_name ":" type
     {
-        $$ = new FunctionParameter(*$1, $3);
+        $$ = new (driver->arena()) FunctionParameter(*$1, $3);
         set_location($$, @1, @3);
         delete $1;
     }
@@ -955,7 +952,7 @@ function_body_opt
 struct_declaration
     : "struct" simple_name declaration_block
     {
-        $$ = new StructType(*$2, $3);
+        $$ = new (driver->arena()) StructType(*$2, $3);
         set_location($$, @1, @3);
         delete $2;
     }
@@ -965,12 +962,9 @@ declaration_block
     : "{" declaration_block_statements_opt "}"
     {
         if ($2 != nullptr)
-        {
-            $$ = new DeclarationBlock($2->begin(), $2->end());
-            delete $2;
-        }
+            $$ = new (driver->arena()) DeclarationBlock($2->begin(), $2->end());
         else
-            $$ = new DeclarationBlock;
+            $$ = new (driver->arena()) DeclarationBlock;
 
         set_location($$, @1, @3);
     }
@@ -984,7 +978,7 @@ declaration_block_statements_opt
 declaration_block_statements
     : declaration_block_statement
     {
-        $$ = new std::list<DeclarationStatement*>;
+        $$ = new_list<DeclarationStatement*>(driver);
         $$->push_back($1);
     }
     | declaration_block_statements declaration_block_statement
@@ -1004,19 +998,18 @@ declaration_block_statement
      */
     | modifiers_opt constructor_declaration
     {
-        $$ = new DeclarationStatement($2);
+        $$ = new (driver->arena()) DeclarationStatement($2);
         set_location($$, @1, @2);
 
         if ($1 != nullptr)
         {
-            for (std::list<DeclaredEntity::Modifier>::iterator it = $1->begin();
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = $1->begin();
                 it != $1->end();
                 it++)
             {
                 $2->addModifier(*it);
             }
 
-            delete $1;
         }
     }
     /*
@@ -1024,19 +1017,18 @@ declaration_block_statement
      */
     | modifiers_opt property_declaration
     {
-        $$ = new DeclarationStatement($2);
+        $$ = new (driver->arena()) DeclarationStatement($2);
         set_location($$, @1, @2);
 
         if ($1 != nullptr)
         {
-            for (std::list<DeclaredEntity::Modifier>::iterator it = $1->begin();
+            for (ParserList<DeclaredEntity::Modifier>::iterator it = $1->begin();
                 it != $1->end();
                 it++)
             {
                 $2->addModifier(*it);
             }
 
-            delete $1;
         }
     }
     ;
@@ -1045,44 +1037,43 @@ constructor_declaration
     : "constructor" "(" function_parameters_opt ")" constructor_initializer_opt
        constructor_body_opt
     {
-        $$ = new Constructor($5, $3->begin(), $3->end(), $6);
-        delete $3;
+        $$ = new (driver->arena()) Constructor($5, $3->begin(), $3->end(), $6);
     }
     ;
 
 constructor_initializer_opt
     :
     {
-        $$ = new UnresolvedDefaultConstructorInitializer;
+        $$ = new (driver->arena()) UnresolvedDefaultConstructorInitializer;
     }
     | ":" "this" "(" function_arguments_opt ")"
     {
-        $$ = new UnresolvedConstructorInitializer($4->begin(), $4->end());
+        $$ = new (driver->arena()) UnresolvedConstructorInitializer(
+          $4->begin(), $4->end());
         set_location($$, @1, @5);
-        delete $4;
     }
     | ":" "super" "(" function_arguments_opt ")"
     {
-        $$ = new UnresolvedBaseConstructorInitializer($4->begin(), $4->end());
+        $$ = new (driver->arena()) UnresolvedBaseConstructorInitializer(
+          $4->begin(), $4->end());
         set_location($$, @1, @5);
-        delete $4;
     }
     ;
 
 constructor_body_opt
-    : ";"    { $$ = new Block; }
+    : ";"    { $$ = new (driver->arena()) Block; }
     | block  { $$ = $1; }
     ;
 
 property_declaration
     : "property" name ":" type "{" property_accessors "}"
     {
-        $$ = new Property(*$2, $4,
+        $$ = new (driver->arena()) Property(*$2, $4,
                           (PropertyGetAccessor*) $6[0],
                           (PropertySetAccessor*) $6[1]);
         set_location($$, @1, @7);
         delete $2;
-        delete $6;
+        delete[] $6;
     }
     ;
 
@@ -1109,7 +1100,7 @@ get_accessor_opt
 get_accessor
     : "get" function_body_opt
     {
-        $$ = new PropertyGetAccessor($2);
+        $$ = new (driver->arena()) PropertyGetAccessor($2);
         set_location($$, @1, @2);
     }
     ;
@@ -1122,7 +1113,7 @@ set_accessor_opt
 set_accessor
     : "set" function_body_opt
     {
-        $$ = new PropertySetAccessor($2);
+        $$ = new (driver->arena()) PropertySetAccessor($2);
         set_location($$, @1, @2);
     }
     ;
@@ -1130,7 +1121,7 @@ set_accessor
 class_declaration
     : "class" simple_name extends_clause_opt declaration_block
     {
-        $$ = new ClassType(*$2, $3, $4);
+        $$ = new (driver->arena()) ClassType(*$2, $3, $4);
         set_location($$, @1, @3);
         delete $2;
     }
@@ -1139,12 +1130,12 @@ class_declaration
 extends_clause_opt
     :
     {
-        $$ = new UnknownType(Name("__core__") + Name("Object"));
+        $$ = new (driver->arena()) UnknownType(Name("__core__") + Name("Object"));
         set_location($$, @$, @$);
     }
     | "extends" name
     {
-        $$ = new UnknownType(*$2);
+        $$ = new (driver->arena()) UnknownType(*$2);
         set_location($$, @1, @2);
         delete $2;
     }
@@ -1153,10 +1144,10 @@ extends_clause_opt
 enum_declaration
     : "enum" simple_name underlying_type_opt "{" enum_constants "}"
     {
-        $$ = new EnumType(*$2, (IntegerType*) $3, $5->begin(), $5->end());
+        $$ = new (driver->arena()) EnumType(
+          *$2, (IntegerType*) $3, $5->begin(), $5->end());
         set_location($$, @1, @6);
         delete $2;
-        delete $5;
     }
     ;
 
@@ -1174,16 +1165,16 @@ enum_constants
 
         if ($2 != nullptr)
         {
-            c = new EnumConstant(*$1, *$2);
+            c = new (driver->arena()) EnumConstant(*$1, *$2);
             delete $2;
         }
         else
-            c = new EnumConstant(*$1, IntegerValue(0, false));
+            c = new (driver->arena()) EnumConstant(*$1, IntegerValue(0, false));
 
         set_location(c, @1, @2);
         delete $1;
 
-        $$ = new std::list<EnumConstant*>;
+        $$ = new_list<EnumConstant*>(driver);
         $$->push_back(c);
     }
     | enum_constants "," simple_name enum_value_opt
@@ -1192,13 +1183,13 @@ enum_constants
 
         if ($4 != nullptr)
         {
-            c = new EnumConstant(*$3, *$4);
+            c = new (driver->arena()) EnumConstant(*$3, *$4);
             delete $4;
         }
         else
         {
             const IntegerValue& lastVal = $1->back()->value();
-            c = new EnumConstant(
+            c = new (driver->arena()) EnumConstant(
               *$3, IntegerValue(lastVal.data() + 1, lastVal.isSigned()));
         }
 
@@ -1231,12 +1222,12 @@ assignment_expression
     }
     | logical_or_expression "=" assignment_expression
     {
-        $$ = new AssignmentExpression($1, $3);
+        $$ = new (driver->arena()) AssignmentExpression($1, $3);
         set_location($$, @1, @3);
     }
     | logical_or_expression compound_assignment_operator assignment_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1258,7 +1249,7 @@ logical_or_expression
     }
     | logical_or_expression "||" logical_and_expression
     {
-        $$ = new LogicalExpression(LogicalExpression::OR, $1, $3);
+        $$ = new (driver->arena()) LogicalExpression(LogicalExpression::OR, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1270,7 +1261,7 @@ logical_and_expression
     }
     | logical_and_expression "&&" equality_expression
     {
-        $$ = new LogicalExpression(LogicalExpression::AND, $1, $3);
+        $$ = new (driver->arena()) LogicalExpression(LogicalExpression::AND, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1282,7 +1273,7 @@ equality_expression
     }
     | relational_expression equality_operator equality_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1299,7 +1290,7 @@ relational_expression
     }
     | cast_expression relational_operator bit_shift_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1318,7 +1309,7 @@ cast_expression
     }
     | bit_shift_expression "as" type
     {
-        $$ = new CastExpression($1, $3);
+        $$ = new (driver->arena()) CastExpression($1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1330,7 +1321,7 @@ bit_shift_expression
     }
     | bit_shift_expression bit_shift_operator additive_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1347,7 +1338,7 @@ additive_expression
     }
     | additive_expression additive_operator multiplicative_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1364,7 +1355,7 @@ multiplicative_expression
     }
     | multiplicative_expression multiplicative_operator unary_expression
     {
-        $$ = new UnresolvedBinaryExpression($2, $1, $3);
+        $$ = new (driver->arena()) UnresolvedBinaryExpression($2, $1, $3);
         set_location($$, @1, @3);
     }
     ;
@@ -1382,7 +1373,7 @@ unary_expression
     }
     | "!" unary_expression
     {
-        $$ = new LogicalNotExpression($2);
+        $$ = new (driver->arena()) LogicalNotExpression($2);
         set_location($$, @1, @2);
     }
     ;
@@ -1390,68 +1381,67 @@ unary_expression
 primary_expression
     : simple_name
     {
-        $$ = new UnresolvedSimpleNameExpression(*$1);
+        $$ = new (driver->arena()) UnresolvedSimpleNameExpression(*$1);
         set_location($$, @1, @1);
         delete $1;
     }
     | "true"
     {
-        $$ = new BooleanLiteral(true);
+        $$ = new (driver->arena()) BooleanLiteral(true);
         set_location($$, @1, @1);
     }
     | "false"
     {
-        $$ = new BooleanLiteral(false);
+        $$ = new (driver->arena()) BooleanLiteral(false);
         set_location($$, @1, @1);
     }
     | "this"
     {
-        $$ = new UnresolvedThisExpression;
+        $$ = new (driver->arena()) UnresolvedThisExpression;
         set_location($$, @1, @1);
     }
     | INT_LITERAL
     {
-        $$ = new IntegerLiteral(*$1);
+        $$ = new (driver->arena()) IntegerLiteral(*$1);
         set_location($$, @1, @1);
         delete $1;
     }
     | FP_LITERAL
     {
-        $$ = new FloatingPointLiteral(*$1);
+        $$ = new (driver->arena()) FloatingPointLiteral(*$1);
         set_location($$, @1, @1);
         delete $1;
     }
     | CHAR_LITERAL
     {
-        $$ = new CharacterLiteral($1);
+        $$ = new (driver->arena()) CharacterLiteral($1);
         set_location($$, @1, @1);
     }
     | primary_expression "." simple_name
     {
-        $$ = new UnresolvedMemberAccessExpression($1, *$3);
+        $$ = new (driver->arena()) UnresolvedMemberAccessExpression($1, *$3);
         set_location($$, @1, @3);
         delete $3;
     }
     | package_module_name "." simple_name
     {
-        Name n($1->str());
+        Name n(*$1);
         delete $1;
 
-        Expression* instance = new UnresolvedSimpleNameExpression(n);
+        Expression* instance = new (driver->arena()) UnresolvedSimpleNameExpression(n);
 
-        $$ = new UnresolvedMemberAccessExpression(instance, *$3);
+        $$ = new (driver->arena()) UnresolvedMemberAccessExpression(instance, *$3);
         set_location($$, @1, @3);
         delete $3;
     }
     | primary_expression "(" function_arguments_opt ")"
     {
-        $$ = new CallExpression($1, $3->begin(), $3->end());
+        $$ = new (driver->arena()) CallExpression($1, $3->begin(), $3->end());
         set_location($$, @1, @4);
-        delete $3;
     }
     | primary_expression "[" expression "]"
     {
-        $$ = new UnresolvedElementAccessExpression($1, $3);
+        $$ = new (driver->arena()) UnresolvedElementAccessExpression($1, $3);
         set_location($$, @1, @4);
     }
     | "new" type "(" function_arguments_opt ")"
@@ -1459,30 +1449,29 @@ primary_expression
         if (dynamic_cast<ArrayType*>($2) != nullptr ||
             dynamic_cast<UnknownArrayType*>($2) != nullptr)
         {
-            $$ = new ArrayCreationExpression($2, nullptr, $4->begin(), $4->end());
+            $$ = new (driver->arena()) ArrayCreationExpression(
+              $2, nullptr, $4->begin(), $4->end());
         }
         else
         {
-            $$ = new UnresolvedObjectCreationExpression((UnknownType*) $2,
-                                                        $4->begin(),
-                                                        $4->end());
+            $$ = new (driver->arena()) UnresolvedObjectCreationExpression(
+              (UnknownType*) $2, $4->begin(), $4->end());
         }
 
         set_location($$, @1, @5);
-        delete $4;
     }
     | "new" type "[" expression "]" array_elements_opt
     {
         Type* t;
 
         if (dynamic_cast<UnknownType*>($2) != nullptr)
-            t = new UnknownArrayType((UnknownType*) $2);
+            t = new (driver->arena()) UnknownArrayType((UnknownType*) $2);
         else
             t = ArrayType::get($2);
 
-        $$ = new ArrayCreationExpression(t, $4, $6->begin(), $6->end());
+        $$ = new (driver->arena()) ArrayCreationExpression(
+          t, $4, $6->begin(), $6->end());
         set_location($$, @1, @6);
-        delete $6;
     }
     | "(" expression ")"
     {
@@ -1493,13 +1482,13 @@ primary_expression
 
 function_arguments_opt
     : function_arguments  { $$ = $1; }
-    |                     { $$ = new std::list<Expression*>; }
+    |                     { $$ = new_list<Expression*>(driver); }
     ;
 
 function_arguments
     : expression
     {
-        $$ = new std::list<Expression*>;
+        $$ = new_list<Expression*>(driver);
         $$->push_back($1);
     }
     | function_arguments "," expression
@@ -1510,7 +1499,7 @@ function_arguments
     ;
 
 array_elements_opt
-    :                             { $$ = new std::list<Expression*>; }
+    :                             { $$ = new_list<Expression*>(driver); }
     | "(" function_arguments ")"  { $$ = $2; }
     ;
 
@@ -7,10 +7,16 @@
  */
 
 #include <cppunit/ui/text/TestRunner.h>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
 #include <string>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
 
 #include "unittest/analysis/SymbolTableTest.h"
 #include "unittest/ast/ArrayCreationExpressionTest.h"
@@ -49,6 +55,7 @@
 #include "unittest/ast/FunctionParameterTest.h"
 #include "unittest/ast/FunctionTest.h"
 #include "unittest/ast/FunctionTypeTest.h"
+#include "unittest/ast/IdentifierTest.h"
 #include "unittest/ast/IfStatementTest.h"
 #include "unittest/ast/InstanceFunctionExpressionTest.h"
 #include "unittest/ast/InstanceVariableExpressionTest.h"
@@ -64,6 +71,7 @@
 #include "unittest/ast/ModuleTest.h"
 #include "unittest/ast/NameTest.h"
 #include "unittest/ast/NamedEntityTest.h"
+#include "unittest/ast/NodeArenaTest.h"
 #include "unittest/ast/NodeListTest.h"
 #include "unittest/ast/NodeTest.h"
 #include "unittest/ast/ObjectCreationExpressionTest.h"
@@ -98,7 +106,14 @@
 #include "unittest/ast/VariableTest.h"
 #include "unittest/ast/VoidTypeTest.h"
 #include "unittest/ast/WhileStatementTest.h"
+#include "unittest/codegen/BackendTest.h"
+#include "unittest/common/PhaseTimerTest.h"
 #include "unittest/common/ProblemTest.h"
+#include "unittest/driver/CompilationCacheTest.h"
+#include "unittest/interface/InterfaceReaderTest.h"
+#include "unittest/parser/LexerTest.h"
+#include "unittest/parser/ParserDriverTest.h"
+#include "unittest/parser/SourceFileTest.h"
 
 namespace fs = std::filesystem;
 
@@ -110,6 +125,7 @@ unitTest()
     runner.addTest(ArrayCreationExpressionTest::suite());
     runner.addTest(ArrayTypeTest::suite());
     runner.addTest(AssignmentExpressionTest::suite());
+    runner.addTest(BackendTest::suite());
     runner.addTest(BlockTest::suite());
     runner.addTest(BooleanLiteralTest::suite());
     runner.addTest(BooleanTypeTest::suite());
@@ -120,6 +136,7 @@ unitTest()
     runner.addTest(CharacterTypeTest::suite());
     runner.addTest(ClassTypeTest::suite());
     runner.addTest(CombinedRelationalExpressionTest::suite());
+    runner.addTest(CompilationCacheTest::suite());
     runner.addTest(CompoundAssignmentExpressionTest::suite());
     runner.addTest(ConstructorTest::suite());
     runner.addTest(ConstructorInitializerTest::suite());
@@ -143,12 +160,15 @@ unitTest()
     runner.addTest(FunctionParameterTest::suite());
     runner.addTest(FunctionTest::suite());
     runner.addTest(FunctionTypeTest::suite());
+    runner.addTest(IdentifierTest::suite());
     runner.addTest(IfStatementTest::suite());
     runner.addTest(InstanceFunctionExpressionTest::suite());
     runner.addTest(InstanceVariableExpressionTest::suite());
     runner.addTest(IntegerLiteralTest::suite());
     runner.addTest(IntegerTypeTest::suite());
     runner.addTest(IntegerValueTest::suite());
+    runner.addTest(InterfaceReaderTest::suite());
+    runner.addTest(LexerTest::suite());
     runner.addTest(LinkTest::suite());
     runner.addTest(LocationTest::suite());
     runner.addTest(LogicalExpressionTest::suite());
@@ -158,14 +178,18 @@ unitTest()
     runner.addTest(ModuleTest::suite());
     runner.addTest(NamedEntityTest::suite());
     runner.addTest(NameTest::suite());
+    runner.addTest(NodeArenaTest::suite());
     runner.addTest(NodeListTest::suite());
     runner.addTest(NodeTest::suite());
     runner.addTest(ObjectCreationExpressionTest::suite());
+    runner.addTest(PhaseTimerTest::suite());
     runner.addTest(ProblemTest::suite());
     runner.addTest(PropertyGetAccessorTest::suite());
     runner.addTest(PropertySetAccessorTest::suite());
     runner.addTest(PropertyTest::suite());
     runner.addTest(ReturnStatementTest::suite());
+    runner.addTest(ParserDriverTest::suite());
+    runner.addTest(SourceFileTest::suite());
     runner.addTest(StatementWithBodyTest::suite());
     runner.addTest(StructTypeTest::suite());
     runner.addTest(SymbolTableTest::suite());
@@ -198,6 +222,38 @@ unitTest()
     runner.run();
 }
 
+/**
+ * The result of running a compiled torture test program.
+ */
+struct TortureResult
+{
+    int exitStatus;
+    std::string output;
+};
+
+/**
+ * Runs the passed shell command and returns its exit status and standard
+ * output.
+ */
+TortureResult
+runCapturingOutput(const std::string& command)
+{
+    TortureResult result{-1, ""};
+    FILE* pipe = popen(command.c_str(), "r");
+
+    if (pipe == nullptr)
+        return result;
+
+    char buffer[4096];
+    size_t n;
+
+    while ((n = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+        result.output.append(buffer, n);
+
+    result.exitStatus = pclose(pipe);
+    return result;
+}
+
 void
 tortureTest()
 {
@@ -237,11 +293,182 @@ tortureTest()
     std::cout << "=== All tests passed successfully. === " << std::endl;
 }
 
+/**
+ * Compiles and runs every torture test at each optimization level (-O0 to
+ * -O3). A test fails if it does not compile or exits with an error at any
+ * level, or if its exit status or output at an optimization level differs
+ * from that at -O0.
+ */
+void
+tortureTestAllLevels()
+{
+    std::cout << "Torture Test (All Optimization Levels)" << std::endl
+              << "======================================" << std::endl;
+
+    for (auto& entry : fs::recursive_directory_iterator("torture"))
+    {
+        if (!entry.is_regular_file() || entry.path().extension() != ".soya")
+            continue;
+
+        /*
+         * The modules in "samples" directories are imported by other tests
+         * and cannot be linked into programs of their own.
+         */
+        if (entry.path().parent_path().filename() == "samples")
+            continue;
+
+        auto pathString = entry.path().string();
+        TortureResult unoptimized{0, ""};
+
+        for (int level = 0; level <= 3; level++)
+        {
+            std::cout << "Processing: " << pathString << " at -O" << level
+                      << "...\n";
+
+            std::string binary = "./torture-O" + std::to_string(level) + ".out";
+            std::string compileCommand
+                = "../src/soyac -I ../runtime -L ../runtime -s torture/basic/modules -O"
+                + std::to_string(level) + " -o " + binary + " " + pathString;
+            auto returnCode = std::system(compileCommand.c_str());
+
+            if (returnCode != 0)
+            {
+                std::cout << ">>> ERROR: soyac exited with error code "
+                          << returnCode << " at -O" << level << "! <<<"
+                          << std::endl;
+
+                std::exit(1);
+            }
+
+            TortureResult result = runCapturingOutput(binary);
+            fs::remove(binary);
+
+            if (result.exitStatus != 0)
+            {
+                std::cout << "*** ERROR: test exited with error code "
+                          << result.exitStatus << " at -O" << level
+                          << "! ***" << std::endl;
+
+                std::exit(1);
+            }
+
+            if (level == 0)
+                unoptimized = result;
+            else if (result.output != unoptimized.output)
+            {
+                std::cout << "*** ERROR: output at -O" << level
+                          << " differs from output at -O0! ***" << std::endl;
+
+                std::exit(1);
+            }
+        }
+    }
+
+    std::cout << "=== All tests passed successfully at all levels. === "
+              << std::endl;
+}
+
+/**
+ * Starts a compile server on a temporary socket, lets it compile a torture
+ * test through "--connect" and checks the exit status and the program
+ * produced. The request leaves out the interface path of the "__core__"
+ * module, which the server has loaded before, so it can only succeed if
+ * the server compiled it.
+ */
+void
+serverTest()
+{
+    std::cout << "Server Test" << std::endl << "===========" << std::endl;
+
+    std::string prefix = "soyac-server-test-" + std::to_string(getpid());
+    fs::path socketPath = fs::temp_directory_path() / (prefix + ".sock");
+    fs::path binary = fs::temp_directory_path() / (prefix + ".out");
+
+    pid_t server = fork();
+
+    if (server == 0)
+    {
+        execl("../src/soyac", "../src/soyac", "-I", "../runtime", "--server",
+              socketPath.c_str(), (char*) nullptr);
+        _exit(127);
+    }
+
+    auto fail = [&](const std::string& message)
+    {
+        std::cout << ">>> ERROR: " << message << "! <<<" << std::endl;
+
+        if (server > 0)
+        {
+            kill(server, SIGTERM);
+            waitpid(server, nullptr, 0);
+        }
+
+        fs::remove(socketPath);
+        fs::remove(binary);
+        std::exit(1);
+    };
+
+    if (server < 0)
+        fail("cannot start the compile server");
+
+    for (int i = 0; i < 100 && !fs::exists(socketPath); i++)
+    {
+        if (waitpid(server, nullptr, WNOHANG) != 0)
+        {
+            server = 0;
+            fail("the compile server exited");
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    if (!fs::exists(socketPath))
+        fail("the compile server did not create its socket");
+
+    std::cout << "Processing: torture/basic/statements/for.soya...\n";
+
+    std::string compileCommand = "../src/soyac --connect " + socketPath.string()
+        + " -L ../runtime -o " + binary.string()
+        + " torture/basic/statements/for.soya";
+    auto returnCode = std::system(compileCommand.c_str());
+
+    if (returnCode != 0)
+        fail("soyac --connect exited with error code "
+             + std::to_string(returnCode));
+
+    if (!fs::exists(binary))
+        fail("soyac --connect did not write " + binary.string());
+
+    TortureResult result = runCapturingOutput(binary.string());
+
+    if (result.exitStatus != 0)
+        fail("test exited with error code "
+             + std::to_string(result.exitStatus));
+
+    kill(server, SIGTERM);
+    waitpid(server, nullptr, 0);
+    fs::remove(socketPath);
+    fs::remove(binary);
+
+    std::cout << "=== Server test passed successfully. === " << std::endl;
+}
+
 
 int
 main(int argc, char** argv)
 {
+    /*
+     * With --all-levels, only run the torture test, once at every
+     * optimization level.
+     */
+    if (argc > 1 && std::string(argv[1]) == "--all-levels")
+    {
+        tortureTestAllLevels();
+        return 0;
+    }
+
     unitTest();
     tortureTest();
+    serverTest();
     return 0;
 }
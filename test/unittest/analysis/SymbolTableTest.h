@@ -12,6 +12,8 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <sstream>
+#include <vector>
 #include <analysis/SymbolTable.h>
 #include "../ast/DummyDeclaredEntity.h"
 #include "../ast/DummyStatement.h"
@@ -27,6 +29,8 @@ class SymbolTableTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testLeaveScope);
     CPPUNIT_TEST (testLookupInEntity);
     CPPUNIT_TEST (testLookupInEntityExcludesEnclosing);
+    CPPUNIT_TEST (testManyMembers);
+    CPPUNIT_TEST (testRemove);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -113,6 +117,50 @@ public:
         CPPUNIT_ASSERT (mTable->lookup("bar", scope) == nullptr);
     }
 
+    void testManyMembers()
+    {
+        std::vector<DeclaredEntity*> entities;
+
+        for (int i = 0; i < 1000; i++) {
+            std::stringstream name;
+            name << "member" << i;
+            entities.push_back(new DummyDeclaredEntity(name.str()));
+            CPPUNIT_ASSERT (mTable->add(entities.back()));
+        }
+
+        for (int i = 0; i < 1000; i++) {
+            CPPUNIT_ASSERT (mTable->lookup(entities[i]->name()) == entities[i]);
+        }
+
+        CPPUNIT_ASSERT (mTable->lookup("member1000") == nullptr);
+    }
+
+    void testRemove()
+    {
+        std::vector<DeclaredEntity*> entities;
+
+        for (int i = 0; i < 100; i++) {
+            std::stringstream name;
+            name << "member" << i;
+            entities.push_back(new DummyDeclaredEntity(name.str()));
+            entities.back()->ref();
+            mTable->add(entities.back());
+        }
+
+        for (int i = 0; i < 100; i += 2) {
+            mTable->remove(entities[i]);
+        }
+
+        for (int i = 0; i < 100; i++) {
+            NamedEntity* expected = (i % 2 == 0) ? nullptr : entities[i];
+            CPPUNIT_ASSERT (mTable->lookup(entities[i]->name()) == expected);
+        }
+
+        for (int i = 0; i < 100; i++) {
+            entities[i]->unref();
+        }
+    }
+
 private:
     SymbolTable* mTable;
 };
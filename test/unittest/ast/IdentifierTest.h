@@ -0,0 +1,105 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_IDENTIFIER_TEST_H_
+#define SOYA_IDENTIFIER_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <ast/Identifier.h>
+
+using namespace soyac::ast;
+
+class IdentifierTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (IdentifierTest);
+    CPPUNIT_TEST (testInterning);
+    CPPUNIT_TEST (testStr);
+    CPPUNIT_TEST (testEmpty);
+    CPPUNIT_TEST (testStreamOperator);
+    CPPUNIT_TEST (testConcurrentInterning);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void testInterning()
+    {
+        std::string foo = "foo";
+        Identifier id1(foo);
+        Identifier id2("foo");
+        Identifier id3("bar");
+
+        CPPUNIT_ASSERT (id1 == id2);
+        CPPUNIT_ASSERT (id1.id() == id2.id());
+        CPPUNIT_ASSERT (id1 != id3);
+        CPPUNIT_ASSERT (std::hash<Identifier>()(id1)
+                        == std::hash<Identifier>()(id2));
+    }
+
+    void testStr()
+    {
+        Identifier id("foo");
+        CPPUNIT_ASSERT (id.str() == "foo");
+        CPPUNIT_ASSERT (id == "foo");
+        CPPUNIT_ASSERT (id != "bar");
+        CPPUNIT_ASSERT (&id.str() == &Identifier("foo").str());
+    }
+
+    void testEmpty()
+    {
+        CPPUNIT_ASSERT (Identifier{}.empty());
+        CPPUNIT_ASSERT (Identifier{} == Identifier(""));
+        CPPUNIT_ASSERT (Identifier{}.str() == "");
+        CPPUNIT_ASSERT (!Identifier("foo").empty());
+    }
+
+    void testStreamOperator()
+    {
+        std::stringstream s;
+        s << Identifier("foo");
+        CPPUNIT_ASSERT (s.str() == "foo");
+    }
+
+    void testConcurrentInterning()
+    {
+        const int numThreads = 4;
+        const int numIdentifiers = 10000;
+        std::vector<std::vector<Identifier> > results(numThreads);
+        std::vector<std::thread> threads;
+
+        for (int t = 0; t < numThreads; t++) {
+            threads.push_back(std::thread([&results, t] {
+                for (int i = 0; i < numIdentifiers; i++) {
+                    std::stringstream s;
+                    s << "__concurrent" << i;
+                    results[t].push_back(Identifier(s.str()));
+                }
+            }));
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        for (int i = 0; i < numIdentifiers; i++) {
+            std::stringstream s;
+            s << "__concurrent" << i;
+
+            for (int t = 0; t < numThreads; t++) {
+                CPPUNIT_ASSERT (results[t][i] == results[0][i]);
+                CPPUNIT_ASSERT (results[t][i].str() == s.str());
+            }
+        }
+    }
+};
+
+#endif
@@ -28,6 +28,7 @@ class NameTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testStr);
     CPPUNIT_TEST (testEqualityOperator);
     CPPUNIT_TEST (testUnequalityOperator);
+    CPPUNIT_TEST (testHash);
     CPPUNIT_TEST (testPlusOperator);
     CPPUNIT_TEST (testStreamOperator);
     CPPUNIT_TEST_SUITE_END ();
@@ -105,6 +106,13 @@ public:
         CPPUNIT_ASSERT (*mName != name2);
     }
 
+    void testHash()
+    {
+        Name name2 = Name("foo") + Name("bar") + Name("baz");
+        CPPUNIT_ASSERT (mName->hash() == name2.hash());
+        CPPUNIT_ASSERT (mName->hash() != Name("foo").hash());
+    }
+
     void testPlusOperator()
     {
         std::list<std::string> ids;
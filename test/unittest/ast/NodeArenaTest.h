@@ -0,0 +1,196 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_NODE_ARENA_TEST_H_
+#define SOYA_NODE_ARENA_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <list>
+#include <stdint.h>
+#include <ast/Link.h>
+#include <ast/Module.h>
+#include <ast/NodeArena.h>
+#include "DummyNode.h"
+
+using namespace soyac::ast;
+
+class NodeArenaTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (NodeArenaTest);
+    CPPUNIT_TEST (testAllocate);
+    CPPUNIT_TEST (testCreate);
+    CPPUNIT_TEST (testArenaAllocator);
+    CPPUNIT_TEST (testArenaNode);
+    CPPUNIT_TEST (testHeapNode);
+    CPPUNIT_TEST (testModuleAdoptArena);
+    CPPUNIT_TEST (testShared);
+    CPPUNIT_TEST (testSharedNestedAllocation);
+    CPPUNIT_TEST (testModuleSetShared);
+    CPPUNIT_TEST_SUITE_END ();
+
+    class DestructionCountingNode : public DummyNode
+    {
+    public:
+        DestructionCountingNode(int* count) : mCount(count) {}
+        ~DestructionCountingNode() { (*mCount)++; }
+
+    private:
+        int* mCount;
+    };
+
+    class ParentNode : public DummyNode
+    {
+    public:
+        ParentNode(Node* child) : mChild(child) {}
+
+        Node* child() const { return mChild.target(); }
+
+    private:
+        Link<Node> mChild;
+    };
+
+public:
+    void testAllocate()
+    {
+        NodeArena arena;
+        CPPUNIT_ASSERT (arena.bytesUsed() == 0);
+
+        void* p1 = arena.allocate(3, 1);
+        void* p2 = arena.allocate(8, 8);
+
+        CPPUNIT_ASSERT (p1 != nullptr);
+        CPPUNIT_ASSERT (p2 != nullptr);
+        CPPUNIT_ASSERT ((uintptr_t) p2 % 8 == 0);
+        CPPUNIT_ASSERT (arena.bytesUsed() == 11);
+        CPPUNIT_ASSERT (arena.bytesReserved() >= arena.bytesUsed());
+    }
+
+    void testCreate()
+    {
+        NodeArena arena;
+        double* d = arena.create<double>(4.5);
+
+        CPPUNIT_ASSERT (*d == 4.5);
+        CPPUNIT_ASSERT (arena.bytesUsed() == sizeof(double));
+    }
+
+    void testArenaAllocator()
+    {
+        NodeArena arena;
+        ArenaAllocator<int> allocator(&arena);
+        std::list<int, ArenaAllocator<int> > list(allocator);
+
+        for (int i = 0; i < 100; i++) {
+            list.push_back(i);
+        }
+
+        CPPUNIT_ASSERT (list.size() == 100);
+        CPPUNIT_ASSERT (list.back() == 99);
+        CPPUNIT_ASSERT (arena.bytesUsed() >= 100 * sizeof(int));
+    }
+
+    void testArenaNode()
+    {
+        NodeArena arena;
+        int destroyed = 0;
+
+        Node* node = new (&arena) DestructionCountingNode(&destroyed);
+        CPPUNIT_ASSERT (arena.bytesUsed() >= sizeof(DestructionCountingNode));
+
+        node->ref();
+        node->unref();
+        CPPUNIT_ASSERT (destroyed == 1);
+    }
+
+    void testHeapNode()
+    {
+        int destroyed = 0;
+
+        Node* node = new (nullptr) DestructionCountingNode(&destroyed);
+        delete node;
+        CPPUNIT_ASSERT (destroyed == 1);
+    }
+
+    void testModuleAdoptArena()
+    {
+        Module* m = Module::get(Name("__node_arena_test__"), true);
+        NodeArena* arena = new NodeArena;
+        arena->allocate(100, 1);
+
+        std::size_t before = m->arenaBytesUsed();
+        m->adoptArena(arena);
+        CPPUNIT_ASSERT (m->arenaBytesUsed() == before + 100);
+    }
+
+    void testShared()
+    {
+        NodeArena arena;
+        DummyNode stackNode;
+        Node* heapNode = new DummyNode;
+        Node* arenaNode = new (&arena) DummyNode;
+
+        CPPUNIT_ASSERT (arena.isShared());
+        CPPUNIT_ASSERT (stackNode.isShared());
+        CPPUNIT_ASSERT (heapNode->isShared());
+        CPPUNIT_ASSERT (arenaNode->isShared());
+
+        arena.setShared(false);
+        CPPUNIT_ASSERT (!arenaNode->isShared());
+        CPPUNIT_ASSERT (heapNode->isShared());
+
+        delete heapNode;
+        delete arenaNode;
+    }
+
+    void testSharedNestedAllocation()
+    {
+        NodeArena arena;
+        arena.setShared(false);
+
+        /*
+         * A node is allocated before its constructor's arguments are
+         * evaluated, which may allocate other nodes.
+         */
+        ParentNode* inArena = new (&arena) ParentNode(new (&arena) DummyNode);
+        ParentNode* heapChild = new (&arena) ParentNode(new DummyNode);
+        ParentNode* onHeap = new ParentNode(new (&arena) DummyNode);
+
+        CPPUNIT_ASSERT (!inArena->isShared());
+        CPPUNIT_ASSERT (!inArena->child()->isShared());
+        CPPUNIT_ASSERT (!heapChild->isShared());
+        CPPUNIT_ASSERT (heapChild->child()->isShared());
+        CPPUNIT_ASSERT (onHeap->isShared());
+        CPPUNIT_ASSERT (!onHeap->child()->isShared());
+
+        delete inArena;
+        delete heapChild;
+        delete onHeap;
+    }
+
+    void testModuleSetShared()
+    {
+        Module* m = Module::get(Name("__node_arena_shared_test__"), true);
+        NodeArena* arena = new NodeArena;
+        Node* node = new (arena) DummyNode;
+        m->adoptArena(arena);
+
+        m->setShared(false);
+        CPPUNIT_ASSERT (!arena->isShared());
+        CPPUNIT_ASSERT (!node->isShared());
+
+        m->setShared(true);
+        CPPUNIT_ASSERT (arena->isShared());
+        CPPUNIT_ASSERT (node->isShared());
+
+        delete node;
+    }
+};
+
+#endif
@@ -29,6 +29,10 @@ class NodeListTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testChangedOnReplace);
     CPPUNIT_TEST (testChangedOnPushBack);
     CPPUNIT_TEST (testChangedOnRemove);
+    CPPUNIT_TEST (testPushBackWhileIterating);
+    CPPUNIT_TEST (testReplaceWhileIterating);
+    CPPUNIT_TEST (testElementDeleted);
+    CPPUNIT_TEST (testReplaceAfterGrowing);
     CPPUNIT_TEST_SUITE_END ();
 
     void changedCallback(Node* oldNode, Node* newNode)
@@ -171,6 +175,75 @@ public:
         mList->changed().disconnect_all_slots();
     }
 
+    void testPushBackWhileIterating()
+    {
+        std::list<Node*> visited;
+
+        for (NodeList<Node>::const_iterator it = mList->begin();
+            it != mList->end(); it++) {
+            visited.push_back(*it);
+
+            if (mList->size() < 10) {
+                mList->push_back(new DummyNode);
+            }
+        }
+
+        CPPUNIT_ASSERT (visited.size() == 10);
+        CPPUNIT_ASSERT (visited.front() == mNode1);
+    }
+
+    void testReplaceWhileIterating()
+    {
+        NodeList<Node>::const_iterator it = mList->begin();
+        it++;
+
+        Node* replacement = new DummyNode;
+        (*it)->replaceWith(replacement);
+
+        CPPUNIT_ASSERT (*it == replacement);
+        it++;
+        CPPUNIT_ASSERT (*it == mNode3);
+    }
+
+    void testElementDeleted()
+    {
+        delete mNode2;
+
+        NodeList<Node>::const_iterator it = mList->begin();
+
+        CPPUNIT_ASSERT (mList->size() == 2);
+        CPPUNIT_ASSERT (*it == mNode1);
+        it++;
+        CPPUNIT_ASSERT (*it == mNode3);
+        it++;
+        CPPUNIT_ASSERT (it == mList->end());
+    }
+
+    void testReplaceAfterGrowing()
+    {
+        Node* nodes[20];
+
+        for (int i = 0; i < 20; i++) {
+            nodes[i] = new DummyNode;
+            mList->push_back(nodes[i]);
+        }
+
+        mList->remove(mNode2);
+
+        Node* replacement = new DummyNode;
+        nodes[10]->replaceWith(replacement);
+
+        NodeList<Node>::const_iterator it = mList->begin();
+
+        for (int i = 0; i < 12; i++) {
+            it++;
+        }
+
+        CPPUNIT_ASSERT (mList->size() == 22);
+        CPPUNIT_ASSERT (*it == replacement);
+        CPPUNIT_ASSERT (replacement->countUses() == 1);
+    }
+
 private:
     NodeList<Node>* mList;
     Node* mNode1;
@@ -12,7 +12,10 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <thread>
+#include <vector>
 #include <ast/Link.h>
+#include <ast/NodeList.h>
 #include "DummyNode.h"
 
 using namespace soyac::ast;
@@ -23,6 +26,11 @@ class NodeTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testLocation);
     CPPUNIT_TEST (testSetLocation);
     CPPUNIT_TEST (testReplaceWith);
+    CPPUNIT_TEST (testReplaceWithManyUses);
+    CPPUNIT_TEST (testCountUses);
+    CPPUNIT_TEST (testThreadSafe);
+    CPPUNIT_TEST (testThreadSafeLocalNodes);
+    CPPUNIT_TEST (testThreadSafeReplaceWith);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -76,6 +84,153 @@ public:
         CPPUNIT_ASSERT (other->location().endColumn() == 2);
     }
 
+    void testReplaceWithManyUses()
+    {
+        Link<Node> l1(mNode);
+        Link<Node> l2(mNode);
+        Link<Node> l3(mNode);
+
+        DummyNode other;
+        other.ref();
+        mNode->ref();
+        mNode->replaceWith(&other);
+
+        CPPUNIT_ASSERT (l1.target() == &other);
+        CPPUNIT_ASSERT (l2.target() == &other);
+        CPPUNIT_ASSERT (l3.target() == &other);
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+        CPPUNIT_ASSERT (other.countUses() == 3);
+
+        l1.setTarget(nullptr);
+        l2.setTarget(nullptr);
+        l3.setTarget(nullptr);
+    }
+
+    void testCountUses()
+    {
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+
+        mNode->ref();
+        Link<Node>* l1 = new Link<Node>(mNode);
+        Link<Node> l2(mNode);
+        CPPUNIT_ASSERT (mNode->countUses() == 2);
+
+        delete l1;
+        CPPUNIT_ASSERT (mNode->countUses() == 1);
+
+        l2.setTarget(nullptr);
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+    }
+
+    void testThreadSafe()
+    {
+        mNode->ref();
+        Node::setThreadSafe(true);
+
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 4; i++) {
+            threads.emplace_back([this]() {
+                for (int j = 0; j < 10000; j++) {
+                    Link<Node> l1(mNode);
+                    Link<Node> l2(mNode);
+                    l1.setTarget(nullptr);
+                }
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        Node::setThreadSafe(false);
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+    }
+
+    void testThreadSafeLocalNodes()
+    {
+        mNode->ref();
+        Node::setThreadSafe(true);
+
+        std::vector<std::thread> threads;
+        std::vector<std::size_t> localUses(4);
+
+        for (int i = 0; i < 4; i++) {
+            threads.emplace_back([this, &localUses, i]() {
+                NodeArena arena;
+                arena.setShared(false);
+
+                Node* local = new (&arena) DummyNode;
+                local->ref();
+
+                for (int j = 0; j < 10000; j++) {
+                    Link<Node> l1(local);
+                    Link<Node> l2(mNode);
+                    l1.setTarget(mNode);
+                    l2.setTarget(local);
+                }
+
+                localUses[i] = local->countUses();
+                local->unref();
+            });
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        Node::setThreadSafe(false);
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+
+        for (std::size_t uses : localUses) {
+            CPPUNIT_ASSERT (uses == 0);
+        }
+    }
+
+    void testThreadSafeReplaceWith()
+    {
+        mNode->ref();
+        Node::setThreadSafe(true);
+
+        /*
+         * While other threads link to and unlink from the node, replace
+         * nodes linked to only by this thread with it.
+         */
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 3; i++) {
+            threads.emplace_back([this]() {
+                for (int j = 0; j < 10000; j++) {
+                    Link<Node> l1(mNode);
+                    Link<Node> l2(mNode);
+                    l1.setTarget(nullptr);
+                }
+            });
+        }
+
+        bool retargeted = true;
+
+        for (int i = 0; i < 2000; i++) {
+            DummyNode* replaced = new DummyNode;
+            Link<Node> l1(replaced);
+            Link<Node> l2(replaced);
+            NodeList<Node> list;
+            list.push_back(replaced);
+
+            replaced->replaceWith(mNode);
+            retargeted = retargeted && l1.target() == mNode
+                && l2.target() == mNode && *list.begin() == mNode;
+        }
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        Node::setThreadSafe(false);
+        CPPUNIT_ASSERT (retargeted);
+        CPPUNIT_ASSERT (mNode->countUses() == 0);
+    }
+
 private:
     Node* mNode;
 };
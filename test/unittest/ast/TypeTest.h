@@ -12,6 +12,7 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <ast/Link.h>
 #include <ast/UnknownType.h>
 #include "DummyType.h"
 
@@ -26,6 +27,7 @@ class TypeTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testNotImplicitlyConvertable);
     CPPUNIT_TEST (testImplicitlyConvertableToUnknown);
     CPPUNIT_TEST (testSubtypeOf);
+    CPPUNIT_TEST (testReplaceKeepsLocation);
     CPPUNIT_TEST_SUITE_END ();
 
 public:
@@ -72,6 +74,21 @@ public:
         CPPUNIT_ASSERT (!mDecl->isSubtypeOf(&decl2));
     }
 
+    void testReplaceKeepsLocation()
+    {
+        mDecl->ref();
+        mDecl->setLocation(Location("sophia.soya", 1, 1, 1, 6));
+
+        UnknownType* unknown = new UnknownType(Name("Sophia"));
+        unknown->setLocation(Location("user.soya", 7, 3, 7, 8));
+        Link<Type> link(unknown);
+
+        unknown->replaceWith(mDecl);
+        CPPUNIT_ASSERT (link.target() == mDecl);
+        CPPUNIT_ASSERT (mDecl->location().fileName() == "sophia.soya");
+        CPPUNIT_ASSERT (mDecl->location().startLine() == 1);
+    }
+
 private:
     Type* mDecl;
 };
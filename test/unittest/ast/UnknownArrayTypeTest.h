@@ -25,6 +25,7 @@ class UnknownArrayTypeTest : public CppUnit::TestFixture
     CPPUNIT_TEST (testVisit);
     CPPUNIT_TEST (testElementType);
     CPPUNIT_TEST (testElementTypeReplaceable);
+    CPPUNIT_TEST (testElementTypeResolvable);
     CPPUNIT_TEST_SUITE_END ();
 
     TEST_VISITOR (UnknownArrayType);
@@ -59,6 +60,15 @@ public:
         CPPUNIT_ASSERT (mType->elementType() == &elementType2);
     }
 
+    void testElementTypeResolvable()
+    {
+        DummyType resolvedType;
+        mElementType->replaceWith(&resolvedType);
+        CPPUNIT_ASSERT (mType->elementType() == &resolvedType);
+        CPPUNIT_ASSERT (
+            dynamic_cast<UnknownType*>(mType->elementType()) == nullptr);
+    }
+
 private:
     UnknownArrayType* mType;
     UnknownType* mElementType;
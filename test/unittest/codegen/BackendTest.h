@@ -0,0 +1,83 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_BACKEND_TEST_H_
+#define SOYA_BACKEND_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <stdexcept>
+#include <string>
+#include <llvm/Support/TargetSelect.h>
+#include <codegen/Backend.h>
+
+using soyac::codegen::Backend;
+
+class BackendTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (BackendTest);
+    CPPUNIT_TEST (testValidTarget);
+    CPPUNIT_TEST (testUnknownCPU);
+    CPPUNIT_TEST (testInvalidFeatures);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void setUp()
+    {
+        llvm::InitializeNativeTarget();
+    }
+
+    void testValidTarget()
+    {
+        Backend backend;
+        backend.validateTarget();
+
+        backend.setTargetCPU("native");
+        backend.validateTarget();
+
+        backend.setTargetCPU(backend.resolvedTargetCPU());
+        backend.setTargetFeatures(backend.resolvedTargetFeatures());
+        backend.validateTarget();
+    }
+
+    void testUnknownCPU()
+    {
+        Backend backend;
+        backend.setTargetCPU("no-such-cpu");
+
+        CPPUNIT_ASSERT_THROW (backend.validateTarget(),
+                              std::invalid_argument);
+    }
+
+    void testInvalidFeatures()
+    {
+        Backend native;
+        native.setTargetCPU("native");
+
+        /*
+         * A known feature of the host, without its "+" or "-".
+         */
+        std::string feature = native.resolvedTargetFeatures();
+        feature = feature.substr(1, feature.find(',') - 1);
+
+        Backend backend;
+        backend.setTargetFeatures("+" + feature + ",-" + feature);
+        backend.validateTarget();
+
+        backend.setTargetFeatures(feature);
+        CPPUNIT_ASSERT_THROW (backend.validateTarget(),
+                              std::invalid_argument);
+
+        backend.setTargetFeatures("+" + feature + ",+no-such-feature");
+        CPPUNIT_ASSERT_THROW (backend.validateTarget(),
+                              std::invalid_argument);
+    }
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_PHASE_TIMER_TEST_H_
+#define SOYA_PHASE_TIMER_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sstream>
+#include <string>
+#include <common/PhaseTimer.h>
+
+using soyac::PhaseTimer;
+
+class PhaseTimerTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (PhaseTimerTest);
+    CPPUNIT_TEST (testDisabled);
+    CPPUNIT_TEST (testReport);
+    CPPUNIT_TEST (testTrace);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void tearDown()
+    {
+        PhaseTimer::setEnabled(false);
+        PhaseTimer::setCurrentFile("");
+    }
+
+    void testDisabled()
+    {
+        std::string before = trace();
+
+        PhaseTimer::setCurrentFile("disabled.soya");
+        {
+            PhaseTimer timer("parsing");
+        }
+
+        CPPUNIT_ASSERT (!PhaseTimer::isEnabled());
+        CPPUNIT_ASSERT (trace() == before);
+    }
+
+    void testReport()
+    {
+        PhaseTimer::setEnabled(true);
+        PhaseTimer::setCurrentFile("report.soya");
+        {
+            PhaseTimer timer("basic analysis");
+        }
+        PhaseTimer::setCurrentFile("");
+        {
+            PhaseTimer timer("linking");
+        }
+
+        std::stringstream report;
+        PhaseTimer::showReport(report);
+
+        CPPUNIT_ASSERT (report.str().find("Total") != std::string::npos);
+        CPPUNIT_ASSERT (report.str().find("report.soya")
+                        != std::string::npos);
+        CPPUNIT_ASSERT (report.str().find("basic analysis")
+                        != std::string::npos);
+        CPPUNIT_ASSERT (report.str().find("linking") != std::string::npos);
+    }
+
+    void testTrace()
+    {
+        PhaseTimer::setEnabled(true);
+        PhaseTimer::setCurrentFile("a \"quoted\" name.soya");
+        {
+            PhaseTimer timer("code generation");
+        }
+
+        std::string str = trace();
+
+        CPPUNIT_ASSERT (str.compare(0, 15, "{\"traceEvents\":") == 0);
+        CPPUNIT_ASSERT (str.find("\"name\":\"code generation\",\"cat\":"
+                                 "\"soyac\",\"ph\":\"X\"")
+                        != std::string::npos);
+        CPPUNIT_ASSERT (str.find("\"file\":\"a \\\"quoted\\\" name.soya\"")
+                        != std::string::npos);
+    }
+
+private:
+    std::string trace()
+    {
+        std::stringstream out;
+        PhaseTimer::writeTrace(out);
+        return out.str();
+    }
+};
+
+#endif
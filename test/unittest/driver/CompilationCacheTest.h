@@ -0,0 +1,333 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_COMPILATION_CACHE_TEST_H_
+#define SOYA_COMPILATION_CACHE_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <llvm/TargetParser/Host.h>
+#include <analysis/BasicAnalyzer.h>
+#include <ast/Module.h>
+#include <codegen/Backend.h>
+#include <driver/CompilationCache.h>
+#include <driver/FileProcessor.h>
+#include <driver/config.h>
+#include <parser/ParserDriver.h>
+
+using soyac::PassResult;
+using soyac::analysis::BasicAnalyzer;
+using soyac::codegen::Backend;
+using soyac::driver::CompilationCache;
+using soyac::driver::FileProcessor;
+using soyac::parser::ParserDriver;
+using namespace soyac::ast;
+namespace config = soyac::driver::config;
+
+class CompilationCacheTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (CompilationCacheTest);
+    CPPUNIT_TEST (testHash);
+    CPPUNIT_TEST (testKeyDependsOnSource);
+    CPPUNIT_TEST (testKeyDependsOnOptions);
+    CPPUNIT_TEST (testKeyResolvesNativeTarget);
+    CPPUNIT_TEST (testKeyDependsOnImports);
+    CPPUNIT_TEST (testRetrieveStore);
+    CPPUNIT_TEST (testTrim);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void setUp()
+    {
+        std::string prefix = "soyac-compilation-cache-test-"
+            + std::to_string(getpid());
+
+        mCacheDirectory = std::filesystem::temp_directory_path()
+            / (prefix + "-cache");
+        mSourcePath = std::filesystem::temp_directory_path()
+            / (prefix + ".soya");
+        mOutputPath = std::filesystem::temp_directory_path()
+            / (prefix + ".o");
+        mInterfacePath = std::filesystem::temp_directory_path()
+            / (prefix + ".soyb");
+
+        mCacheDirectorySave = config::cacheDirectory;
+        mCacheSizeLimitSave = config::cacheSizeLimit;
+        mEmitLLVMSave = config::emitLLVM;
+        mOptimizationLevelSave = config::optimizationLevel;
+        mTargetCPUSave = config::targetCPU;
+        mTargetFeaturesSave = config::targetFeatures;
+
+        config::cacheDirectory = mCacheDirectory.string();
+        config::emitLLVM = false;
+        config::optimizationLevel = 0;
+        config::targetCPU = "generic";
+        config::targetFeatures = "";
+
+        /*
+         * Every module imports the core module, so cache keys can only be
+         * computed once the core module's interface hash is known.
+         */
+        if (Module::get(Name("__core__")) == nullptr) {
+            CPPUNIT_ASSERT (analyze("module __core__;\n"
+                                    "class Object {}\n"));
+        }
+
+        CompilationCache::setInterfaceHash(
+            Module::get(Name("__core__")), CompilationCache::hash("core"));
+        CompilationCache::setInterfaceHash(
+            Module::get(Name("cache_test::imported"), true),
+            CompilationCache::hash("imported"));
+
+        mModule = Module::get(Name("cache_test"), true);
+        writeFile(mSourcePath, "module cache_test;\n"
+                               "import cache_test::imported;\n");
+    }
+
+    void tearDown()
+    {
+        std::filesystem::remove_all(mCacheDirectory);
+        std::filesystem::remove(mSourcePath);
+        std::filesystem::remove(mOutputPath);
+        std::filesystem::remove(mInterfacePath);
+
+        config::cacheDirectory = mCacheDirectorySave;
+        config::cacheSizeLimit = mCacheSizeLimitSave;
+        config::emitLLVM = mEmitLLVMSave;
+        config::optimizationLevel = mOptimizationLevelSave;
+        config::targetCPU = mTargetCPUSave;
+        config::targetFeatures = mTargetFeaturesSave;
+    }
+
+    void testHash()
+    {
+        CPPUNIT_ASSERT (CompilationCache::hash("")
+                        == "e3b0c44298fc1c149afbf4c8996fb924"
+                           "27ae41e4649b934ca495991b7852b855");
+        CPPUNIT_ASSERT (CompilationCache::fileHash(mSourcePath)
+                        == CompilationCache::hash(
+                               "module cache_test;\n"
+                               "import cache_test::imported;\n"));
+        CPPUNIT_ASSERT (CompilationCache::fileHash(mOutputPath) == "");
+    }
+
+    void testKeyDependsOnSource()
+    {
+        std::string key = cacheKey();
+        CPPUNIT_ASSERT (key != "");
+        CPPUNIT_ASSERT (cacheKey() == key);
+
+        writeFile(mSourcePath, "module cache_test;\n"
+                               "import cache_test::imported;\n"
+                               "var x : int;\n");
+        CPPUNIT_ASSERT (cacheKey() != "");
+        CPPUNIT_ASSERT (cacheKey() != key);
+
+        std::filesystem::remove(mSourcePath);
+        CPPUNIT_ASSERT (cacheKey() == "");
+    }
+
+    void testKeyDependsOnOptions()
+    {
+        std::string key = cacheKey();
+
+        config::optimizationLevel = 2;
+        std::string optimizedKey = cacheKey();
+        CPPUNIT_ASSERT (optimizedKey != key);
+        config::optimizationLevel = 0;
+
+        config::targetCPU = "x86-64-v3";
+        std::string cpuKey = cacheKey();
+        CPPUNIT_ASSERT (cpuKey != key);
+        CPPUNIT_ASSERT (cpuKey != optimizedKey);
+        config::targetCPU = "generic";
+
+        config::targetFeatures = "+avx2";
+        std::string featuresKey = cacheKey();
+        CPPUNIT_ASSERT (featuresKey != key);
+        CPPUNIT_ASSERT (featuresKey != cpuKey);
+        config::targetFeatures = "";
+
+        config::emitLLVM = true;
+        CPPUNIT_ASSERT (cacheKey() != key);
+        config::emitLLVM = false;
+
+        CPPUNIT_ASSERT (cacheKey() == key);
+    }
+
+    void testKeyResolvesNativeTarget()
+    {
+        Backend native;
+        native.setTargetCPU("native");
+
+        config::targetCPU = "native";
+        std::string nativeKey = cacheKey();
+
+        /*
+         * "native" must be keyed as the host's actual CPU and features, so
+         * that a cache shared between different machines never hands out
+         * code compiled for another host.
+         */
+        config::targetCPU = llvm::sys::getHostCPUName().str();
+        config::targetFeatures = native.resolvedTargetFeatures();
+        CPPUNIT_ASSERT (cacheKey() == nativeKey);
+
+        config::targetCPU = "generic";
+        config::targetFeatures = "";
+        CPPUNIT_ASSERT (cacheKey() != nativeKey);
+    }
+
+    void testKeyDependsOnImports()
+    {
+        Module* imported = Module::get(Name("cache_test::imported"));
+        std::string key = cacheKey();
+
+        CompilationCache::setInterfaceHash(
+            imported, CompilationCache::hash("changed"));
+        CPPUNIT_ASSERT (cacheKey() != "");
+        CPPUNIT_ASSERT (cacheKey() != key);
+
+        CompilationCache::setInterfaceHash(imported, "");
+        CPPUNIT_ASSERT (cacheKey() == "");
+
+        CompilationCache::setInterfaceHash(
+            imported, CompilationCache::hash("imported"));
+        CPPUNIT_ASSERT (cacheKey() == key);
+    }
+
+    void testRetrieveStore()
+    {
+        std::string key = CompilationCache::hash("round trip");
+
+        CPPUNIT_ASSERT (!CompilationCache::retrieve(
+            key, mOutputPath, mInterfacePath));
+
+        writeFile(mOutputPath, "object code");
+        writeFile(mInterfacePath, "interface");
+        CompilationCache::store(key, mOutputPath, mInterfacePath);
+        std::filesystem::remove(mOutputPath);
+        std::filesystem::remove(mInterfacePath);
+
+        CPPUNIT_ASSERT (CompilationCache::retrieve(
+            key, mOutputPath, mInterfacePath));
+        CPPUNIT_ASSERT (readFile(mOutputPath) == "object code");
+        CPPUNIT_ASSERT (readFile(mInterfacePath) == "interface");
+
+        /*
+         * An entry stored without an interface file cannot satisfy a
+         * request for one.
+         */
+        std::string outputOnlyKey = CompilationCache::hash("output only");
+        CompilationCache::store(outputOnlyKey, mOutputPath, "");
+        std::filesystem::remove(mInterfacePath);
+
+        CPPUNIT_ASSERT (!CompilationCache::retrieve(
+            outputOnlyKey, mOutputPath, mInterfacePath));
+        CPPUNIT_ASSERT (!std::filesystem::exists(mInterfacePath));
+        CPPUNIT_ASSERT (CompilationCache::retrieve(
+            outputOnlyKey, mOutputPath, ""));
+    }
+
+    void testTrim()
+    {
+        std::string keys[3] = { CompilationCache::hash("first"),
+            CompilationCache::hash("second"), CompilationCache::hash("third") };
+        std::filesystem::file_time_type now
+            = std::filesystem::file_time_type::clock::now();
+
+        /*
+         * Store three entries of 512 KiB each, the first one used least
+         * recently, and keep at most 1 MiB.
+         */
+        writeFile(mOutputPath, std::string(512 << 10, 'x'));
+        config::cacheSizeLimit = 1;
+
+        for (int i = 0; i < 3; i++) {
+            CompilationCache::store(keys[i], mOutputPath, "");
+            std::filesystem::last_write_time(
+                entryPath(keys[i]), now - std::chrono::hours(3 - i));
+        }
+
+        /*
+         * Retrieving the first entry makes it the most recently used one,
+         * so trimming evicts the second entry instead.
+         */
+        CPPUNIT_ASSERT (CompilationCache::retrieve(keys[0], mOutputPath, ""));
+        CompilationCache::trim();
+
+        CPPUNIT_ASSERT (std::filesystem::exists(entryPath(keys[0])));
+        CPPUNIT_ASSERT (!std::filesystem::exists(entryPath(keys[1])));
+        CPPUNIT_ASSERT (std::filesystem::exists(entryPath(keys[2])));
+
+        CompilationCache::trim();
+        CPPUNIT_ASSERT (std::filesystem::exists(entryPath(keys[0])));
+        CPPUNIT_ASSERT (std::filesystem::exists(entryPath(keys[2])));
+    }
+
+private:
+    std::filesystem::path mCacheDirectory;
+    std::filesystem::path mSourcePath;
+    std::filesystem::path mOutputPath;
+    std::filesystem::path mInterfacePath;
+    std::string mCacheDirectorySave;
+    unsigned mCacheSizeLimitSave;
+    bool mEmitLLVMSave;
+    unsigned mOptimizationLevelSave;
+    std::string mTargetCPUSave;
+    std::string mTargetFeaturesSave;
+    Module* mModule;
+
+    std::string cacheKey()
+    {
+        return FileProcessor(mSourcePath.string()).cacheKey(mModule);
+    }
+
+    std::filesystem::path entryPath(const std::string& key)
+    {
+        return mCacheDirectory / (key + ".o");
+    }
+
+    bool analyze(const std::string& source)
+    {
+        writeFile(mSourcePath, source);
+
+        PassResult* result = nullptr;
+        Module* m = ParserDriver(mSourcePath.string()).parse(result);
+
+        if (m == nullptr || (result != nullptr && result->foundErrors())) {
+            return false;
+        }
+
+        result = BasicAnalyzer().analyze(m);
+        return result == nullptr || !result->foundErrors();
+    }
+
+    static void writeFile(
+        const std::filesystem::path& file, const std::string& contents)
+    {
+        std::ofstream out(file, std::ios::binary);
+        out << contents;
+    }
+
+    static std::string readFile(const std::filesystem::path& file)
+    {
+        std::ifstream in(file, std::ios::binary);
+        std::stringstream contents;
+        contents << in.rdbuf();
+        return contents.str();
+    }
+};
+
+#endif
@@ -0,0 +1,261 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_INTERFACE_READER_TEST_H_
+#define SOYA_INTERFACE_READER_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+#include <analysis/BasicAnalyzer.h>
+#include <analysis/FunctionGroup.h>
+#include <analysis/SymbolTable.h>
+#include <ast/ast.h>
+#include <interface/InterfaceReader.h>
+#include <interface/InterfaceWriter.h>
+#include <parser/ParserDriver.h>
+
+using soyac::PassResult;
+using soyac::analysis::BasicAnalyzer;
+using soyac::analysis::FunctionGroup;
+using soyac::analysis::SymbolTable;
+using soyac::interface::InterfaceReader;
+using soyac::interface::InterfaceWriter;
+using soyac::parser::ModuleHeader;
+using soyac::parser::ParserDriver;
+using namespace soyac::ast;
+
+class InterfaceReaderTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (InterfaceReaderTest);
+    CPPUNIT_TEST (testRoundTrip);
+    CPPUNIT_TEST (testImport);
+    CPPUNIT_TEST (testInvalidFile);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void setUp()
+    {
+        std::string prefix = "soyac-interface-reader-test-"
+            + std::to_string(getpid());
+
+        mSourcePath = std::filesystem::temp_directory_path()
+            / (prefix + ".soya");
+        mInterfacePath = std::filesystem::temp_directory_path()
+            / (prefix + ".soyb");
+
+        /*
+         * Every analyzed module imports the core module.
+         */
+        if (Module::get(Name("__core__")) == nullptr) {
+            CPPUNIT_ASSERT (analyze("module __core__;\n"
+                                    "class Object {}\n"));
+        }
+    }
+
+    void tearDown()
+    {
+        std::filesystem::remove(mSourcePath);
+        std::filesystem::remove(mInterfacePath);
+    }
+
+    void testRoundTrip()
+    {
+        Module* copy = writeAndRead("__interface_reader_test_1__");
+        CPPUNIT_ASSERT (copy != nullptr);
+
+        SymbolTable* table = SymbolTable::get(copy);
+        CPPUNIT_ASSERT (table != nullptr);
+
+        ClassType* shape = dynamic_cast<ClassType*>(table->lookup("Shape"));
+        ClassType* circle = dynamic_cast<ClassType*>(table->lookup("Circle"));
+        StructType* point = dynamic_cast<StructType*>(table->lookup("Point"));
+        EnumType* color = dynamic_cast<EnumType*>(table->lookup("Color"));
+        Variable* origin = dynamic_cast<Variable*>(table->lookup("origin"));
+
+        CPPUNIT_ASSERT (shape != nullptr);
+        CPPUNIT_ASSERT (circle != nullptr);
+        CPPUNIT_ASSERT (point != nullptr);
+        CPPUNIT_ASSERT (color != nullptr);
+        CPPUNIT_ASSERT (origin != nullptr);
+
+        CPPUNIT_ASSERT (shape->parent() == copy);
+        CPPUNIT_ASSERT (shape->baseClass()->qualifiedName().str()
+                        == "__core__.Object");
+        CPPUNIT_ASSERT (circle->baseClass() == shape);
+        CPPUNIT_ASSERT (origin->type() == point);
+
+        /*
+         * Inherited and generated members are found in the class scope,
+         * public member variables only through their properties.
+         */
+        CPPUNIT_ASSERT (dynamic_cast<Property*>(
+                            table->lookup("sides", circle)) != nullptr);
+        CPPUNIT_ASSERT (dynamic_cast<Property*>(
+                            table->lookup("radius", circle)) != nullptr);
+        CPPUNIT_ASSERT (dynamic_cast<Variable*>(
+                            table->lookup("secret", shape)) != nullptr);
+        CPPUNIT_ASSERT (table->lookup("secret", circle) == nullptr);
+        CPPUNIT_ASSERT (table->lookup("area", circle) != nullptr);
+        CPPUNIT_ASSERT (table->lookup(CONSTRUCTOR_NAME, circle) != nullptr);
+
+        Variable* secret
+            = dynamic_cast<Variable*>(table->lookup("secret", shape));
+        CPPUNIT_ASSERT (secret->hasModifier(DeclaredEntity::PRIVATE));
+        CPPUNIT_ASSERT (secret->type() == TYPE_DOUBLE);
+
+        EnumConstant* green
+            = dynamic_cast<EnumConstant*>(table->lookup("GREEN", color));
+        CPPUNIT_ASSERT (green != nullptr);
+        CPPUNIT_ASSERT (green->value().data() == 1);
+
+        Function* scale = dynamic_cast<Function*>(
+            *((FunctionGroup*)table->lookup("scale"))->overloads_begin());
+        CPPUNIT_ASSERT (scale->returnType() == ArrayType::get(TYPE_LONG));
+        CPPUNIT_ASSERT (scale->qualifiedName().str()
+                        == "__interface_reader_test_1__.scale");
+
+        std::vector<FunctionParameter*> params;
+
+        for (Function::parameters_iterator it = scale->parameters_begin();
+             it != scale->parameters_end(); it++) {
+            params.push_back(*it);
+        }
+
+        CPPUNIT_ASSERT (params.size() == 2);
+        CPPUNIT_ASSERT (params[0]->name() == "values");
+        CPPUNIT_ASSERT (params[0]->type() == ArrayType::get(TYPE_LONG));
+        CPPUNIT_ASSERT (params[1]->type() == IntegerType::get(16, false));
+    }
+
+    void testImport()
+    {
+        Module* copy = writeAndRead("__interface_reader_test_2__");
+        CPPUNIT_ASSERT (copy != nullptr);
+
+        /*
+         * A module importing the read module must pass analysis as if
+         * the original module had been imported.
+         */
+        CPPUNIT_ASSERT (analyze("module __interface_reader_test_3__;\n"
+                                "import __interface_reader_test_2__;\n"
+                                "var c = new Circle(2.5);\n"
+                                "c.sides = c.sides + 1;\n"
+                                "var a : double = c.area();\n"
+                                "var p = origin;\n"
+                                "var k = Color.BLUE;\n"
+                                "var s = scale(new long[3], 2);\n"));
+    }
+
+    void testInvalidFile()
+    {
+        std::ofstream out(mInterfacePath);
+        out << "module foo;\n";
+        out.close();
+
+        InterfaceReader reader(mInterfacePath.string());
+        CPPUNIT_ASSERT (!reader.isValid());
+
+        PassResult* result = nullptr;
+        reader.read(Module::get(Name("__interface_reader_test_4__"), true),
+            result);
+
+        CPPUNIT_ASSERT (result != nullptr);
+        CPPUNIT_ASSERT (result->foundErrors());
+    }
+
+private:
+    std::filesystem::path mSourcePath;
+    std::filesystem::path mInterfacePath;
+
+    /**
+     * Parses and analyzes a module, and returns whether this succeeded
+     * without errors.
+     */
+    bool analyze(const std::string& source)
+    {
+        std::ofstream out(mSourcePath);
+        out << source;
+        out.close();
+
+        PassResult* result = nullptr;
+        Module* m = ParserDriver(mSourcePath.string()).parse(result);
+
+        if (m == nullptr || (result != nullptr && result->foundErrors())) {
+            return false;
+        }
+
+        result = BasicAnalyzer().analyze(m);
+        return result == nullptr || !result->foundErrors();
+    }
+
+    /**
+     * Compiles a test module, writes its binary interface and reads the
+     * interface into a new module with the passed name.
+     */
+    Module* writeAndRead(const std::string& copyName)
+    {
+        std::string name = copyName + "source";
+        bool analyzed = analyze(
+            "module " + name + ";\n"
+            "class Shape\n"
+            "{\n"
+            "    var sides : int;\n"
+            "    private var secret : double;\n"
+            "    function area() : double { return secret; }\n"
+            "}\n"
+            "class Circle extends Shape\n"
+            "{\n"
+            "    var radius : double;\n"
+            "    constructor(radius : double) { this.radius = radius; }\n"
+            "}\n"
+            "struct Point { var x : int; var y : int; }\n"
+            "enum Color { RED, GREEN, BLUE }\n"
+            "var origin : Point;\n"
+            "function scale(values : long[], factor : uint16) : long[]\n"
+            "{\n"
+            "    return values;\n"
+            "}\n");
+
+        if (!analyzed) {
+            return nullptr;
+        }
+
+        std::error_code error;
+        InterfaceWriter(Module::get(Name(name))).write(mInterfacePath, error);
+
+        if (error) {
+            return nullptr;
+        }
+
+        InterfaceReader reader(mInterfacePath.string());
+        ModuleHeader header = reader.scanHeader();
+
+        if (!reader.isValid() || header.moduleName != name
+            || header.importedModules.count("__core__") != 1) {
+            return nullptr;
+        }
+
+        Module* copy = Module::get(Name(copyName), true);
+        PassResult* result = nullptr;
+        reader.read(copy, result);
+
+        if (result != nullptr && result->foundErrors()) {
+            return nullptr;
+        }
+
+        return copy;
+    }
+};
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_ALLOCATION_COUNTER_H_
+#define SOYA_ALLOCATION_COUNTER_H_
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/*
+ * Counts the allocations made through the global operator new, so that
+ * tests can check that an operation does not allocate more often than
+ * expected.
+ *
+ * NOTE: This header replaces the global operator new and operator delete
+ * and must therefore only be included by a single translation unit.
+ */
+class AllocationCounter
+{
+public:
+    /**
+     * Returns the number of allocations made so far.
+     *
+     * @return  The allocation count.
+     */
+    static long count()
+    {
+        return sCount;
+    }
+
+    /**
+     * Called by operator new for every allocation.
+     */
+    static void increment()
+    {
+        sCount++;
+    }
+
+private:
+    static inline std::atomic<long> sCount{0};
+};
+
+void* operator new(std::size_t size)
+{
+    AllocationCounter::increment();
+
+    if (void* p = std::malloc(size != 0 ? size : 1)) {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif
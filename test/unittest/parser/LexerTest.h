@@ -0,0 +1,227 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_LEXER_TEST_H_
+#define SOYA_LEXER_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <parser/Lexer.h>
+#include "AllocationCounter.h"
+
+using soyac::PassResultBuilder;
+using soyac::parser::Lexer;
+
+class LexerTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (LexerTest);
+    CPPUNIT_TEST (testTokens);
+    CPPUNIT_TEST (testKeywords);
+    CPPUNIT_TEST (testIntegerTypes);
+    CPPUNIT_TEST (testIdentifiers);
+    CPPUNIT_TEST (testComments);
+    CPPUNIT_TEST (testLineTerminators);
+    CPPUNIT_TEST (testBlankRuns);
+    CPPUNIT_TEST (testManyBlankLines);
+    CPPUNIT_TEST (testManyUnexpectedCharacters);
+    CPPUNIT_TEST (testNoPerCharacterAllocation);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void testTokens()
+    {
+        std::vector<int> tokens = lex("var foo : int = -0x1F;");
+
+        CPPUNIT_ASSERT (tokens.size() == 7);
+        CPPUNIT_ASSERT (tokens[0] == yy::SoyaParser::token::VAR);
+        CPPUNIT_ASSERT (tokens[1] == yy::SoyaParser::token::IDENTIFIER);
+        CPPUNIT_ASSERT (tokens[2] == yy::SoyaParser::token::COLON);
+        CPPUNIT_ASSERT (tokens[3] == yy::SoyaParser::token::INT_TYPE);
+        CPPUNIT_ASSERT (tokens[4] == yy::SoyaParser::token::ASSIGN);
+        CPPUNIT_ASSERT (tokens[5] == yy::SoyaParser::token::INT_LITERAL);
+        CPPUNIT_ASSERT (tokens[6] == yy::SoyaParser::token::SCOLON);
+    }
+
+    void testKeywords()
+    {
+        std::vector<int> tokens
+            = lex("as constructor continue protected ulong xor asx consts");
+
+        CPPUNIT_ASSERT (tokens.size() == 8);
+        CPPUNIT_ASSERT (tokens[0] == yy::SoyaParser::token::AS);
+        CPPUNIT_ASSERT (tokens[1] == yy::SoyaParser::token::CONSTRUCTOR);
+        CPPUNIT_ASSERT (tokens[2] == yy::SoyaParser::token::CONTINUE);
+        CPPUNIT_ASSERT (tokens[3] == yy::SoyaParser::token::PROTECTED);
+        CPPUNIT_ASSERT (tokens[4] == yy::SoyaParser::token::ULONG);
+        CPPUNIT_ASSERT (tokens[5] == yy::SoyaParser::token::XOR);
+        CPPUNIT_ASSERT (tokens[6] == yy::SoyaParser::token::IDENTIFIER);
+        CPPUNIT_ASSERT (tokens[7] == yy::SoyaParser::token::IDENTIFIER);
+    }
+
+    void testIntegerTypes()
+    {
+        std::vector<int> tokens = lex("int uint int16 uint64 int16x uin");
+
+        CPPUNIT_ASSERT (tokens.size() == 6);
+        CPPUNIT_ASSERT (tokens[0] == yy::SoyaParser::token::INT_TYPE);
+        CPPUNIT_ASSERT (tokens[1] == yy::SoyaParser::token::INT_TYPE);
+        CPPUNIT_ASSERT (tokens[2] == yy::SoyaParser::token::INT_TYPE);
+        CPPUNIT_ASSERT (tokens[3] == yy::SoyaParser::token::INT_TYPE);
+        CPPUNIT_ASSERT (tokens[4] == yy::SoyaParser::token::IDENTIFIER);
+        CPPUNIT_ASSERT (tokens[5] == yy::SoyaParser::token::IDENTIFIER);
+    }
+
+    void testIdentifiers()
+    {
+        std::istringstream stream("foo bar foo");
+        PassResultBuilder resultBuilder;
+        Lexer lexer(&stream, "<test>", &resultBuilder);
+
+        yy::SoyaParser::semantic_type yylval;
+        yy::SoyaParser::location_type yylloc;
+        std::vector<soyac::ast::Identifier> identifiers;
+
+        while (lexer.nextToken(&yylval, &yylloc) != -1) {
+            identifiers.push_back(yylval.identifier);
+        }
+
+        CPPUNIT_ASSERT (identifiers.size() == 3);
+        CPPUNIT_ASSERT (identifiers[0] == "foo");
+        CPPUNIT_ASSERT (identifiers[1] == "bar");
+        CPPUNIT_ASSERT (identifiers[0] == identifiers[2]);
+        CPPUNIT_ASSERT (identifiers[0] != identifiers[1]);
+    }
+
+    void testComments()
+    {
+        std::vector<int> tokens = lex("/* a\n * b */ foo // bar\n baz");
+
+        CPPUNIT_ASSERT (tokens.size() == 2);
+        CPPUNIT_ASSERT (tokens[0] == yy::SoyaParser::token::IDENTIFIER);
+        CPPUNIT_ASSERT (tokens[1] == yy::SoyaParser::token::IDENTIFIER);
+    }
+
+    void testLineTerminators()
+    {
+        std::vector<int> lines;
+        lex("a\nb\r\nc\rd\xe2\x80\xa8" "e", &lines);
+
+        CPPUNIT_ASSERT (lines.size() == 5);
+        CPPUNIT_ASSERT (lines[0] == 1);
+        CPPUNIT_ASSERT (lines[1] == 2);
+        CPPUNIT_ASSERT (lines[2] == 3);
+        CPPUNIT_ASSERT (lines[3] == 4);
+        CPPUNIT_ASSERT (lines[4] == 5);
+    }
+
+    void testBlankRuns()
+    {
+        /*
+         * Runs of blanks of different lengths, so that they start and end
+         * at different offsets within the blocks skipped at once.
+         */
+        std::string source;
+
+        for (int i = 0; i < 70; i++) {
+            source += std::string(i, ' ') + "\n" + std::string(i, '\t')
+                + "x\n";
+        }
+
+        std::vector<int> lines;
+        std::vector<int> columns;
+        lex(source, &lines, &columns);
+
+        CPPUNIT_ASSERT (lines.size() == 70);
+
+        for (int i = 0; i < 70; i++) {
+            CPPUNIT_ASSERT (lines[i] == 2 * i + 2);
+            CPPUNIT_ASSERT (columns[i] == i + 1);
+        }
+    }
+
+    void testManyBlankLines()
+    {
+        std::string source = std::string(10000000, '\n') + " foo";
+
+        std::vector<int> lines;
+        std::vector<int> columns;
+        std::vector<int> tokens = lex(source, &lines, &columns);
+
+        CPPUNIT_ASSERT (tokens.size() == 1);
+        CPPUNIT_ASSERT (lines[0] == 10000001);
+        CPPUNIT_ASSERT (columns[0] == 2);
+    }
+
+    void testManyUnexpectedCharacters()
+    {
+        std::vector<int> tokens = lex(std::string(1000000, '$') + "foo");
+
+        CPPUNIT_ASSERT (tokens.size() == 1);
+        CPPUNIT_ASSERT (tokens[0] == yy::SoyaParser::token::IDENTIFIER);
+    }
+
+    void testNoPerCharacterAllocation()
+    {
+        std::string source = "/*" + std::string(100000, '*') + "*/\n"
+            + std::string(100000, ' ') + "\n// "
+            + std::string(100000, 'x') + "\n( ) ;";
+
+        std::istringstream stream(source);
+        PassResultBuilder resultBuilder;
+
+        long allocationsBefore = AllocationCounter::count();
+        Lexer lexer(&stream, "<test>", &resultBuilder);
+
+        yy::SoyaParser::semantic_type yylval;
+        yy::SoyaParser::location_type yylloc;
+        int numTokens = 0;
+
+        while (lexer.nextToken(&yylval, &yylloc) != -1) {
+            numTokens++;
+        }
+
+        long allocations = AllocationCounter::count() - allocationsBefore;
+
+        CPPUNIT_ASSERT (numTokens == 3);
+        CPPUNIT_ASSERT (allocations < 100);
+    }
+
+private:
+    std::vector<int> lex(const std::string& source,
+        std::vector<int>* lines = nullptr, std::vector<int>* columns = nullptr)
+    {
+        std::istringstream stream(source);
+        PassResultBuilder resultBuilder;
+        Lexer lexer(&stream, "<test>", &resultBuilder);
+
+        yy::SoyaParser::semantic_type yylval;
+        yy::SoyaParser::location_type yylloc;
+        std::vector<int> tokens;
+        int token;
+
+        while ((token = lexer.nextToken(&yylval, &yylloc)) != -1) {
+            tokens.push_back(token);
+
+            if (lines != nullptr) {
+                lines->push_back(yylloc.begin.line);
+            }
+
+            if (columns != nullptr) {
+                columns->push_back(yylloc.begin.column);
+            }
+        }
+
+        return tokens;
+    }
+};
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_PARSER_DRIVER_TEST_H_
+#define SOYA_PARSER_DRIVER_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <parser/ParserDriver.h>
+
+using soyac::parser::ModuleHeader;
+using soyac::parser::ParserDriver;
+
+class ParserDriverTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (ParserDriverTest);
+    CPPUNIT_TEST (testScanHeader);
+    CPPUNIT_TEST (testScanHeaderWithoutModule);
+    CPPUNIT_TEST (testScanHeaderStopsAtStatements);
+    CPPUNIT_TEST (testParseCount);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void setUp()
+    {
+        mPath = std::filesystem::temp_directory_path()
+            / ("soyac-parser-driver-test-" + std::to_string(getpid())
+                + ".soya");
+    }
+
+    void tearDown()
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    void testScanHeader()
+    {
+        writeFile("module foo::bar;\n"
+                  "import baz;\n"
+                  "static import qux;\n"
+                  "import samples::foo.func;\n"
+                  "import samples::foo.Struct;\n"
+                  "function f() {}\n");
+        ModuleHeader header = ParserDriver(mPath.string()).scanHeader();
+
+        CPPUNIT_ASSERT (header.moduleName == "foo::bar");
+        CPPUNIT_ASSERT (header.importedModules.size() == 3);
+        CPPUNIT_ASSERT (header.importedModules.count("baz") == 1);
+        CPPUNIT_ASSERT (header.importedModules.count("qux") == 1);
+        CPPUNIT_ASSERT (header.importedModules.count("samples::foo") == 1);
+    }
+
+    void testScanHeaderWithoutModule()
+    {
+        writeFile("import foo.bar;\nvar x = 1;\n");
+        ModuleHeader header = ParserDriver(mPath.string()).scanHeader();
+
+        CPPUNIT_ASSERT (header.moduleName == "");
+        CPPUNIT_ASSERT (header.importedModules.size() == 1);
+        CPPUNIT_ASSERT (header.importedModules.count("foo") == 1);
+    }
+
+    void testScanHeaderStopsAtStatements()
+    {
+        writeFile("var x = 1;\nimport foo;\n");
+        ModuleHeader header = ParserDriver(mPath.string()).scanHeader();
+
+        CPPUNIT_ASSERT (header.importedModules.empty());
+    }
+
+    void testParseCount()
+    {
+        writeFile("module __parser_driver_test__;\nimport foo;\n");
+        unsigned before = ParserDriver::parseCount();
+
+        ParserDriver(mPath.string()).scanHeader();
+        CPPUNIT_ASSERT (ParserDriver::parseCount() == before);
+
+        soyac::PassResult* result = nullptr;
+        ParserDriver(mPath.string()).parse(result);
+        CPPUNIT_ASSERT (ParserDriver::parseCount() == before + 1);
+    }
+
+private:
+    std::filesystem::path mPath;
+
+    void writeFile(const std::string& contents)
+    {
+        std::ofstream stream(mPath.string().c_str(), std::ios_base::binary);
+        stream << contents;
+    }
+};
+
+#endif
@@ -0,0 +1,99 @@
+/*
+ * soyac - The Soya programming language compiler
+ * Copyright (c) 2009 Denis Washington <dwashington@gmx.net>
+ *
+ * This file is distributed under the terms of the MIT license.
+ * See LICENSE.txt for details.
+ */
+
+#ifndef SOYA_SOURCE_FILE_TEST_H_
+#define SOYA_SOURCE_FILE_TEST_H_
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+#include <parser/SourceFile.h>
+
+using soyac::parser::SourceFile;
+
+class SourceFileTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE (SourceFileTest);
+    CPPUNIT_TEST (testMapped);
+    CPPUNIT_TEST (testPageSized);
+    CPPUNIT_TEST (testEmpty);
+    CPPUNIT_TEST (testNonexistent);
+    CPPUNIT_TEST_SUITE_END ();
+
+public:
+    void setUp()
+    {
+        mPath = std::filesystem::temp_directory_path()
+            / ("soyac-source-file-test-" + std::to_string(getpid()));
+    }
+
+    void tearDown()
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    void testMapped()
+    {
+        writeFile("var foo : int;");
+        SourceFile file(mPath.string());
+
+        CPPUNIT_ASSERT (file.isMapped());
+        CPPUNIT_ASSERT (file.size() == 14);
+        CPPUNIT_ASSERT (std::strcmp(file.data(), "var foo : int;") == 0);
+    }
+
+    void testPageSized()
+    {
+        std::string contents(sysconf(_SC_PAGESIZE), ' ');
+        writeFile(contents);
+        SourceFile file(mPath.string());
+
+        CPPUNIT_ASSERT (!file.isMapped());
+        CPPUNIT_ASSERT (file.size() == contents.size());
+        CPPUNIT_ASSERT (file.data()[file.size()] == '\0');
+        CPPUNIT_ASSERT (contents == file.data());
+    }
+
+    void testEmpty()
+    {
+        writeFile("");
+        SourceFile file(mPath.string());
+
+        CPPUNIT_ASSERT (file.size() == 0);
+        CPPUNIT_ASSERT (file.data()[0] == '\0');
+    }
+
+    void testNonexistent()
+    {
+        bool thrown = false;
+
+        try {
+            SourceFile file(mPath.string());
+        } catch (const std::ifstream::failure&) {
+            thrown = true;
+        }
+
+        CPPUNIT_ASSERT (thrown);
+    }
+
+private:
+    std::filesystem::path mPath;
+
+    void writeFile(const std::string& contents)
+    {
+        std::ofstream stream(mPath.string().c_str(), std::ios_base::binary);
+        stream << contents;
+    }
+};
+
+#endif